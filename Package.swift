@@ -17,12 +17,16 @@ let package = Package(
             sources: [
                 "src/parser.c",
                 "src/scanner.c",
+                "expression/src/parser.c",
+                "expression/src/scanner.c",
+                "tools/blocks.c",
+                "tools/kinds.c",
             ],
             resources: [
                 .copy("queries")
             ],
             publicHeadersPath: "bindings/swift",
-            cSettings: [.headerSearchPath("src")]
+            cSettings: [.headerSearchPath("src"), .headerSearchPath("bindings/c")]
         ),
         .testTarget(
             name: "TreeSitterHTMLTests",
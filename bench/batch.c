@@ -0,0 +1,112 @@
+#include "bench.h"
+#include "tree-sitter-htmldjango-tools.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Times htmldjango_parse_batch() over the corpus with 1, 2, 4, ... threads up
+// to --threads (default: one per online CPU), then once more reading every
+// file by path. Near-linear scaling shows up as an efficiency close to 1.
+// For a large project:
+//
+//   bench/gen_corpus.py --out /tmp/corpus-100k --files 100000
+
+// Callbacks run concurrently; each worker only touches its own slot
+typedef struct {
+    _Alignas(64) uint64_t nodes;
+    uint64_t errors;
+} WorkerCounts;
+
+static bool count_tree(void *payload, unsigned worker, size_t index, TSTree *tree,
+                       const HTMLDjangoSummary *summary) {
+    (void)index;
+    (void)tree;
+    WorkerCounts *counts = &((WorkerCounts *)payload)[worker];
+    counts->nodes += summary->node_count;
+    counts->errors += summary->has_error || summary->read_error;
+    return false;
+}
+
+typedef struct {
+    double seconds;
+    uint64_t nodes;
+    uint64_t errors;
+} BatchRun;
+
+static BatchRun run_batch(const HTMLDjangoInput *inputs, size_t count, unsigned threads,
+                          unsigned iterations) {
+    WorkerCounts *counts = calloc(threads, sizeof(WorkerCounts));
+    HTMLDjangoBatchOptions batch = {.threads = threads, .callback = count_tree, .payload = counts};
+    BatchRun run = {0};
+
+    double start = bench_now();
+    for (unsigned i = 0; i < iterations; i++) htmldjango_parse_batch(inputs, count, &batch);
+    run.seconds = (bench_now() - start) / iterations;
+
+    for (unsigned i = 0; i < threads; i++) {
+        run.nodes += counts[i].nodes;
+        run.errors += counts[i].errors;
+    }
+    run.nodes /= iterations;
+    run.errors /= iterations;
+    free(counts);
+    return run;
+}
+
+static void report(const char *input, unsigned threads, const BatchRun *run, double baseline,
+                   const Corpus *corpus, bool json) {
+    double speedup = baseline / run->seconds;
+    double megabytes = (double)corpus->total_bytes / 1e6;
+    if (json) {
+        printf("{\"input\": \"%s\", \"threads\": %u, \"seconds\": %.6f, \"mb_s\": %.2f, "
+               "\"files_s\": %.0f, \"speedup\": %.2f, \"efficiency\": %.2f, \"nodes\": %llu, "
+               "\"errors\": %llu}\n",
+               input, threads, run->seconds, megabytes / run->seconds, corpus->count / run->seconds,
+               speedup, speedup / threads, (unsigned long long)run->nodes,
+               (unsigned long long)run->errors);
+        return;
+    }
+    printf("%-8s %8u %10.3f %10.2f %12.0f %8.2f %10.2f\n", input, threads, run->seconds * 1e3,
+           megabytes / run->seconds, corpus->count / run->seconds, speedup, speedup / threads);
+}
+
+int bench_batch(const Corpus *corpus, const BenchOptions *options) {
+    HTMLDjangoBatchOptions defaults = {.threads = options->threads};
+    unsigned max_threads = htmldjango_batch_threads(&defaults);
+
+    HTMLDjangoInput *inputs = calloc(corpus->count, sizeof(HTMLDjangoInput));
+    HTMLDjangoInput *files = calloc(corpus->count, sizeof(HTMLDjangoInput));
+    for (size_t i = 0; i < corpus->count; i++) {
+        const Document *document = &corpus->documents[i];
+        inputs[i] = (HTMLDjangoInput){.source = document->source, .length = document->length, .path = document->path};
+        files[i] = (HTMLDjangoInput){.path = document->path};
+    }
+
+    if (!options->json) {
+        printf("files: %zu, bytes: %llu\n\n", corpus->count, (unsigned long long)corpus->total_bytes);
+        printf("%-8s %8s %10s %10s %12s %8s %10s\n", "input", "threads", "ms/pass", "MB/s", "files/s",
+               "speedup", "efficiency");
+    }
+
+    BatchRun single = run_batch(inputs, corpus->count, 1, options->iterations);
+    report("buffers", 1, &single, single.seconds, corpus, options->json);
+    int status = 0;
+    for (unsigned threads = 2; threads < 2 * max_threads; threads *= 2) {
+        if (threads > max_threads) threads = max_threads;
+        BatchRun run = run_batch(inputs, corpus->count, threads, options->iterations);
+        report("buffers", threads, &run, single.seconds, corpus, options->json);
+        if (run.nodes != single.nodes) {
+            fprintf(stderr, "htmldjango-bench: %u threads produced %llu nodes, 1 thread %llu\n",
+                    threads, (unsigned long long)run.nodes, (unsigned long long)single.nodes);
+            status = 1;
+        }
+    }
+
+    BatchRun from_files = run_batch(files, corpus->count, max_threads, options->iterations);
+    report("paths", max_threads, &from_files, single.seconds, corpus, options->json);
+    if (!options->json) printf("\npeak rss: %ld KB\n", bench_peak_rss_kb());
+
+    free(inputs);
+    free(files);
+    return status;
+}
@@ -0,0 +1,419 @@
+#define _GNU_SOURCE
+
+#include "bench.h"
+#include "tree-sitter-htmldjango.h"
+
+#include <dirent.h>
+#include <dlfcn.h>
+#include <errno.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <time.h>
+
+// ============================================================================
+// Counting allocator
+// ============================================================================
+
+// Every block is prefixed with its size so frees can be accounted for.
+// The header is padded to keep the returned pointer maximally aligned.
+typedef union {
+    size_t size;
+    max_align_t align;
+} AllocHeader;
+
+static _Atomic size_t live_bytes = 0;
+static _Atomic size_t peak_bytes = 0;
+
+static void track(size_t added, size_t removed) {
+    size_t live = atomic_fetch_add(&live_bytes, added - removed) + added - removed;
+    size_t peak = atomic_load(&peak_bytes);
+    while (live > peak && !atomic_compare_exchange_weak(&peak_bytes, &peak, live));
+}
+
+static void *counting_malloc(size_t size) {
+    AllocHeader *header = malloc(sizeof(AllocHeader) + size);
+    if (!header) return NULL;
+    header->size = size;
+    track(size, 0);
+    return header + 1;
+}
+
+static void *counting_calloc(size_t count, size_t size) {
+    AllocHeader *header = calloc(1, sizeof(AllocHeader) + count * size);
+    if (!header) return NULL;
+    header->size = count * size;
+    track(count * size, 0);
+    return header + 1;
+}
+
+static void *counting_realloc(void *pointer, size_t size) {
+    if (!pointer) return counting_malloc(size);
+    AllocHeader *header = (AllocHeader *)pointer - 1;
+    size_t old_size = header->size;
+    header = realloc(header, sizeof(AllocHeader) + size);
+    if (!header) return NULL;
+    header->size = size;
+    track(size, old_size);
+    return header + 1;
+}
+
+static void counting_free(void *pointer) {
+    if (!pointer) return;
+    AllocHeader *header = (AllocHeader *)pointer - 1;
+    track(0, header->size);
+    free(header);
+}
+
+size_t bench_live_bytes(void) { return live_bytes; }
+
+size_t bench_peak_bytes(void) { return peak_bytes; }
+
+void bench_reset_peak(void) { peak_bytes = live_bytes; }
+
+double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+long bench_peak_rss_kb(void) {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+long bench_file_size(const char *path) {
+    struct stat info;
+    return path && stat(path, &info) == 0 ? (long)info.st_size : -1;
+}
+
+// With BUILD_SHARED_LIBS=OFF the grammar is linked into the harness, so this
+// is the harness executable and its size says little about the grammar.
+const char *bench_library_path(void) {
+    Dl_info info;
+    const TSLanguage *(*language)(void) = tree_sitter_htmldjango;
+    return dladdr(*(void **)&language, &info) ? info.dli_fname : NULL;
+}
+
+TSQuery *bench_load_query(const TSLanguage *language, const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "htmldjango-bench: cannot open %s: %s\n", path, strerror(errno));
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *source = malloc(length > 0 ? (size_t)length : 1);
+    size_t read = length > 0 ? fread(source, 1, (size_t)length, file) : 0;
+    fclose(file);
+
+    uint32_t error_offset;
+    TSQueryError error_type;
+    TSQuery *query = ts_query_new(language, source, (uint32_t)read, &error_offset, &error_type);
+    if (!query) {
+        fprintf(stderr, "htmldjango-bench: %s: query error %d at byte %u\n", path, (int)error_type, error_offset);
+    }
+    free(source);
+    return query;
+}
+
+// ============================================================================
+// Corpus loading
+// ============================================================================
+
+// Extensions picked up when a directory is given, matching tree-sitter.json
+static const char *TEMPLATE_EXTENSIONS[] = {".html", ".htm", ".django", ".htmldjango", NULL};
+
+static bool has_template_extension(const char *path) {
+    const char *dot = strrchr(path, '.');
+    if (!dot) return false;
+    for (const char **ext = TEMPLATE_EXTENSIONS; *ext; ext++) {
+        if (strcmp(dot, *ext) == 0) return true;
+    }
+    return false;
+}
+
+static void corpus_push(Corpus *corpus, const char *path, char *source, uint32_t length) {
+    if (corpus->count == corpus->capacity) {
+        corpus->capacity = corpus->capacity ? corpus->capacity * 2 : 64;
+        corpus->documents = realloc(corpus->documents, corpus->capacity * sizeof(Document));
+    }
+    Document *document = &corpus->documents[corpus->count++];
+    document->path = strdup(path);
+    document->source = source;
+    document->length = length;
+    corpus->total_bytes += length;
+}
+
+static bool corpus_add_file(Corpus *corpus, const char *path) {
+    if (corpus->paths_only) {
+        long length = bench_file_size(path);
+        if (length < 0 || (unsigned long)length > UINT32_MAX) {
+            fprintf(stderr, "htmldjango-bench: cannot size %s\n", path);
+            return false;
+        }
+        corpus_push(corpus, path, NULL, (uint32_t)length);
+        return true;
+    }
+
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "htmldjango-bench: cannot open %s: %s\n", path, strerror(errno));
+        return false;
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (length < 0 || (unsigned long)length > UINT32_MAX) {
+        fprintf(stderr, "htmldjango-bench: cannot size %s\n", path);
+        fclose(file);
+        return false;
+    }
+
+    char *source = malloc((size_t)length + 1);
+    size_t read = fread(source, 1, (size_t)length, file);
+    fclose(file);
+    source[read] = '\0';
+    corpus_push(corpus, path, source, (uint32_t)read);
+    return true;
+}
+
+static bool corpus_add_path(Corpus *corpus, const char *path, bool explicit) {
+    struct stat info;
+    if (stat(path, &info) != 0) {
+        fprintf(stderr, "htmldjango-bench: cannot stat %s: %s\n", path, strerror(errno));
+        return false;
+    }
+
+    if (!S_ISDIR(info.st_mode)) {
+        if (!explicit && !has_template_extension(path)) return true;
+        return corpus_add_file(corpus, path);
+    }
+
+    DIR *dir = opendir(path);
+    if (!dir) {
+        fprintf(stderr, "htmldjango-bench: cannot open %s: %s\n", path, strerror(errno));
+        return false;
+    }
+    bool ok = true;
+    struct dirent *entry;
+    while (ok && (entry = readdir(dir))) {
+        if (entry->d_name[0] == '.') continue;
+        size_t length = strlen(path) + strlen(entry->d_name) + 2;
+        char *child = malloc(length);
+        snprintf(child, length, "%s/%s", path, entry->d_name);
+        ok = corpus_add_path(corpus, child, false);
+        free(child);
+    }
+    closedir(dir);
+    return ok;
+}
+
+static int compare_documents(const void *a, const void *b) {
+    return strcmp(((const Document *)a)->path, ((const Document *)b)->path);
+}
+
+static void corpus_delete(Corpus *corpus) {
+    for (size_t i = 0; i < corpus->count; i++) {
+        free(corpus->documents[i].path);
+        free(corpus->documents[i].source);
+    }
+    free(corpus->documents);
+}
+
+// ============================================================================
+// Throughput mode
+// ============================================================================
+
+// Number of empty parses used to estimate the fixed cost of a parse call
+#define EMPTY_PARSE_CALLS 10000
+
+int bench_throughput(const Corpus *corpus, const BenchOptions *options) {
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, tree_sitter_htmldjango());
+
+    double start = bench_now();
+    for (unsigned i = 0; i < EMPTY_PARSE_CALLS; i++) {
+        ts_tree_delete(ts_parser_parse_string(parser, NULL, "", 0));
+    }
+    double empty_call = (bench_now() - start) / EMPTY_PARSE_CALLS;
+
+    unsigned error_count = 0;
+    start = bench_now();
+    for (unsigned i = 0; i < options->iterations; i++) {
+        for (size_t j = 0; j < corpus->count; j++) {
+            const Document *document = &corpus->documents[j];
+            TSTree *tree = ts_parser_parse_string(parser, NULL, document->source, document->length);
+            if (i == 0 && ts_node_has_error(ts_tree_root_node(tree))) error_count++;
+            ts_tree_delete(tree);
+        }
+    }
+    double elapsed = bench_now() - start;
+    ts_parser_delete(parser);
+
+    double bytes = (double)corpus->total_bytes * options->iterations;
+    double files = (double)corpus->count * options->iterations;
+
+    // The JSON shape is shared with the binding runners in bench/bindings
+    if (options->json) {
+        printf("{\"binding\": \"c\", \"files\": %zu, \"bytes\": %llu, \"iterations\": %u, "
+               "\"seconds\": %.6f, \"empty_call_us\": %.3f, \"errors\": %u, \"peak_rss_kb\": %ld}\n",
+               corpus->count, (unsigned long long)corpus->total_bytes, options->iterations,
+               elapsed, empty_call * 1e6, error_count, bench_peak_rss_kb());
+        return 0;
+    }
+
+    printf("files:       %zu (%u with errors)\n", corpus->count, error_count);
+    printf("bytes:       %llu\n", (unsigned long long)corpus->total_bytes);
+    printf("iterations:  %u\n", options->iterations);
+    printf("time:        %.3f s\n", elapsed);
+    printf("throughput:  %.2f MB/s, %.0f files/s\n", bytes / elapsed / 1e6, files / elapsed);
+    printf("empty parse: %.2f us per call\n", empty_call * 1e6);
+    printf("peak rss:    %ld KB\n", bench_peak_rss_kb());
+    return 0;
+}
+
+// ============================================================================
+// Entry point
+// ============================================================================
+
+typedef struct {
+    const char *name;
+    int (*run)(const Corpus *corpus, const BenchOptions *options);
+    const char *description;
+    // Only list the files and their sizes; the mode reads them itself
+    bool paths_only;
+} Mode;
+
+static const Mode MODES[] = {
+    {"throughput", bench_throughput, "parse every input repeatedly and report MB/s", false},
+    {"memory", bench_memory, "report tree bytes, node counts and a per-node-type breakdown", false},
+    {"compare", bench_compare, "compare against a baseline grammar such as tree-sitter-html", false},
+    {"forks", bench_forks, "count GLR forks and live stack versions per grammar conflict", false},
+    {"tables", bench_tables, "report parse table size, library load time and throughput", false},
+    {"injections", bench_injections, "count script and style injections and time injections.scm", false},
+    {"query", bench_query, "time queries (default highlights, open-tags, tags, locals)", false},
+    {"batch", bench_batch, "time htmldjango_parse_batch() with 1, 2, 4, ... threads", false},
+    {"mmap", bench_mapped, "compare peak memory of reading and memory-mapping each file", true},
+    {"deps", bench_dependencies, "time dependency extraction against parse and query", false},
+    {"cst", bench_cst, "compare binary tree export with JSON and S-expressions", false},
+    {"kinds", bench_kinds, "compare strcmp, stable kind ID and raw symbol tree walks", false},
+    {NULL, NULL, NULL, false},
+};
+
+static void print_usage(FILE *stream) {
+    fprintf(stream,
+            "usage: htmldjango-bench [--mode MODE] [--iterations N] [--top N] [--budget X] [--json]\n"
+            "                        [--baseline-lib PATH] [--max-overhead PCT] [--query FILE]\n"
+            "                        [--threads N] PATH...\n"
+            "\n"
+            "PATH may be a template file or a directory, which is searched recursively\n"
+            "for .html, .htm, .django and .htmldjango files.\n"
+            "\n"
+            "modes:\n");
+    for (const Mode *mode = MODES; mode->name; mode++) {
+        fprintf(stream, "  %-12s %s\n", mode->name, mode->description);
+    }
+    fprintf(stream,
+            "\n"
+            "options:\n"
+            "  --iterations N  number of passes over the corpus (throughput, injections, default 10)\n"
+            "  --top N         rows to list in the memory and forks breakdowns (default 25)\n"
+            "  --budget X      fail when tree bytes per input byte (memory) or forks per KB\n"
+            "                  (forks) exceed X\n"
+            "  --json          print a single JSON object (throughput, tables, injections),\n"
+            "                  or one per row (query, batch)\n"
+            "  --baseline-lib PATH\n"
+            "                  shared library of the baseline grammar (compare)\n"
+            "  --baseline-symbol NAME\n"
+            "                  language function in that library (compare, default tree_sitter_html)\n"
+            "  --max-overhead PCT\n"
+            "                  fail when time or tree memory exceed the baseline by PCT percent (compare)\n"
+            "  --query FILE    query file to time, may be repeated (query)\n"
+            "  --threads N     most worker threads to time (batch, default one per online CPU)\n");
+}
+
+int main(int argc, char **argv) {
+    ts_set_allocator(counting_malloc, counting_calloc, counting_realloc, counting_free);
+
+    const Mode *mode = &MODES[0];
+    BenchOptions options = {.iterations = 10, .top = 25, .baseline_symbol = "tree_sitter_html"};
+    Corpus corpus = {0};
+    const char **paths = calloc((size_t)argc, sizeof(char *));
+    size_t path_count = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+            print_usage(stdout);
+            return 0;
+        } else if (strcmp(arg, "--mode") == 0 && has_value) {
+            const char *name = argv[++i];
+            for (mode = MODES; mode->name && strcmp(mode->name, name) != 0; mode++);
+            if (!mode->name) {
+                fprintf(stderr, "htmldjango-bench: unknown mode '%s'\n", name);
+                return 2;
+            }
+        } else if (strcmp(arg, "--iterations") == 0 && has_value) {
+            options.iterations = (unsigned)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(arg, "--top") == 0 && has_value) {
+            options.top = (unsigned)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(arg, "--threads") == 0 && has_value) {
+            options.threads = (unsigned)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(arg, "--budget") == 0 && has_value) {
+            options.budget = strtod(argv[++i], NULL);
+        } else if (strcmp(arg, "--max-overhead") == 0 && has_value) {
+            options.max_overhead = strtod(argv[++i], NULL);
+        } else if (strcmp(arg, "--baseline-lib") == 0 && has_value) {
+            options.baseline_lib = argv[++i];
+        } else if (strcmp(arg, "--baseline-symbol") == 0 && has_value) {
+            options.baseline_symbol = argv[++i];
+        } else if (strcmp(arg, "--query") == 0 && has_value) {
+            if (options.query_count == BENCH_MAX_QUERIES) {
+                fprintf(stderr, "htmldjango-bench: at most %d --query files\n", BENCH_MAX_QUERIES);
+                return 2;
+            }
+            options.queries[options.query_count++] = argv[++i];
+        } else if (strcmp(arg, "--json") == 0) {
+            options.json = true;
+        } else if (arg[0] == '-') {
+            fprintf(stderr, "htmldjango-bench: unknown option '%s'\n", arg);
+            print_usage(stderr);
+            return 2;
+        } else {
+            paths[path_count++] = arg;
+        }
+    }
+
+    // Loaded once the mode is known, which may come after the paths
+    corpus.paths_only = mode->paths_only;
+    for (size_t i = 0; i < path_count; i++) {
+        if (!corpus_add_path(&corpus, paths[i], true)) {
+            corpus_delete(&corpus);
+            free(paths);
+            return 1;
+        }
+    }
+    free(paths);
+
+    if (corpus.count == 0) {
+        print_usage(stderr);
+        return 2;
+    }
+    if (options.iterations == 0) options.iterations = 1;
+
+    qsort(corpus.documents, corpus.count, sizeof(Document), compare_documents);
+    int status = mode->run(&corpus, &options);
+    corpus_delete(&corpus);
+    return status;
+}
@@ -0,0 +1,75 @@
+#ifndef HTMLDJANGO_BENCH_H_
+#define HTMLDJANGO_BENCH_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <tree_sitter/api.h>
+
+// source is NULL when the mode reads files itself (see Mode.paths_only)
+typedef struct {
+    char *path;
+    char *source;
+    uint32_t length;
+} Document;
+
+typedef struct {
+    Document *documents;
+    size_t count;
+    size_t capacity;
+    uint64_t total_bytes;
+    bool paths_only;
+} Corpus;
+
+#define BENCH_MAX_QUERIES 16
+
+typedef struct {
+    unsigned iterations;
+    unsigned top;
+    unsigned threads;
+    double budget;
+    bool json;
+    double max_overhead;
+    const char *baseline_lib;
+    const char *baseline_symbol;
+    const char *queries[BENCH_MAX_QUERIES];
+    unsigned query_count;
+} BenchOptions;
+
+// Monotonic clock in seconds
+double bench_now(void);
+
+// Peak resident set size of the process in kilobytes
+long bench_peak_rss_kb(void);
+
+// Size of a file in bytes, or -1 if it cannot be read
+long bench_file_size(const char *path);
+
+// Path of the shared object that provides tree_sitter_htmldjango()
+const char *bench_library_path(void);
+
+// Compiles a query file, printing the error position on failure
+TSQuery *bench_load_query(const TSLanguage *language, const char *path);
+
+// Counting allocator installed with ts_set_allocator() before any parsing.
+// Only allocations made by the tree-sitter runtime are tracked. The counters
+// are atomic because the batch mode parses on several threads.
+size_t bench_live_bytes(void);
+size_t bench_peak_bytes(void);
+void bench_reset_peak(void);
+
+int bench_throughput(const Corpus *corpus, const BenchOptions *options);
+int bench_memory(const Corpus *corpus, const BenchOptions *options);
+int bench_compare(const Corpus *corpus, const BenchOptions *options);
+int bench_forks(const Corpus *corpus, const BenchOptions *options);
+int bench_tables(const Corpus *corpus, const BenchOptions *options);
+int bench_injections(const Corpus *corpus, const BenchOptions *options);
+int bench_query(const Corpus *corpus, const BenchOptions *options);
+int bench_batch(const Corpus *corpus, const BenchOptions *options);
+int bench_mapped(const Corpus *corpus, const BenchOptions *options);
+int bench_dependencies(const Corpus *corpus, const BenchOptions *options);
+int bench_cst(const Corpus *corpus, const BenchOptions *options);
+int bench_kinds(const Corpus *corpus, const BenchOptions *options);
+
+#endif // HTMLDJANGO_BENCH_H_
@@ -0,0 +1,125 @@
+#!/usr/bin/env node
+// Measure event-loop delay while a template corpus is parsed, and print one
+// JSON line.
+//
+// The sync run parses with node-tree-sitter on the main thread, one file per
+// turn of the event loop, which is as responsive as synchronous parsing gets.
+// The async runs hand the whole corpus to parseBatchAsync(), from Buffers and
+// from paths, and leave the event loop idle. A perf_hooks histogram samples
+// the loop's delay throughout each run. The run fails if the node counts of
+// the approaches differ.
+
+const fs = require('fs');
+const path = require('path');
+const { monitorEventLoopDelay } = require('perf_hooks');
+const Parser = require('tree-sitter');
+const HTMLDjango = require('../..');
+
+const EXTENSIONS = ['.html', '.htm', '.django', '.htmldjango'];
+
+function collect(target, files) {
+  if (!fs.statSync(target).isDirectory()) {
+    files.push(target);
+    return;
+  }
+  for (const name of fs.readdirSync(target)) {
+    if (name.startsWith('.')) continue;
+    const child = path.join(target, name);
+    if (fs.statSync(child).isDirectory()) {
+      collect(child, files);
+    } else if (EXTENSIONS.includes(path.extname(name))) {
+      files.push(child);
+    }
+  }
+}
+
+// Runs `run` `iterations` times under one histogram and returns the delay
+// percentiles with the mean wall time of a run
+async function measure(iterations, run) {
+  const histogram = monitorEventLoopDelay({ resolution: 1 });
+  let result;
+  histogram.enable();
+  const start = process.hrtime.bigint();
+  for (let i = 0; i < iterations; i++) result = await run();
+  const wall = Number(process.hrtime.bigint() - start) / 1e6 / iterations;
+  histogram.disable();
+  return {
+    result,
+    stats: {
+      wall_ms: wall,
+      p50_delay_ms: histogram.percentile(50) / 1e6,
+      p99_delay_ms: histogram.percentile(99) / 1e6,
+      max_delay_ms: histogram.max / 1e6,
+    },
+  };
+}
+
+function parseSync(parser, documents) {
+  return new Promise((resolve) => {
+    const counts = [];
+    const next = () => {
+      if (counts.length === documents.length) {
+        resolve(counts);
+        return;
+      }
+      counts.push(parser.parse(documents[counts.length]).rootNode.descendantCount);
+      setImmediate(next);
+    };
+    next();
+  });
+}
+
+async function main() {
+  const args = process.argv.slice(2);
+  let iterations = 5;
+  let concurrency;
+  const paths = [];
+  for (let i = 0; i < args.length; i++) {
+    if (args[i] === '--iterations') {
+      iterations = Math.max(1, parseInt(args[++i], 10));
+    } else if (args[i] === '--concurrency') {
+      concurrency = Math.max(1, parseInt(args[++i], 10));
+    } else {
+      paths.push(args[i]);
+    }
+  }
+
+  const files = [];
+  for (const target of paths) collect(target, files);
+  files.sort();
+  const buffers = files.map((file) => fs.readFileSync(file));
+  const documents = buffers.map((buffer) => buffer.toString('utf8'));
+
+  const parser = new Parser();
+  parser.setLanguage(HTMLDjango);
+  const options = { dependencies: false, concurrency };
+  const nodeCounts = async (inputs) =>
+    (await HTMLDjango.parseBatchAsync(inputs, options)).map((summary) => summary.nodeCount);
+
+  const runs = {};
+  const results = {};
+  ({ result: results.sync, stats: runs.sync } = await measure(iterations, () => parseSync(parser, documents)));
+  ({ result: results.async, stats: runs.async } = await measure(iterations, () => nodeCounts(buffers)));
+  ({ result: results.async_paths, stats: runs.async_paths } = await measure(
+    iterations, () => nodeCounts(files.map((file) => ({ path: file })))));
+
+  const mismatches = Object.keys(results).filter(
+    (name) => results[name].some((count, i) => count !== results.sync[i]));
+  const row = {
+    binding: 'node',
+    files: files.length,
+    bytes: buffers.reduce((total, buffer) => total + buffer.length, 0),
+    threadpool: parseInt(process.env.UV_THREADPOOL_SIZE, 10) || 4,
+    mismatches,
+  };
+  for (const [name, stats] of Object.entries(runs)) {
+    for (const [key, value] of Object.entries(stats)) row[`${name}_${key}`] = value;
+  }
+  console.log(JSON.stringify(row));
+  return mismatches.length ? 1 : 0;
+}
+
+main().then((code) => process.exit(code), (error) => {
+  console.error(error.message);
+  process.exit(1);
+});
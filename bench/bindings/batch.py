@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""Compare the native parse_batch() against concurrent.futures loops.
+
+Every approach produces the same summary per template: its node count and
+the byte ranges of its outermost ERROR and MISSING nodes. The Python ones
+parse with py-tree-sitter, serially, on a ThreadPoolExecutor with one
+parser per thread, and on a ProcessPoolExecutor. The native one parses on
+its own threads with the GIL released, from bytes and from paths, and is
+also timed with dependency lists and binary trees switched on. The run
+fails if any approach disagrees with the serial loop.
+"""
+
+import argparse
+import json
+import os
+import sys
+import threading
+import time
+from concurrent.futures import ProcessPoolExecutor, ThreadPoolExecutor
+
+import tree_sitter_htmldjango
+from tree_sitter import Language, Parser
+
+from bench import EXTENSIONS
+
+LANGUAGE = Language(tree_sitter_htmldjango.language())
+_local = threading.local()
+
+
+def error_ranges(node):
+    if node.is_error or node.is_missing:
+        return [(node.start_byte, node.end_byte)]
+    if not node.has_error:
+        return []
+    return [error for child in node.children for error in error_ranges(child)]
+
+
+def summarize(source):
+    parser = getattr(_local, "parser", None)
+    if parser is None:
+        parser = _local.parser = Parser(LANGUAGE)
+    root = parser.parse(source).root_node
+    return root.descendant_count, error_ranges(root)
+
+
+def summarize_chunk(sources):
+    return [summarize(source) for source in sources]
+
+
+def list_files(paths):
+    files = []
+    for path in paths:
+        if not os.path.isdir(path):
+            files.append(path)
+            continue
+        for root, dirs, names in os.walk(path):
+            dirs[:] = [d for d in dirs if not d.startswith(".")]
+            files.extend(os.path.join(root, n) for n in names
+                         if n.endswith(EXTENSIONS) and not n.startswith("."))
+    return sorted(files)
+
+
+def timed(iterations, run):
+    start = time.perf_counter()
+    for _ in range(iterations):
+        result = run()
+    return (time.perf_counter() - start) / iterations, result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--iterations", type=int, default=5)
+    parser.add_argument("--threads", type=int, default=os.cpu_count() or 1)
+    parser.add_argument("paths", nargs="+")
+    args = parser.parse_args()
+    iterations = max(1, args.iterations)
+    threads = max(1, args.threads)
+
+    files = list_files(args.paths)
+    sources = []
+    for path in files:
+        with open(path, "rb") as f:
+            sources.append(f.read())
+    chunk = max(1, len(sources) // (threads * 4))
+    chunks = [sources[i:i + chunk] for i in range(0, len(sources), chunk)]
+
+    times = {}
+    times["serial"], expected = timed(iterations, lambda: [summarize(source) for source in sources])
+    results = {}
+    with ThreadPoolExecutor(threads) as pool:
+        times["thread_pool"], results["thread_pool"] = timed(
+            iterations, lambda: list(pool.map(summarize, sources)))
+    with ProcessPoolExecutor(threads) as pool:
+        times["process_pool"], results["process_pool"] = timed(
+            iterations, lambda: [summary for part in pool.map(summarize_chunk, chunks) for summary in part])
+
+    def native(inputs, **options):
+        return [(summary.node_count, summary.error_ranges)
+                for summary in tree_sitter_htmldjango.parse_batch(inputs, threads=threads, **options)]
+
+    times["native"], results["native"] = timed(iterations, lambda: native(sources, dependencies=False))
+    times["native_paths"], results["native_paths"] = timed(iterations, lambda: native(files, dependencies=False))
+    times["native_dependencies"], results["native_dependencies"] = timed(iterations, lambda: native(sources))
+    times["native_trees"], results["native_trees"] = timed(
+        iterations, lambda: native(sources, dependencies=False, trees=True))
+
+    mismatches = sorted(name for name, result in results.items() if result != expected)
+    print(json.dumps({
+        "files": len(sources),
+        "bytes": sum(len(source) for source in sources),
+        "threads": threads,
+        "files_with_errors": sum(bool(errors) for _, errors in expected),
+        **{f"{name}_ms": seconds * 1e3 for name, seconds in times.items()},
+        "speedup_vs_serial": times["serial"] / times["native"],
+        "speedup_vs_thread_pool": times["thread_pool"] / times["native"],
+        "speedup_vs_process_pool": times["process_pool"] / times["native"],
+        "mismatches": mismatches,
+    }))
+    return 1 if mismatches else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,75 @@
+#!/usr/bin/env node
+// Parse a template corpus through the Node binding and print one JSON line.
+//
+// The output has the same shape as `htmldjango-bench --mode throughput --json`
+// so that bench/bindings/run.py can compare it against the C harness.
+
+const fs = require('fs');
+const path = require('path');
+const Parser = require('tree-sitter');
+const HTMLDjango = require('../..');
+
+const EXTENSIONS = ['.html', '.htm', '.django', '.htmldjango'];
+const EMPTY_PARSE_CALLS = 10000;
+
+function collect(target, files) {
+  if (!fs.statSync(target).isDirectory()) {
+    files.push(target);
+    return;
+  }
+  for (const name of fs.readdirSync(target)) {
+    if (name.startsWith('.')) continue;
+    const child = path.join(target, name);
+    if (fs.statSync(child).isDirectory()) {
+      collect(child, files);
+    } else if (EXTENSIONS.includes(path.extname(name))) {
+      files.push(child);
+    }
+  }
+}
+
+function main() {
+  const args = process.argv.slice(2);
+  let iterations = 10;
+  const paths = [];
+  for (let i = 0; i < args.length; i++) {
+    if (args[i] === '--iterations') {
+      iterations = Math.max(1, parseInt(args[++i], 10));
+    } else {
+      paths.push(args[i]);
+    }
+  }
+
+  const files = [];
+  for (const target of paths) collect(target, files);
+  files.sort();
+  // The binding parses JavaScript strings, so sources are decoded up front
+  const documents = files.map((file) => fs.readFileSync(file, 'utf8'));
+
+  const parser = new Parser();
+  parser.setLanguage(HTMLDjango);
+
+  let start = process.hrtime.bigint();
+  for (let i = 0; i < EMPTY_PARSE_CALLS; i++) parser.parse('');
+  const emptyCall = Number(process.hrtime.bigint() - start) / 1e9 / EMPTY_PARSE_CALLS;
+
+  const errors = documents.filter((source) => parser.parse(source).rootNode.hasError).length;
+  start = process.hrtime.bigint();
+  for (let i = 0; i < iterations; i++) {
+    for (const source of documents) parser.parse(source);
+  }
+  const seconds = Number(process.hrtime.bigint() - start) / 1e9;
+
+  console.log(JSON.stringify({
+    binding: 'node',
+    files: documents.length,
+    bytes: files.reduce((total, file) => total + fs.statSync(file).size, 0),
+    iterations,
+    seconds,
+    empty_call_us: emptyCall * 1e6,
+    errors,
+    peak_rss_kb: process.resourceUsage().maxRSS,
+  }));
+}
+
+main();
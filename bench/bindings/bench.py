@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""Parse a template corpus through the Python binding and print one JSON line.
+
+The output has the same shape as `htmldjango-bench --mode throughput --json`
+so that bench/bindings/run.py can compare it against the C harness.
+"""
+
+import argparse
+import json
+import os
+import resource
+import sys
+import time
+
+import tree_sitter_htmldjango
+from tree_sitter import Language, Parser
+
+EXTENSIONS = (".html", ".htm", ".django", ".htmldjango")
+EMPTY_PARSE_CALLS = 10000
+
+
+def load_corpus(paths):
+    files = []
+    for path in paths:
+        if os.path.isdir(path):
+            for root, dirs, names in os.walk(path):
+                dirs[:] = [d for d in dirs if not d.startswith(".")]
+                files.extend(os.path.join(root, n) for n in names
+                             if n.endswith(EXTENSIONS) and not n.startswith("."))
+        else:
+            files.append(path)
+    documents = []
+    for path in sorted(files):
+        with open(path, "rb") as f:
+            documents.append(f.read())
+    return documents
+
+
+def peak_rss_kb():
+    peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    return peak // 1024 if sys.platform == "darwin" else peak
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--iterations", type=int, default=10)
+    parser.add_argument("paths", nargs="+")
+    args = parser.parse_args()
+
+    documents = load_corpus(args.paths)
+    ts_parser = Parser(Language(tree_sitter_htmldjango.language()))
+
+    start = time.perf_counter()
+    for _ in range(EMPTY_PARSE_CALLS):
+        ts_parser.parse(b"")
+    empty_call = (time.perf_counter() - start) / EMPTY_PARSE_CALLS
+
+    errors = sum(ts_parser.parse(source).root_node.has_error for source in documents)
+    start = time.perf_counter()
+    for _ in range(max(1, args.iterations)):
+        for source in documents:
+            ts_parser.parse(source)
+    elapsed = time.perf_counter() - start
+
+    print(json.dumps({
+        "binding": "python",
+        "files": len(documents),
+        "bytes": sum(len(source) for source in documents),
+        "iterations": max(1, args.iterations),
+        "seconds": elapsed,
+        "empty_call_us": empty_call * 1e6,
+        "errors": errors,
+        "peak_rss_kb": peak_rss_kb(),
+    }))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""Compare the native block_map() against a Python tree walk.
+
+Both sides collect every {% block %} with its byte ranges, depth and parent,
+and every {{ block.super }}, and the run fails if they disagree on a file
+that parses without errors. Then every template's {% extends %} chain is
+resolved with the native maps: for each block, the template whose
+definition wins and how many {{ block.super }} calls reach up the chain.
+Deep chains come from
+
+    bench/gen_corpus.py --out /tmp/corpus-chain --files 100 --chain 50
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+import time
+
+import tree_sitter_htmldjango
+from tree_sitter import Language, Parser
+
+from bench import EXTENSIONS
+
+SUPER = re.compile(rb"block\.super(?:$|[ \t|])")
+EXTENDS = re.compile(rb"\{%[ \t]*extends[ \t]+([\"'])([^\"'\n]*)\1[ \t]*%\}")
+
+
+def walk(tree, source):
+    """Return (blocks, supers) shaped like tree_sitter_htmldjango.block_map()."""
+    blocks = []
+    supers = []
+    open_blocks = []
+    cursor = tree.walk()
+    while True:
+        node = cursor.node
+        kind = node.type
+        if kind == "django_block_block":
+            opening = node.child(0)
+            closing = node.child(node.child_count - 1)
+            name = opening.child_by_field_name("name")
+            parent = open_blocks[-1] if open_blocks else None
+            blocks.append((name.text.decode(), node.start_byte, node.end_byte, opening.end_byte,
+                           closing.start_byte, len(open_blocks), parent))
+            open_blocks.append(len(blocks) - 1)
+        elif kind == "django_interpolation" and open_blocks:
+            if SUPER.match(source[node.start_byte + 2:node.end_byte - 2].strip(b" \t")):
+                supers.append((open_blocks[-1], node.start_byte, node.end_byte))
+
+        if cursor.goto_first_child():
+            continue
+        while not cursor.goto_next_sibling():
+            if not cursor.goto_parent():
+                return blocks, supers
+            if cursor.node.type == "django_block_block":
+                open_blocks.pop()
+
+
+def native(source):
+    blocks, supers = tree_sitter_htmldjango.block_map(source)
+    return ([block[:7] for block in blocks], [tuple(usage) for usage in supers])
+
+
+def load_templates(paths):
+    """Return {template name: source}, named relative to the directory given."""
+    templates = {}
+    for path in paths:
+        if not os.path.isdir(path):
+            with open(path, "rb") as f:
+                templates[os.path.basename(path)] = f.read()
+            continue
+        for root, dirs, names in os.walk(path):
+            dirs[:] = [d for d in dirs if not d.startswith(".")]
+            for name in names:
+                if name.endswith(EXTENSIONS) and not name.startswith("."):
+                    full = os.path.join(root, name)
+                    with open(full, "rb") as f:
+                        templates[os.path.relpath(full, path).replace(os.sep, "/")] = f.read()
+    return dict(sorted(templates.items()))
+
+
+def resolve(name, templates, maps):
+    """Follow name's {% extends %} chain; return its depth and the resolved blocks.
+
+    Each block name maps to (defining template, supers reaching up from it).
+    """
+    chain = []
+    while name in templates and name not in chain:
+        chain.append(name)
+        match = EXTENDS.search(templates[name])
+        name = match.group(2).decode() if match else None
+    resolved = {}
+    for template in chain:
+        blocks, _ = maps[template]
+        for block in blocks:
+            if block.name not in resolved:
+                resolved[block.name] = [template, 0, block.super_count > 0]
+            elif resolved[block.name][2]:
+                resolved[block.name][1] += 1
+                resolved[block.name][2] = block.super_count > 0
+    return len(chain), {name: (winner, calls) for name, (winner, calls, _) in resolved.items()}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--iterations", type=int, default=10)
+    parser.add_argument("paths", nargs="+")
+    args = parser.parse_args()
+    iterations = max(1, args.iterations)
+
+    ts_parser = Parser(Language(tree_sitter_htmldjango.language()))
+    templates = load_templates(args.paths)
+    sources = list(templates.values())
+    trees = [ts_parser.parse(source) for source in sources]
+
+    mismatches = 0
+    for source, tree in zip(sources, trees):
+        if not tree.root_node.has_error and walk(tree, source) != native(source):
+            mismatches += 1
+
+    start = time.perf_counter()
+    for _ in range(iterations):
+        for source in sources:
+            walk(ts_parser.parse(source), source)
+    parse_walk_time = (time.perf_counter() - start) / iterations
+
+    start = time.perf_counter()
+    for _ in range(iterations):
+        for source, tree in zip(sources, trees):
+            walk(tree, source)
+    walk_time = (time.perf_counter() - start) / iterations
+
+    start = time.perf_counter()
+    for _ in range(iterations):
+        maps = {name: tree_sitter_htmldjango.block_map(source) for name, source in templates.items()}
+    native_time = (time.perf_counter() - start) / iterations
+
+    start = time.perf_counter()
+    resolved = [resolve(name, templates, maps) for name in templates]
+    resolve_time = time.perf_counter() - start
+
+    print(json.dumps({
+        "files": len(sources),
+        "bytes": sum(len(source) for source in sources),
+        "blocks": sum(len(blocks) for blocks, _ in maps.values()),
+        "supers": sum(len(supers) for _, supers in maps.values()),
+        "deepest_chain": max((depth for depth, _ in resolved), default=0),
+        "resolved_blocks": sum(len(blocks) for _, blocks in resolved),
+        "mismatched_files": mismatches,
+        "parse_walk_ms": parse_walk_time * 1e3,
+        "walk_ms": walk_time * 1e3,
+        "native_ms": native_time * 1e3,
+        "resolve_ms": resolve_time * 1e3,
+        "speedup_vs_walk": walk_time / native_time if native_time else None,
+        "speedup_vs_parse_walk": parse_walk_time / native_time if native_time else None,
+    }))
+    return 1 if mismatches else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
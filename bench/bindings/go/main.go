@@ -0,0 +1,137 @@
+// Command go parses a template corpus through the Go binding and prints one
+// JSON line with the same shape as `htmldjango-bench --mode throughput --json`,
+// so that bench/bindings/run.py can compare it against the C harness.
+//
+// Run with `go run ./bench/bindings/go [-iterations N] PATH...`.
+package main
+
+import (
+	"encoding/json"
+	"flag"
+	"io/fs"
+	"log"
+	"os"
+	"path/filepath"
+	"runtime"
+	"sort"
+	"strings"
+	"syscall"
+	"time"
+
+	tree_sitter "github.com/tree-sitter/go-tree-sitter"
+	tree_sitter_htmldjango "github.com/tree-sitter/tree-sitter-html/bindings/go"
+)
+
+const emptyParseCalls = 10000
+
+var extensions = map[string]bool{".html": true, ".htm": true, ".django": true, ".htmldjango": true}
+
+type result struct {
+	Binding     string  `json:"binding"`
+	Files       int     `json:"files"`
+	Bytes       int     `json:"bytes"`
+	Iterations  int     `json:"iterations"`
+	Seconds     float64 `json:"seconds"`
+	EmptyCallUs float64 `json:"empty_call_us"`
+	Errors      int     `json:"errors"`
+	PeakRssKb   int64   `json:"peak_rss_kb"`
+}
+
+func collect(root string) []string {
+	var files []string
+	err := filepath.WalkDir(root, func(path string, entry fs.DirEntry, err error) error {
+		if err != nil {
+			return err
+		}
+		if path != root && strings.HasPrefix(entry.Name(), ".") {
+			if entry.IsDir() {
+				return filepath.SkipDir
+			}
+			return nil
+		}
+		if !entry.IsDir() && (path == root || extensions[filepath.Ext(path)]) {
+			files = append(files, path)
+		}
+		return nil
+	})
+	if err != nil {
+		log.Fatal(err)
+	}
+	return files
+}
+
+func peakRssKb() int64 {
+	var usage syscall.Rusage
+	if err := syscall.Getrusage(syscall.RUSAGE_SELF, &usage); err != nil {
+		return 0
+	}
+	if runtime.GOOS == "darwin" {
+		return int64(usage.Maxrss) / 1024
+	}
+	return int64(usage.Maxrss)
+}
+
+func main() {
+	iterations := flag.Int("iterations", 10, "number of passes over the corpus")
+	flag.Parse()
+	if *iterations < 1 {
+		*iterations = 1
+	}
+
+	var files []string
+	for _, root := range flag.Args() {
+		files = append(files, collect(root)...)
+	}
+	sort.Strings(files)
+	documents := make([][]byte, len(files))
+	total := 0
+	for i, file := range files {
+		source, err := os.ReadFile(file)
+		if err != nil {
+			log.Fatal(err)
+		}
+		documents[i] = source
+		total += len(source)
+	}
+
+	parser := tree_sitter.NewParser()
+	defer parser.Close()
+	if err := parser.SetLanguage(tree_sitter.NewLanguage(tree_sitter_htmldjango.Language())); err != nil {
+		log.Fatal(err)
+	}
+
+	start := time.Now()
+	for i := 0; i < emptyParseCalls; i++ {
+		parser.Parse([]byte{}, nil).Close()
+	}
+	emptyCall := time.Since(start).Seconds() / emptyParseCalls
+
+	errors := 0
+	for _, source := range documents {
+		tree := parser.Parse(source, nil)
+		if tree.RootNode().HasError() {
+			errors++
+		}
+		tree.Close()
+	}
+
+	start = time.Now()
+	for i := 0; i < *iterations; i++ {
+		for _, source := range documents {
+			parser.Parse(source, nil).Close()
+		}
+	}
+	seconds := time.Since(start).Seconds()
+
+	out, _ := json.Marshal(result{
+		Binding:     "go",
+		Files:       len(documents),
+		Bytes:       total,
+		Iterations:  *iterations,
+		Seconds:     seconds,
+		EmptyCallUs: emptyCall * 1e6,
+		Errors:      errors,
+		PeakRssKb:   peakRssKb(),
+	})
+	os.Stdout.Write(append(out, '\n'))
+}
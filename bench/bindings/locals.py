@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""Compare locals.scm against a Python tree walk that finds the same nodes.
+
+Both sides collect scopes, definitions and references from every tree in the
+corpus; the run fails if they disagree on any node. The references left
+without a definition in an enclosing scope are the names a view has to put in
+the context, which is what an undefined-variable check reports.
+"""
+
+import argparse
+import json
+import sys
+import time
+
+import tree_sitter_htmldjango
+from tree_sitter import Language, Parser, Query
+
+try:
+    from tree_sitter import QueryCursor
+except ImportError:  # py-tree-sitter < 0.25 runs queries on the Query itself
+    QueryCursor = None
+
+from bench import load_corpus
+
+SCOPES = {"document", "django_for_block", "django_attribute_for_block", "django_with_block",
+          "django_block_block"}
+KINDS = ("scope", "definition", "reference")
+
+
+def walk(tree):
+    found = {kind: [] for kind in KINDS}
+    cursor = tree.walk()
+    ancestors = []
+    indices = []
+    index = 0
+    while True:
+        node = cursor.node
+        kind = node.type
+        parent = ancestors[-1] if ancestors else None
+        if kind in SCOPES:
+            found["scope"].append(node)
+        elif kind == "variable_name":
+            if (parent in ("loop_variables", "with_legacy")
+                    or cursor.field_name == "alias"
+                    or (parent == "assignment" and ancestors[-2] == "with_assignments")):
+                found["definition"].append(node)
+        elif (kind == "identifier" and parent == "lookup" and index == 0) or kind == "cycle_name":
+            found["reference"].append(node)
+
+        if cursor.goto_first_child():
+            ancestors.append(kind)
+            indices.append(index)
+            index = 0
+            continue
+        while not cursor.goto_next_sibling():
+            if not cursor.goto_parent():
+                return found
+            ancestors.pop()
+            index = indices.pop()
+        index += 1
+
+
+def query_runner(language, source):
+    if QueryCursor is None:
+        query = language.query(source)
+        return query.captures
+    return QueryCursor(Query(language, source)).captures
+
+
+def run_query(captures, tree):
+    result = captures(tree.root_node)
+    return {kind: result.get(f"local.{kind}", []) for kind in KINDS}
+
+
+def free_references(found, source):
+    """Return the references that no enclosing scope defines before them."""
+    events = sorted(
+        ((node.start_byte, -node.end_byte, kind, node) for kind in KINDS for node in found[kind]),
+        key=lambda event: event[:2],
+    )
+    scopes = []
+    free = 0
+    for start, _, kind, node in events:
+        while scopes and scopes[-1][0] <= start:
+            scopes.pop()
+        name = source[node.start_byte:node.end_byte]
+        if kind == "scope":
+            scopes.append((node.end_byte, set()))
+        elif kind == "definition":
+            scopes[-1][1].add(name)
+        elif not any(name in names for _, names in scopes):
+            free += 1
+    return free
+
+
+def positions(found):
+    return {kind: sorted((n.start_byte, n.end_byte) for n in found[kind]) for kind in KINDS}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--iterations", type=int, default=10)
+    parser.add_argument("paths", nargs="+")
+    args = parser.parse_args()
+    iterations = max(1, args.iterations)
+
+    language = Language(tree_sitter_htmldjango.language())
+    captures = query_runner(language, tree_sitter_htmldjango.LOCALS_QUERY)
+    ts_parser = Parser(language)
+    documents = load_corpus(args.paths)
+    trees = [ts_parser.parse(source) for source in documents]
+
+    counts = {kind: 0 for kind in KINDS}
+    free = 0
+    mismatches = 0
+    for source, tree in zip(documents, trees):
+        walked = walk(tree)
+        queried = run_query(captures, tree)
+        if positions(walked) != positions(queried):
+            mismatches += 1
+        for kind in KINDS:
+            counts[kind] += len(queried[kind])
+        free += free_references(queried, source)
+
+    start = time.perf_counter()
+    for _ in range(iterations):
+        for tree in trees:
+            walk(tree)
+    walk_time = (time.perf_counter() - start) / iterations
+
+    start = time.perf_counter()
+    for _ in range(iterations):
+        for tree in trees:
+            run_query(captures, tree)
+    query_time = (time.perf_counter() - start) / iterations
+
+    print(json.dumps({
+        "files": len(documents),
+        "bytes": sum(len(source) for source in documents),
+        "scopes": counts["scope"],
+        "definitions": counts["definition"],
+        "references": counts["reference"],
+        "free_references": free,
+        "mismatched_files": mismatches,
+        "walk_ms": walk_time * 1e3,
+        "query_ms": query_time * 1e3,
+        "speedup": walk_time / query_time if query_time else None,
+    }))
+    return 1 if mismatches else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,104 @@
+//! Parse a template corpus through the Rust binding and print one JSON line.
+//!
+//! Run with `cargo bench --bench parse -- [--iterations N] PATH...`. The output
+//! has the same shape as `htmldjango-bench --mode throughput --json` so that
+//! bench/bindings/run.py can compare it against the C harness.
+
+use std::fs;
+use std::path::{Path, PathBuf};
+use std::time::Instant;
+
+const EXTENSIONS: &[&str] = &["html", "htm", "django", "htmldjango"];
+const EMPTY_PARSE_CALLS: u32 = 10000;
+
+fn collect(path: &Path, files: &mut Vec<PathBuf>) {
+    if !path.is_dir() {
+        files.push(path.to_path_buf());
+        return;
+    }
+    for entry in fs::read_dir(path).expect("cannot read directory") {
+        let child = entry.expect("cannot read directory entry").path();
+        let hidden = child.file_name().is_some_and(|n| n.to_string_lossy().starts_with('.'));
+        if hidden {
+            continue;
+        }
+        if child.is_dir() {
+            collect(&child, files);
+        } else if child
+            .extension()
+            .is_some_and(|ext| EXTENSIONS.iter().any(|e| ext == *e))
+        {
+            files.push(child);
+        }
+    }
+}
+
+/// Peak resident set size in kilobytes, or 0 where /proc is unavailable
+fn peak_rss_kb() -> u64 {
+    fs::read_to_string("/proc/self/status")
+        .ok()
+        .and_then(|status| {
+            status
+                .lines()
+                .find(|line| line.starts_with("VmHWM:"))
+                .and_then(|line| line.split_whitespace().nth(1))
+                .and_then(|value| value.parse().ok())
+        })
+        .unwrap_or(0)
+}
+
+fn main() {
+    let mut iterations = 10u32;
+    let mut files = Vec::new();
+    let mut args = std::env::args().skip(1);
+    while let Some(arg) = args.next() {
+        match arg.as_str() {
+            "--iterations" => {
+                iterations = args.next().and_then(|n| n.parse().ok()).unwrap_or(1).max(1);
+            }
+            // Flags cargo passes to every bench target
+            "--bench" => {}
+            _ => collect(Path::new(&arg), &mut files),
+        }
+    }
+    files.sort();
+    let documents: Vec<Vec<u8>> = files
+        .iter()
+        .map(|file| fs::read(file).expect("cannot read template"))
+        .collect();
+
+    let mut parser = tree_sitter::Parser::new();
+    parser
+        .set_language(&tree_sitter_htmldjango::LANGUAGE.into())
+        .expect("Error loading HTML + Django grammar");
+
+    let start = Instant::now();
+    for _ in 0..EMPTY_PARSE_CALLS {
+        parser.parse("", None).unwrap();
+    }
+    let empty_call = start.elapsed().as_secs_f64() / f64::from(EMPTY_PARSE_CALLS);
+
+    let errors = documents
+        .iter()
+        .filter(|source| parser.parse(source, None).unwrap().root_node().has_error())
+        .count();
+    let start = Instant::now();
+    for _ in 0..iterations {
+        for source in &documents {
+            parser.parse(source, None).unwrap();
+        }
+    }
+    let seconds = start.elapsed().as_secs_f64();
+
+    println!(
+        "{{\"binding\": \"rust\", \"files\": {}, \"bytes\": {}, \"iterations\": {}, \"seconds\": {:.6}, \
+         \"empty_call_us\": {:.3}, \"errors\": {}, \"peak_rss_kb\": {}}}",
+        documents.len(),
+        documents.iter().map(Vec::len).sum::<usize>(),
+        iterations,
+        seconds,
+        empty_call * 1e6,
+        errors,
+        peak_rss_kb()
+    );
+}
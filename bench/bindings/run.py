@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""Run the same corpus through the C harness and every binding, relative to C.
+
+Each runner prints one JSON line (see `htmldjango-bench --json`). Bindings whose
+toolchain or runtime package is missing are reported and skipped, so the table
+only ever compares runs that actually happened.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+HERE = os.path.join(ROOT, "bench", "bindings")
+
+
+def commands(args):
+    return {
+        "c": [args.c_bench, "--mode", "throughput", "--json", "--iterations", str(args.iterations)],
+        "rust": ["cargo", "bench", "--quiet", "--bench", "parse", "--", "--iterations", str(args.iterations)],
+        "go": ["go", "run", "./bench/bindings/go", "-iterations", str(args.iterations)],
+        "python": [sys.executable, os.path.join(HERE, "bench.py"), "--iterations", str(args.iterations)],
+        "node": ["node", os.path.join(HERE, "bench.js"), "--iterations", str(args.iterations)],
+    }
+
+
+def run(command, paths):
+    try:
+        process = subprocess.run(command + paths, cwd=ROOT, capture_output=True, text=True)
+    except FileNotFoundError as error:
+        return None, str(error)
+    if process.returncode != 0:
+        lines = (process.stderr or process.stdout).strip().splitlines()
+        return None, lines[-1] if lines else f"exit status {process.returncode}"
+    for line in reversed(process.stdout.splitlines()):
+        if line.startswith("{"):
+            return json.loads(line), None
+    return None, "no JSON result in output"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--iterations", type=int, default=10)
+    parser.add_argument("--c-bench", default=os.path.join(ROOT, "build", "bench", "htmldjango-bench"),
+                        help="path to the htmldjango-bench executable")
+    parser.add_argument("--bindings", default="c,rust,go,python,node",
+                        help="comma separated list of runners")
+    parser.add_argument("paths", nargs="+", help="template files or directories")
+    args = parser.parse_args()
+
+    paths = [os.path.abspath(path) for path in args.paths]
+    available = commands(args)
+    results = {}
+    for name in args.bindings.split(","):
+        if name not in available:
+            parser.error(f"unknown binding '{name}'")
+        result, error = run(available[name], paths)
+        if result is None:
+            print(f"skipping {name}: {error}", file=sys.stderr)
+        else:
+            results[name] = result
+
+    if not results:
+        return 1
+
+    # Throughput is reported per pass so runs with different iteration counts line up
+    def mb_per_s(r):
+        return r["bytes"] * r["iterations"] / r["seconds"] / 1e6
+
+    base = results.get("c")
+    print(f"{'binding':<8} {'MB/s':>9} {'vs C':>7} {'empty call us':>14} {'overhead us':>12} "
+          f"{'peak RSS KB':>12} {'vs C':>7} {'errors':>7}")
+    for name, r in results.items():
+        throughput = mb_per_s(r)
+        if base:
+            speed = f"{throughput / mb_per_s(base):.2f}x"
+            overhead = f"{r['empty_call_us'] - base['empty_call_us']:.2f}"
+            memory = f"{r['peak_rss_kb'] / base['peak_rss_kb']:.2f}x" if base["peak_rss_kb"] else "-"
+        else:
+            speed = overhead = memory = "-"
+        print(f"{name:<8} {throughput:>9.2f} {speed:>7} {r['empty_call_us']:>14.2f} {overhead:>12} "
+              f"{r['peak_rss_kb']:>12} {memory:>7} {r['errors']:>7}")
+
+    # Every runner parses the same bytes; a mismatch means the corpus walk differs
+    sizes = {r["bytes"] for r in results.values()}
+    if len(sizes) > 1:
+        print("warning: runners saw different corpus sizes", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
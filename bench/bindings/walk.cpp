@@ -0,0 +1,135 @@
+// Walk a template corpus with the C++ wrapper's typed visitor and with a
+// cursor walk that compares ts_node_type() strings, and print one JSON line.
+//
+// Run with `htmldjango-walk [--iterations N] PATH...`. Both walks count the
+// same node types over the same trees, parsed once up front, and the run
+// fails if their counts differ.
+
+#include "tree-sitter-htmldjango.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr std::array<const char *, 4> EXTENSIONS = {".html", ".htm", ".django", ".htmldjango"};
+
+enum Category { IF, FOR, BLOCK, INCLUDE, INTERPOLATION, FILTER, ELEMENT, ATTRIBUTE, TEXT, CATEGORY_COUNT };
+
+using Counts = std::array<uint64_t, CATEGORY_COUNT>;
+
+void collect(const fs::path &path, std::vector<fs::path> &files) {
+    if (!fs::is_directory(path)) {
+        files.push_back(path);
+        return;
+    }
+    for (const fs::directory_entry &entry : fs::directory_iterator(path)) {
+        std::string name = entry.path().filename().string();
+        if (name.empty() || name[0] == '.') continue;
+        if (entry.is_directory()) {
+            collect(entry.path(), files);
+        } else {
+            std::string extension = entry.path().extension().string();
+            for (const char *known : EXTENSIONS) {
+                if (extension == known) files.push_back(entry.path());
+            }
+        }
+    }
+}
+
+struct Visitor {
+    Counts counts{};
+
+    void operator()(htmldjango::Kind<HTMLDJANGO_KIND_DJANGO_IF_BLOCK>, TSNode) { counts[IF]++; }
+    void operator()(htmldjango::Kind<HTMLDJANGO_KIND_DJANGO_FOR_BLOCK>, TSNode) { counts[FOR]++; }
+    void operator()(htmldjango::Kind<HTMLDJANGO_KIND_DJANGO_BLOCK_BLOCK>, TSNode) { counts[BLOCK]++; }
+    void operator()(htmldjango::Kind<HTMLDJANGO_KIND_DJANGO_INCLUDE_TAG>, TSNode) { counts[INCLUDE]++; }
+    void operator()(htmldjango::Kind<HTMLDJANGO_KIND_DJANGO_INTERPOLATION>, TSNode) { counts[INTERPOLATION]++; }
+    void operator()(htmldjango::Kind<HTMLDJANGO_KIND_FILTER_CALL>, TSNode) { counts[FILTER]++; }
+    void operator()(htmldjango::Kind<HTMLDJANGO_KIND_NORMAL_ELEMENT>, TSNode) { counts[ELEMENT]++; }
+    void operator()(htmldjango::Kind<HTMLDJANGO_KIND_ATTRIBUTE>, TSNode) { counts[ATTRIBUTE]++; }
+    void operator()(htmldjango::Kind<HTMLDJANGO_KIND_TEXT>, TSNode) { counts[TEXT]++; }
+};
+
+// What a service without kind IDs writes
+void walk_by_name(TSNode root, Counts &counts) {
+    htmldjango::TreeCursor cursor(root);
+    for (;;) {
+        const char *type = ts_node_type(cursor.node());
+        if (std::strcmp(type, "django_if_block") == 0) counts[IF]++;
+        else if (std::strcmp(type, "django_for_block") == 0) counts[FOR]++;
+        else if (std::strcmp(type, "django_block_block") == 0) counts[BLOCK]++;
+        else if (std::strcmp(type, "django_include_tag") == 0) counts[INCLUDE]++;
+        else if (std::strcmp(type, "django_interpolation") == 0) counts[INTERPOLATION]++;
+        else if (std::strcmp(type, "filter_call") == 0) counts[FILTER]++;
+        else if (std::strcmp(type, "normal_element") == 0) counts[ELEMENT]++;
+        else if (std::strcmp(type, "attribute") == 0) counts[ATTRIBUTE]++;
+        else if (std::strcmp(type, "text") == 0) counts[TEXT]++;
+        if (cursor.goto_first_child()) continue;
+        while (!cursor.goto_next_sibling()) {
+            if (!cursor.goto_parent()) return;
+        }
+    }
+}
+
+template <typename Walk> double time_walks(const std::vector<htmldjango::Tree> &trees, unsigned iterations, Walk walk) {
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < iterations; i++) {
+        for (const htmldjango::Tree &tree : trees) walk(tree.root());
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / iterations;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    unsigned iterations = 10;
+    std::vector<fs::path> files;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        } else {
+            collect(argv[i], files);
+        }
+    }
+    if (files.empty() || iterations == 0) {
+        std::fprintf(stderr, "usage: htmldjango-walk [--iterations N] PATH...\n");
+        return 2;
+    }
+
+    htmldjango::Parser parser;
+    std::vector<htmldjango::Tree> trees;
+    uint64_t nodes = 0;
+    for (const fs::path &path : files) {
+        std::ifstream stream(path, std::ios::binary);
+        std::string source((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+        trees.push_back(parser.parse(source));
+        nodes += ts_node_descendant_count(trees.back().root());
+    }
+
+    Counts by_name{};
+    Visitor visitor;
+    double name_time = time_walks(trees, iterations, [&](TSNode root) { walk_by_name(root, by_name); });
+    double visitor_time = time_walks(trees, iterations, [&](TSNode root) { htmldjango::walk(root, visitor); });
+    if (by_name != visitor.counts) {
+        std::fprintf(stderr, "htmldjango-walk: the walks counted different nodes\n");
+        return 1;
+    }
+
+    std::printf("{\"binding\": \"cpp\", \"files\": %zu, \"nodes\": %llu, \"strcmp_ms\": %.3f, \"visitor_ms\": %.3f, "
+                "\"speedup\": %.2f}\n",
+                trees.size(), static_cast<unsigned long long>(nodes), name_time * 1e3, visitor_time * 1e3,
+                name_time / visitor_time);
+    return 0;
+}
@@ -0,0 +1,132 @@
+#include "bench.h"
+#include "tree-sitter-htmldjango.h"
+
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    const char *name;
+    const TSLanguage *language;
+    const char *library;
+    double seconds;
+    uint64_t tree_bytes;
+    size_t parse_peak;
+    unsigned error_count;
+} Grammar;
+
+// One parse per document with a fresh parser, so the live-bytes delta is the
+// tree alone and the peak covers the parse stack and lookahead buffers too.
+static void measure_memory(Grammar *grammar, const Corpus *corpus) {
+    for (size_t i = 0; i < corpus->count; i++) {
+        const Document *document = &corpus->documents[i];
+        size_t before = bench_live_bytes();
+        bench_reset_peak();
+        TSParser *parser = ts_parser_new();
+        ts_parser_set_language(parser, grammar->language);
+        TSTree *tree = ts_parser_parse_string(parser, NULL, document->source, document->length);
+        size_t peak = bench_peak_bytes() - before;
+        ts_parser_delete(parser);
+        grammar->tree_bytes += bench_live_bytes() - before;
+        if (peak > grammar->parse_peak) grammar->parse_peak = peak;
+        if (ts_node_has_error(ts_tree_root_node(tree))) grammar->error_count++;
+        ts_tree_delete(tree);
+    }
+}
+
+static double time_pass(TSParser *parser, const Corpus *corpus) {
+    double start = bench_now();
+    for (size_t i = 0; i < corpus->count; i++) {
+        const Document *document = &corpus->documents[i];
+        ts_tree_delete(ts_parser_parse_string(parser, NULL, document->source, document->length));
+    }
+    return bench_now() - start;
+}
+
+static void print_row(const char *label, double baseline, double candidate, const char *format) {
+    printf("%-22s ", label);
+    printf(format, baseline);
+    printf(" ");
+    printf(format, candidate);
+    if (baseline > 0) {
+        printf(" %+9.1f%%\n", 100.0 * (candidate / baseline - 1.0));
+    } else {
+        printf(" %10s\n", "-");
+    }
+}
+
+int bench_compare(const Corpus *corpus, const BenchOptions *options) {
+    if (!options->baseline_lib) {
+        fprintf(stderr, "htmldjango-bench: compare mode needs --baseline-lib PATH\n");
+        return 2;
+    }
+    void *handle = dlopen(options->baseline_lib, RTLD_NOW | RTLD_LOCAL);
+    if (!handle) {
+        fprintf(stderr, "htmldjango-bench: %s\n", dlerror());
+        return 1;
+    }
+    const TSLanguage *(*baseline_language)(void) = NULL;
+    *(void **)&baseline_language = dlsym(handle, options->baseline_symbol);
+    if (!baseline_language) {
+        fprintf(stderr, "htmldjango-bench: %s\n", dlerror());
+        dlclose(handle);
+        return 1;
+    }
+
+    Grammar grammars[2] = {
+        {.name = options->baseline_symbol, .language = baseline_language(), .library = options->baseline_lib},
+        {.name = "tree_sitter_htmldjango", .language = tree_sitter_htmldjango(), .library = bench_library_path()},
+    };
+
+    // Passes alternate between the grammars so that frequency scaling and
+    // cache warmup affect both sides equally.
+    TSParser *parsers[2];
+    for (int g = 0; g < 2; g++) {
+        parsers[g] = ts_parser_new();
+        ts_parser_set_language(parsers[g], grammars[g].language);
+        time_pass(parsers[g], corpus);
+    }
+    for (unsigned i = 0; i < options->iterations; i++) {
+        for (int g = 0; g < 2; g++) grammars[g].seconds += time_pass(parsers[g], corpus);
+    }
+    for (int g = 0; g < 2; g++) {
+        ts_parser_delete(parsers[g]);
+        measure_memory(&grammars[g], corpus);
+    }
+
+    double bytes = (double)corpus->total_bytes * options->iterations;
+    double input_bytes = corpus->total_bytes ? (double)corpus->total_bytes : 1.0;
+    const Grammar *base = &grammars[0];
+    const Grammar *ours = &grammars[1];
+
+    printf("%zu files, %llu bytes, %u iterations\n\n", corpus->count,
+           (unsigned long long)corpus->total_bytes, options->iterations);
+    printf("%-22s %12s %12s %10s\n", "", "baseline", "htmldjango", "overhead");
+    print_row("parse states", ts_language_state_count(base->language),
+              ts_language_state_count(ours->language), "%12.0f");
+    print_row("symbols", ts_language_symbol_count(base->language),
+              ts_language_symbol_count(ours->language), "%12.0f");
+    print_row("fields", ts_language_field_count(base->language),
+              ts_language_field_count(ours->language), "%12.0f");
+    print_row("library bytes", (double)bench_file_size(base->library), (double)bench_file_size(ours->library), "%12.0f");
+    print_row("time (s)", base->seconds, ours->seconds, "%12.3f");
+    print_row("throughput (MB/s)", bytes / base->seconds / 1e6, bytes / ours->seconds / 1e6, "%12.2f");
+    print_row("tree bytes / byte", base->tree_bytes / input_bytes, ours->tree_bytes / input_bytes, "%12.2f");
+    print_row("peak parse bytes", (double)base->parse_peak, (double)ours->parse_peak, "%12.0f");
+    print_row("files with errors", base->error_count, ours->error_count, "%12.0f");
+
+    dlclose(handle);
+
+    // Overhead is measured as extra time and extra tree memory for the same input
+    double time_overhead = 100.0 * (ours->seconds / base->seconds - 1.0);
+    double memory_overhead = base->tree_bytes ? 100.0 * ((double)ours->tree_bytes / base->tree_bytes - 1.0) : 0.0;
+    if (options->max_overhead > 0 &&
+        (time_overhead > options->max_overhead || memory_overhead > options->max_overhead)) {
+        fprintf(stderr,
+                "htmldjango-bench: overhead of %.1f%% time and %.1f%% tree memory exceeds the budget of %.1f%%\n",
+                time_overhead, memory_overhead, options->max_overhead);
+        return 1;
+    }
+    return 0;
+}
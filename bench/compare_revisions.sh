@@ -0,0 +1,93 @@
+#!/usr/bin/env bash
+# Compare the generated parser at two revisions. Each revision is checked out
+# in a worktree, its parsers (the template grammar and, where it exists, the
+# expression grammar) are regenerated and must pass `tree-sitter test`, and
+# its own benchmark harness then runs the same modes over the same synthetic
+# corpora. Grammar changes report this output.
+#
+# usage: bench/compare_revisions.sh BASE [HEAD]
+#
+#   MODES     harness modes to run (default "forks throughput memory")
+#   PROFILES  bench/gen_corpus.py profiles, one corpus each (default
+#             "mixed attributes")
+#   FILES     page templates per corpus (default 200)
+#   QUERIES   query files from queries/ for the query mode (default
+#             "open-tags.scm")
+#
+# The query mode compares the two revisions' query files rather than their
+# harnesses: both run through the head harness, over the head parser's trees,
+# since BASE may predate the mode. For example, for a change to open-tags.scm:
+#
+#   MODES=query PROFILES=open-tags bench/compare_revisions.sh BASE
+#
+# Needs the tree-sitter CLI, node, and the tree-sitter library where
+# pkg-config finds it. BASE must already have the harness (bench/).
+
+set -euo pipefail
+
+if [ $# -lt 1 ] || [ $# -gt 2 ]; then
+    echo "usage: bench/compare_revisions.sh BASE [HEAD]" >&2
+    exit 2
+fi
+
+root=$(git rev-parse --show-toplevel)
+revisions=("$(git -C "$root" rev-parse --verify "$1^{commit}")"
+           "$(git -C "$root" rev-parse --verify "${2:-HEAD}^{commit}")")
+sides=(base head)
+modes=${MODES:-forks throughput memory}
+profiles=${PROFILES:-mixed attributes}
+queries=${QUERIES:-open-tags.scm}
+jobs=$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 2)
+
+work=$(mktemp -d)
+cleanup() {
+    for side in "${sides[@]}"; do
+        [ -d "$work/$side" ] && git -C "$root" worktree remove --force "$work/$side"
+    done
+    rm -rf "$work"
+}
+trap cleanup EXIT
+
+for i in 0 1; do
+    tree="$work/${sides[$i]}"
+    git -C "$root" worktree add --quiet --detach "$tree" "${revisions[$i]}"
+    echo "== ${sides[$i]}: $(git -C "$tree" log -1 --format='%h %s')"
+    (cd "$tree" && tree-sitter generate && tree-sitter test)
+    if [ -f "$tree/expression/grammar.js" ]; then
+        (cd "$tree/expression" && tree-sitter generate && tree-sitter test)
+    fi
+    cmake -S "$tree" -B "$tree/build" -DCMAKE_BUILD_TYPE=Release \
+          -DTREE_SITTER_HTMLDJANGO_BENCH=ON > /dev/null
+    cmake --build "$tree/build" -j"$jobs" > /dev/null
+done
+
+# The corpora come from this checkout's generator, so both sides parse the
+# same bytes even when BASE predates a profile
+for profile in $profiles; do
+    python3 "$root/bench/gen_corpus.py" --out "$work/corpus/$profile" \
+            --profile "$profile" --files "${FILES:-200}"
+done
+
+for profile in $profiles; do
+    for mode in $modes; do
+        if [ "$mode" = query ]; then
+            args=()
+            for query in $queries; do
+                for side in "${sides[@]}"; do
+                    [ -f "$work/$side/queries/$query" ] && args+=(--query "$work/$side/queries/$query")
+                done
+            done
+            echo
+            echo "== query, $profile corpus, base then head queries on the head parser"
+            "$work/head/build/bench/htmldjango-bench" --mode query "${args[@]}" "$work/corpus/$profile" ||
+                echo "(mode query failed)"
+            continue
+        fi
+        for side in "${sides[@]}"; do
+            echo
+            echo "== $mode, $profile corpus, $side"
+            "$work/$side/build/bench/htmldjango-bench" --mode "$mode" "$work/corpus/$profile" ||
+                echo "($side: mode $mode failed)"
+        done
+    done
+done
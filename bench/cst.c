@@ -0,0 +1,234 @@
+#include "bench.h"
+#include "tree-sitter-htmldjango.h"
+#include "tree-sitter-htmldjango-tools.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Compares the binary tree format with the text forms a tree is usually
+// shipped in: ts_node_string()'s S-expression and a JSON dump with the same
+// fields as the binary records. The trees are parsed once up front, so only
+// serialization is timed. Reading is timed as opening each buffer and
+// visiting every node through first_child/next_sibling, next to the same
+// walk over the TSTree with a cursor.
+
+typedef struct {
+    char *data;
+    size_t length;
+    size_t capacity;
+} Text;
+
+static void text_append(Text *text, const char *data, size_t length) {
+    if (text->length + length > text->capacity) {
+        size_t capacity = text->capacity ? text->capacity : 4096;
+        while (capacity < text->length + length) capacity *= 2;
+        char *grown = realloc(text->data, capacity);
+        if (!grown) abort();
+        text->data = grown;
+        text->capacity = capacity;
+    }
+    memcpy(text->data + text->length, data, length);
+    text->length += length;
+}
+
+static void json_string(Text *text, const char *value) {
+    text_append(text, "\"", 1);
+    for (const char *p = value; *p; p++) {
+        char escaped[8];
+        if (*p == '"' || *p == '\\') {
+            escaped[0] = '\\';
+            escaped[1] = *p;
+            text_append(text, escaped, 2);
+        } else if ((unsigned char)*p < 0x20) {
+            text_append(text, escaped, (size_t)snprintf(escaped, sizeof(escaped), "\\u%04x", *p));
+        } else {
+            text_append(text, p, 1);
+        }
+    }
+    text_append(text, "\"", 1);
+}
+
+static void write_json(const TSTree *tree, Text *text) {
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+    text->length = 0;
+    for (;;) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        const char *field = ts_tree_cursor_current_field_name(&cursor);
+        char numbers[96];
+        text_append(text, "{\"type\":", 8);
+        json_string(text, ts_node_type(node));
+        if (field) {
+            text_append(text, ",\"field\":", 9);
+            json_string(text, field);
+        }
+        text_append(text, numbers,
+                    (size_t)snprintf(numbers, sizeof(numbers), ",\"named\":%s,\"start\":%u,\"end\":%u",
+                                     ts_node_is_named(node) ? "true" : "false", ts_node_start_byte(node),
+                                     ts_node_end_byte(node)));
+        if (ts_tree_cursor_goto_first_child(&cursor)) {
+            text_append(text, ",\"children\":[", 13);
+            continue;
+        }
+        text_append(text, "}", 1);
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                ts_tree_cursor_delete(&cursor);
+                return;
+            }
+            text_append(text, "]}", 2);
+        }
+        text_append(text, ",", 1);
+    }
+}
+
+static uint64_t walk_cst(const HTMLDjangoCST *cst) {
+    uint64_t sum = 0;
+    uint32_t index = 0;
+    for (;;) {
+        sum += htmldjango_cst_node(cst, index).kind;
+        uint32_t child = htmldjango_cst_first_child(cst, index);
+        if (child != HTMLDJANGO_CST_NO_NODE) {
+            index = child;
+            continue;
+        }
+        uint32_t sibling;
+        while ((sibling = htmldjango_cst_next_sibling(cst, index)) == HTMLDJANGO_CST_NO_NODE) {
+            index = htmldjango_cst_node(cst, index).parent;
+            if (index == HTMLDJANGO_CST_NO_NODE) return sum;
+        }
+        index = sibling;
+    }
+}
+
+static uint64_t walk_tree(const TSTree *tree) {
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+    uint64_t sum = 0;
+    for (;;) {
+        sum += ts_node_symbol(ts_tree_cursor_current_node(&cursor));
+        if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                ts_tree_cursor_delete(&cursor);
+                return sum;
+            }
+        }
+    }
+}
+
+int bench_cst(const Corpus *corpus, const BenchOptions *options) {
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, tree_sitter_htmldjango());
+    TSTree **trees = calloc(corpus->count, sizeof(TSTree *));
+    HTMLDjangoCSTBuffer *buffers = calloc(corpus->count, sizeof(HTMLDjangoCSTBuffer));
+    if (!trees || !buffers) {
+        fprintf(stderr, "htmldjango-bench: out of memory\n");
+        return 1;
+    }
+    uint64_t node_count = 0;
+    for (size_t i = 0; i < corpus->count; i++) {
+        const Document *document = &corpus->documents[i];
+        trees[i] = ts_parser_parse_string(parser, NULL, document->source, document->length);
+        node_count += ts_node_descendant_count(ts_tree_root_node(trees[i]));
+    }
+    ts_parser_delete(parser);
+
+    int status = 0;
+    uint64_t binary_bytes = 0;
+    double start = bench_now();
+    for (unsigned i = 0; i < options->iterations && status == 0; i++) {
+        binary_bytes = 0;
+        for (size_t j = 0; j < corpus->count; j++) {
+            status = htmldjango_cst_write(trees[j], &buffers[j]);
+            if (status != 0) {
+                fprintf(stderr, "htmldjango-bench: %s: %s\n", corpus->documents[j].path, strerror(status));
+                break;
+            }
+            binary_bytes += buffers[j].length;
+        }
+    }
+    double binary_time = (bench_now() - start) / options->iterations;
+
+    Text json = {0};
+    uint64_t json_bytes = 0;
+    start = bench_now();
+    for (unsigned i = 0; i < options->iterations && status == 0; i++) {
+        json_bytes = 0;
+        for (size_t j = 0; j < corpus->count; j++) {
+            write_json(trees[j], &json);
+            json_bytes += json.length;
+        }
+    }
+    double json_time = (bench_now() - start) / options->iterations;
+    free(json.data);
+
+    uint64_t sexp_bytes = 0;
+    start = bench_now();
+    for (unsigned i = 0; i < options->iterations && status == 0; i++) {
+        sexp_bytes = 0;
+        for (size_t j = 0; j < corpus->count; j++) {
+            char *sexp = ts_node_string(ts_tree_root_node(trees[j]));
+            sexp_bytes += strlen(sexp);
+            free(sexp);
+        }
+    }
+    double sexp_time = (bench_now() - start) / options->iterations;
+
+    uint64_t binary_sum = 0;
+    start = bench_now();
+    for (unsigned i = 0; i < options->iterations && status == 0; i++) {
+        binary_sum = 0;
+        for (size_t j = 0; j < corpus->count; j++) {
+            HTMLDjangoCST cst;
+            if (!htmldjango_cst_open(&cst, buffers[j].data, buffers[j].length)) {
+                fprintf(stderr, "htmldjango-bench: %s: written tree does not open\n", corpus->documents[j].path);
+                status = 1;
+                break;
+            }
+            binary_sum += walk_cst(&cst);
+        }
+    }
+    double read_time = (bench_now() - start) / options->iterations;
+
+    uint64_t tree_sum = 0;
+    start = bench_now();
+    for (unsigned i = 0; i < options->iterations && status == 0; i++) {
+        tree_sum = 0;
+        for (size_t j = 0; j < corpus->count; j++) tree_sum += walk_tree(trees[j]);
+    }
+    double tree_time = (bench_now() - start) / options->iterations;
+
+    for (size_t i = 0; i < corpus->count; i++) {
+        ts_tree_delete(trees[i]);
+        htmldjango_cst_buffer_delete(&buffers[i]);
+    }
+    free(trees);
+    free(buffers);
+    if (status != 0) return status;
+    // Both sums only keep the walks from being optimized away; kind and
+    // symbol IDs differ, so they are not compared
+    (void)binary_sum;
+    (void)tree_sum;
+
+    if (options->json) {
+        printf("{\"files\": %zu, \"bytes\": %llu, \"nodes\": %llu, \"binary_bytes\": %llu, \"binary_ms\": %.3f, "
+               "\"json_bytes\": %llu, \"json_ms\": %.3f, \"sexp_bytes\": %llu, \"sexp_ms\": %.3f, "
+               "\"binary_read_ms\": %.3f, \"tree_walk_ms\": %.3f}\n",
+               corpus->count, (unsigned long long)corpus->total_bytes, (unsigned long long)node_count,
+               (unsigned long long)binary_bytes, binary_time * 1e3, (unsigned long long)json_bytes, json_time * 1e3,
+               (unsigned long long)sexp_bytes, sexp_time * 1e3, read_time * 1e3, tree_time * 1e3);
+        return 0;
+    }
+
+    printf("files:          %zu (%llu bytes, %llu nodes)\n", corpus->count, (unsigned long long)corpus->total_bytes,
+           (unsigned long long)node_count);
+    printf("binary:         %.3f ms per pass, %llu bytes (%.2fx source)\n", binary_time * 1e3,
+           (unsigned long long)binary_bytes, (double)binary_bytes / (double)corpus->total_bytes);
+    printf("json:           %.3f ms per pass, %llu bytes (%.2fx source)\n", json_time * 1e3,
+           (unsigned long long)json_bytes, (double)json_bytes / (double)corpus->total_bytes);
+    printf("s-expression:   %.3f ms per pass, %llu bytes (%.2fx source)\n", sexp_time * 1e3,
+           (unsigned long long)sexp_bytes, (double)sexp_bytes / (double)corpus->total_bytes);
+    printf("binary read:    %.3f ms per pass (open and visit every node)\n", read_time * 1e3);
+    printf("tree walk:      %.3f ms per pass (cursor over the TSTree)\n", tree_time * 1e3);
+    return 0;
+}
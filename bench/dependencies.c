@@ -0,0 +1,95 @@
+#include "bench.h"
+#include "tree-sitter-htmldjango.h"
+#include "tree-sitter-htmldjango-tools.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// Times htmldjango_extract_dependencies() against the parse-then-query way of
+// finding the same tags. The record counts can differ slightly: the query
+// captures every name in "{% load a b from lib %}" where the extractor only
+// reports lib, and the grammar hides tags inside HTML comments, which Django
+// (and the extractor) still sees.
+
+static const char DEPENDENCY_QUERY[] =
+    "(django_extends_tag template: (string) @extends)\n"
+    "(django_include_tag template: (string) @include)\n"
+    "(django_load_tag (library_name) @load)\n"
+    "(django_partial_tag name: (partial_name) @partial)\n";
+
+static bool count_dependency(void *payload, const HTMLDjangoDependency *dependency) {
+    (void)dependency;
+    (*(uint64_t *)payload)++;
+    return true;
+}
+
+static uint64_t parse_and_query(TSParser *parser, TSQueryCursor *cursor, const TSQuery *query,
+                                const Document *document) {
+    uint64_t records = 0;
+    TSTree *tree = ts_parser_parse_string(parser, NULL, document->source, document->length);
+    TSQueryMatch match;
+    ts_query_cursor_exec(cursor, query, ts_tree_root_node(tree));
+    while (ts_query_cursor_next_match(cursor, &match)) records += match.capture_count;
+    ts_tree_delete(tree);
+    return records;
+}
+
+int bench_dependencies(const Corpus *corpus, const BenchOptions *options) {
+    const TSLanguage *language = tree_sitter_htmldjango();
+    uint32_t error_offset;
+    TSQueryError error_type;
+    TSQuery *query = ts_query_new(language, DEPENDENCY_QUERY, (uint32_t)strlen(DEPENDENCY_QUERY),
+                                  &error_offset, &error_type);
+    if (!query) {
+        fprintf(stderr, "htmldjango-bench: dependency query error %d at byte %u\n", (int)error_type, error_offset);
+        return 1;
+    }
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, language);
+    TSQueryCursor *cursor = ts_query_cursor_new();
+
+    uint64_t extracted = 0;
+    double start = bench_now();
+    for (unsigned i = 0; i < options->iterations; i++) {
+        uint64_t records = 0;
+        for (size_t j = 0; j < corpus->count; j++) {
+            const Document *document = &corpus->documents[j];
+            htmldjango_extract_dependencies(document->source, document->length, count_dependency, &records);
+        }
+        extracted = records;
+    }
+    double extract_time = (bench_now() - start) / options->iterations;
+
+    uint64_t queried = 0;
+    start = bench_now();
+    for (unsigned i = 0; i < options->iterations; i++) {
+        uint64_t records = 0;
+        for (size_t j = 0; j < corpus->count; j++) {
+            records += parse_and_query(parser, cursor, query, &corpus->documents[j]);
+        }
+        queried = records;
+    }
+    double query_time = (bench_now() - start) / options->iterations;
+
+    ts_query_cursor_delete(cursor);
+    ts_parser_delete(parser);
+    ts_query_delete(query);
+
+    double megabytes = (double)corpus->total_bytes / 1e6;
+    if (options->json) {
+        printf("{\"files\": %zu, \"bytes\": %llu, \"extract_ms\": %.3f, \"extract_records\": %llu, "
+               "\"parse_query_ms\": %.3f, \"parse_query_records\": %llu, \"speedup\": %.1f}\n",
+               corpus->count, (unsigned long long)corpus->total_bytes, extract_time * 1e3,
+               (unsigned long long)extracted, query_time * 1e3, (unsigned long long)queried,
+               query_time / extract_time);
+        return 0;
+    }
+
+    printf("files:          %zu (%llu bytes)\n", corpus->count, (unsigned long long)corpus->total_bytes);
+    printf("extractor:      %.3f ms per pass, %.2f MB/s, %llu records\n", extract_time * 1e3,
+           megabytes / extract_time, (unsigned long long)extracted);
+    printf("parse + query:  %.3f ms per pass, %.2f MB/s, %llu records\n", query_time * 1e3,
+           megabytes / query_time, (unsigned long long)queried);
+    printf("speedup:        %.1fx\n", query_time / extract_time);
+    return 0;
+}
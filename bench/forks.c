@@ -0,0 +1,206 @@
+#include "bench.h"
+#include "tree-sitter-htmldjango.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// A parse table entry with more than one action is where the GLR parser
+// splits a stack version. The runtime logs each action it takes, so a
+// "process version" step that logs several actions is a fork, and the
+// reduced symbols name the conflict from grammar.js that caused it.
+
+#define MAX_ACTIONS 8
+#define KEY_SIZE 256
+
+typedef struct {
+    char key[KEY_SIZE];
+    uint64_t forks;
+    uint32_t files;
+    uint32_t last_file;
+    uint32_t max_versions;
+} ConflictStats;
+
+typedef struct {
+    ConflictStats *conflicts;
+    size_t conflict_count;
+    size_t conflict_capacity;
+
+    // The step currently being logged
+    char lookahead[64];
+    char actions[MAX_ACTIONS][96];
+    unsigned action_count;
+    unsigned version_count;
+
+    // Per-file counters, folded into the totals after each parse
+    uint32_t file_index;
+    uint64_t steps;
+    uint64_t glr_steps;
+    uint64_t forks;
+    uint64_t condenses;
+    uint64_t merges;
+    unsigned max_versions;
+} ForkLog;
+
+static int compare_strings(const void *a, const void *b) {
+    return strcmp((const char *)a, (const char *)b);
+}
+
+static ConflictStats *find_conflict(ForkLog *log, const char *key) {
+    for (size_t i = 0; i < log->conflict_count; i++) {
+        if (strcmp(log->conflicts[i].key, key) == 0) return &log->conflicts[i];
+    }
+    if (log->conflict_count == log->conflict_capacity) {
+        log->conflict_capacity = log->conflict_capacity ? log->conflict_capacity * 2 : 32;
+        log->conflicts = realloc(log->conflicts, log->conflict_capacity * sizeof(ConflictStats));
+    }
+    ConflictStats *entry = &log->conflicts[log->conflict_count++];
+    memset(entry, 0, sizeof(*entry));
+    snprintf(entry->key, KEY_SIZE, "%s", key);
+    entry->last_file = UINT32_MAX;
+    return entry;
+}
+
+// Closes the step being logged. Actions are sorted so that the same conflict
+// reached in a different order is counted under one key.
+static void flush_step(ForkLog *log) {
+    if (log->action_count > 1) {
+        qsort(log->actions, log->action_count, sizeof(log->actions[0]), compare_strings);
+        char key[KEY_SIZE];
+        int length = snprintf(key, KEY_SIZE, "%s:", log->lookahead);
+        for (unsigned i = 0; i < log->action_count && length < KEY_SIZE; i++) {
+            length += snprintf(key + length, KEY_SIZE - length, " %s%s", i ? "| " : "", log->actions[i]);
+        }
+        ConflictStats *entry = find_conflict(log, key);
+        entry->forks++;
+        if (entry->last_file != log->file_index) {
+            entry->last_file = log->file_index;
+            entry->files++;
+        }
+        if (log->version_count > entry->max_versions) entry->max_versions = log->version_count;
+        log->forks++;
+    }
+    log->action_count = 0;
+}
+
+static void add_action(ForkLog *log, const char *action) {
+    if (log->action_count < MAX_ACTIONS) {
+        snprintf(log->actions[log->action_count++], sizeof(log->actions[0]), "%s", action);
+    }
+}
+
+// Copies the value following `field` up to the next comma
+static void read_field(const char *message, const char *field, char *value, size_t size) {
+    const char *start = strstr(message, field);
+    value[0] = '\0';
+    if (!start) return;
+    start += strlen(field);
+    size_t length = strcspn(start, ",");
+    if (length >= size) length = size - 1;
+    memcpy(value, start, length);
+    value[length] = '\0';
+}
+
+static void on_log(void *payload, TSLogType type, const char *message) {
+    ForkLog *log = payload;
+    if (type != TSLogTypeParse) return;
+
+    if (strncmp(message, "process version:", 16) == 0) {
+        flush_step(log);
+        char count[16];
+        read_field(message, "version_count:", count, sizeof(count));
+        log->version_count = (unsigned)strtoul(count, NULL, 10);
+        if (log->version_count > log->max_versions) log->max_versions = log->version_count;
+        log->steps++;
+        if (log->version_count > 1) log->glr_steps++;
+    } else if (strstr(message, "_lookahead sym:")) {
+        read_field(message, "sym:", log->lookahead, sizeof(log->lookahead));
+    } else if (strncmp(message, "reduce sym:", 11) == 0) {
+        char symbol[80];
+        char action[96];
+        read_field(message, "sym:", symbol, sizeof(symbol));
+        snprintf(action, sizeof(action), "reduce %s", symbol);
+        add_action(log, action);
+    } else if (strncmp(message, "shift state:", 12) == 0) {
+        add_action(log, "shift");
+    } else if (strncmp(message, "condense", 8) == 0) {
+        flush_step(log);
+        log->condenses++;
+    } else if (strncmp(message, "select_", 7) == 0) {
+        log->merges++;
+    }
+}
+
+static int compare_by_forks(const void *a, const void *b) {
+    const ConflictStats *left = a;
+    const ConflictStats *right = b;
+    if (left->forks != right->forks) return left->forks < right->forks ? 1 : -1;
+    return strcmp(left->key, right->key);
+}
+
+int bench_forks(const Corpus *corpus, const BenchOptions *options) {
+    ForkLog log = {0};
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, tree_sitter_htmldjango());
+    ts_parser_set_logger(parser, (TSLogger){.payload = &log, .log = on_log});
+
+    uint64_t steps = 0, glr_steps = 0, forks = 0, condenses = 0, merges = 0;
+    unsigned max_versions = 0;
+    size_t forking_files = 0;
+
+    printf("%-40s %10s %9s %9s %8s %9s\n", "file", "bytes", "steps", "glr steps", "forks", "versions");
+    for (size_t i = 0; i < corpus->count; i++) {
+        const Document *document = &corpus->documents[i];
+        log.file_index = (uint32_t)i;
+        log.steps = log.glr_steps = log.forks = log.condenses = log.merges = 0;
+        log.max_versions = 0;
+        log.action_count = 0;
+
+        ts_tree_delete(ts_parser_parse_string(parser, NULL, document->source, document->length));
+        flush_step(&log);
+
+        if (log.forks > 0) {
+            forking_files++;
+            printf("%-40s %10u %9llu %9llu %8llu %9u\n",
+                   document->path,
+                   document->length,
+                   (unsigned long long)log.steps,
+                   (unsigned long long)log.glr_steps,
+                   (unsigned long long)log.forks,
+                   log.max_versions);
+        }
+        steps += log.steps;
+        glr_steps += log.glr_steps;
+        forks += log.forks;
+        condenses += log.condenses;
+        merges += log.merges;
+        if (log.max_versions > max_versions) max_versions = log.max_versions;
+    }
+    ts_parser_delete(parser);
+
+    double kilobytes = corpus->total_bytes ? (double)corpus->total_bytes / 1024.0 : 1.0;
+    double forks_per_kb = (double)forks / kilobytes;
+    printf("\n%zu of %zu files fork\n", forking_files, corpus->count);
+    printf("parse steps:       %llu (%.2f%% with more than one stack version)\n",
+           (unsigned long long)steps, steps ? 100.0 * (double)glr_steps / (double)steps : 0.0);
+    printf("forks:             %llu (%.3f per KB)\n", (unsigned long long)forks, forks_per_kb);
+    printf("max live versions: %u\n", max_versions);
+    printf("condenses:         %llu, merges: %llu\n", (unsigned long long)condenses, (unsigned long long)merges);
+
+    qsort(log.conflicts, log.conflict_count, sizeof(ConflictStats), compare_by_forks);
+    printf("\nconflicts by forks (lookahead: actions)\n");
+    printf("%10s %7s %9s  %s\n", "forks", "files", "versions", "conflict");
+    for (size_t i = 0; i < log.conflict_count && i < options->top; i++) {
+        const ConflictStats *entry = &log.conflicts[i];
+        printf("%10llu %7u %9u  %s\n",
+               (unsigned long long)entry->forks, entry->files, entry->max_versions, entry->key);
+    }
+    free(log.conflicts);
+
+    if (options->budget > 0 && forks_per_kb > options->budget) {
+        fprintf(stderr, "htmldjango-bench: %.3f forks per KB exceeds the budget of %.3f\n",
+                forks_per_kb, options->budget);
+        return 1;
+    }
+    return 0;
+}
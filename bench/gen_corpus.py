@@ -0,0 +1,368 @@
+#!/usr/bin/env python3
+"""Generate a deterministic synthetic Django template project for benchmarks.
+
+The output mimics a typical Django site: a base layout, pages that extend it,
+and partials pulled in with {% include %}. Every run with the same arguments
+produces byte-identical files, so results from different bindings and
+different commits can be compared directly.
+"""
+
+import argparse
+import os
+import random
+
+WORDS = (
+    "account active admin archive article author billing cart category "
+    "checkout comment dashboard detail draft editor feature filter gallery "
+    "invoice item label member message order owner page payment post "
+    "product profile report review search section setting status summary "
+    "tag team ticket title total upload user value widget"
+).split()
+
+FILTERS = ["title", "lower", "upper", "length", "date:\"Y-m-d\"", "default:\"-\"",
+           "truncatechars:40", "floatformat:2", "safe", "linebreaksbr", "urlencode"]
+
+TAGS = ["div", "section", "article", "aside", "ul", "p", "span", "header", "footer", "nav"]
+
+
+class Writer:
+    def __init__(self, rng):
+        self.rng = rng
+        self.lines = []
+        self.depth = 0
+
+    def line(self, text):
+        self.lines.append("  " * self.depth + text)
+
+    def text(self):
+        return "\n".join(self.lines) + "\n"
+
+    def word(self):
+        return self.rng.choice(WORDS)
+
+    def var(self, parts=None):
+        parts = parts or self.rng.randint(1, 3)
+        return ".".join(self.word() for _ in range(parts))
+
+    def expr(self):
+        value = self.var()
+        for _ in range(self.rng.randint(0, 2)):
+            value += "|" + self.rng.choice(FILTERS)
+        return value
+
+    def sentence(self, words=None):
+        words = words or self.rng.randint(4, 16)
+        return " ".join(self.word() for _ in range(words)).capitalize() + "."
+
+
+def section_text(w):
+    w.line(f"<p class=\"lead\">{w.sentence()} {{{{ {w.expr()} }}}} {w.sentence()}</p>")
+    w.line(f"<p>{w.sentence(30)} &amp; {w.sentence()}</p>")
+
+
+def section_loop(w):
+    w.line(f"<ul class=\"{w.word()}-list\">")
+    w.depth += 1
+    w.line(f"{{% for {w.word()} in {w.var()} %}}")
+    w.depth += 1
+    w.line(f"<li id=\"item-{{{{ forloop.counter }}}}\" class=\"{w.word()}\">")
+    w.line(f"  <a href=\"{{% url '{w.word()}-detail' pk={w.var(2)} %}}\">{{{{ {w.expr()} }}}}</a>")
+    w.line("</li>")
+    w.depth -= 1
+    w.line("{% empty %}")
+    w.line(f"  <li>{w.sentence()}</li>")
+    w.line("{% endfor %}")
+    w.depth -= 1
+    w.line("</ul>")
+
+
+def section_condition(w):
+    w.line(f"{{% if {w.var()} and not {w.var()} %}}")
+    w.line(f"  <div class=\"alert alert-{w.word()}\">{{{{ {w.expr()} }}}}</div>")
+    w.line(f"{{% elif {w.var()} == \"{w.word()}\" %}}")
+    w.line(f"  <span>{w.sentence()}</span>")
+    w.line("{% else %}")
+    w.line(f"  <p>{w.sentence()}</p>")
+    w.line("{% endif %}")
+
+
+def section_attributes(w):
+    tag = w.rng.choice(TAGS)
+    w.line(f"<{tag} class=\"card {{% if {w.var()} %}}card-active{{% endif %}}\" "
+           f"data-id=\"{{{{ {w.var()} }}}}\" {{% if {w.var()} %}}hidden{{% endif %}}>")
+    w.line(f"  <input type=\"text\" name=\"{w.word()}\" value=\"{{{{ {w.expr()} }}}}\" "
+           f"{{% if {w.var()} %}}disabled{{% endif %}}>")
+    w.line(f"</{tag}>")
+
+
+def section_table(w):
+    w.line("<table>")
+    w.line(f"  <thead><tr><th>{w.word()}</th><th>{w.word()}</th><th>{w.word()}</th></tr></thead>")
+    w.line("  <tbody>")
+    w.line(f"  {{% for row in {w.var()} %}}")
+    w.line(f"    <tr class=\"{{% cycle 'odd' 'even' %}}\">"
+           f"<td>{{{{ row.{w.word()} }}}}</td><td>{{{{ row.{w.word()}|{w.rng.choice(FILTERS)} }}}}</td>"
+           f"<td>{w.sentence(3)}</td></tr>")
+    w.line("  {% endfor %}")
+    w.line("  </tbody>")
+    w.line("</table>")
+
+
+def section_form(w):
+    w.line(f"<form method=\"post\" action=\"{{% url '{w.word()}' %}}\">")
+    w.line("  {% csrf_token %}")
+    w.line(f"  {{% with {w.word()}={w.var()} %}}")
+    w.line(f"  <label for=\"id_{w.word()}\">{w.sentence(3)}</label>")
+    w.line(f"  <textarea name=\"{w.word()}\">{{{{ {w.expr()} }}}}</textarea>")
+    w.line("  {% endwith %}")
+    w.line("  <button type=\"submit\">Save</button>")
+    w.line("</form>")
+
+
+def section_script(w):
+    w.line("<script>")
+    w.line(f"  const {w.word()} = {{{{ {w.var()}|safe }}}};")
+    w.line(f"  document.querySelectorAll('.{w.word()}').forEach((el) => {{ el.dataset.ready = true; }});")
+    w.line("</script>")
+
+
+def section_comment(w):
+    w.line(f"{{# {w.sentence()} #}}")
+    w.line(f"<!-- {w.sentence()} -->")
+
+
+def section_attribute_toggles(w):
+    tag = w.rng.choice(TAGS)
+    w.line(f"<{tag} class=\"{w.word()}\" {{% if {w.var()} %}}hidden{{% elif {w.var()} %}}aria-busy=\"true\""
+           f"{{% else %}}data-{w.word()}=\"{{{{ {w.var()} }}}}\"{{% endif %}} id=\"{w.word()}\">")
+    w.line(f"  <button type=\"button\" {{% if {w.var()} %}}disabled{{% endif %}} "
+           f"{{% if {w.var()} %}}{{% if {w.var()} %}}autofocus{{% endif %}}{{% endif %}}>{w.word()}</button>")
+    w.line(f"</{tag}>")
+
+
+def section_attribute_loop(w):
+    w.line(f"<input type=\"checkbox\" {{% for {w.word()} in {w.var()} %}}"
+           f"{{% if forloop.first %}}checked{{% endif %}}{{% empty %}}disabled{{% endfor %}}>")
+    w.line(f"<option value=\"{w.word()}\" {{% if {w.var()} == \"{w.word()}\" %}}selected{{% endif %}}>{w.word()}</option>")
+
+
+def section_attribute_values(w):
+    alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+    data = "".join(w.rng.choice(alphabet) for _ in range(w.rng.randint(1024, 4096)))
+    path = " ".join(f"L{w.rng.randint(0, 400)} {w.rng.randint(0, 400)}" for _ in range(w.rng.randint(50, 200)))
+    w.line(f"<img alt=\"{w.word()}\" src=\"data:image/png;base64,{data}\">")
+    w.line(f"<svg viewBox=\"0 0 400 400\"><path d=\"M0 0 {path} Z\" fill=\"{{{{ {w.var()} }}}}\"/></svg>")
+    w.line(f"<div x-data=\"{{ open: false, {w.word()}: {w.rng.randint(0, 99)} }}\" "
+           f"x-show=\"open && {w.word()} > 0\" hx-get=\"/{w.word()}/?page={{{{ {w.var()} }}}}&amp;sort={w.word()}\">")
+    w.line("</div>")
+
+
+def section_open_tags(w):
+    # The shapes in demo-open-tags.html, repeated and nested deeper
+    w.line(f"<div class=\"{w.word()}\">")
+    for _ in range(w.rng.randint(2, 6)):
+        w.line(f"  <p>{w.sentence(4)}")
+        w.line(f"  <span>{w.word()}</span>")
+        w.line(f"  <{w.word()}-{w.word()}>")
+    w.line("</div>")
+    depth = w.rng.randint(5, 30)
+    w.line("<section>" + "".join(f"<article>{w.sentence(3)} " for _ in range(depth)) + "</section>")
+    w.line(f"<ul class=\"{w.word()}\">")
+    for _ in range(w.rng.randint(3, 8)):
+        w.line(f"  <li><a href=\"{{{{ {w.var()} }}}}\">{w.word()}</a>")
+    w.line("</ul>")
+
+
+def section_html_text(w):
+    w.line(f"<p class=\"lead\">{w.sentence()} <em>{w.word()}</em> {w.sentence()}</p>")
+    w.line(f"<p>{w.sentence(30)} &amp; {w.sentence()}</p>")
+
+
+def section_html_list(w):
+    w.line(f"<ul class=\"{w.word()}-list\">")
+    for i in range(w.rng.randint(3, 8)):
+        w.line(f"  <li id=\"item-{i}\" class=\"{w.word()}\"><a href=\"/{w.word()}/{i}/\">{w.sentence(3)}</a></li>")
+    w.line("</ul>")
+
+
+def section_html_table(w):
+    w.line("<table>")
+    w.line(f"  <thead><tr><th>{w.word()}</th><th>{w.word()}</th><th>{w.word()}</th></tr></thead>")
+    w.line("  <tbody>")
+    for i in range(w.rng.randint(3, 8)):
+        w.line(f"    <tr class=\"{('odd', 'even')[i % 2]}\"><td>{w.word()}</td><td>{w.rng.randint(0, 9999)}</td>"
+               f"<td>{w.sentence(3)}</td></tr>")
+    w.line("  </tbody>")
+    w.line("</table>")
+
+
+def section_html_form(w):
+    w.line(f"<form method=\"post\" action=\"/{w.word()}/\">")
+    w.line(f"  <label for=\"id_{w.word()}\">{w.sentence(3)}</label>")
+    w.line(f"  <input type=\"text\" name=\"{w.word()}\" value=\"{w.word()}\" required>")
+    w.line(f"  <textarea name=\"{w.word()}\">{w.sentence()}</textarea>")
+    w.line("  <button type=\"submit\">Save</button>")
+    w.line("</form>")
+
+
+def section_html_script(w):
+    w.line("<script>")
+    w.line(f"  const {w.word()} = {{ {w.word()}: {w.rng.randint(0, 99)} }};")
+    w.line(f"  document.querySelectorAll('.{w.word()}').forEach((el) => {{ el.dataset.ready = true; }});")
+    w.line("</script>")
+
+
+def section_html_comment(w):
+    w.line(f"<!-- {w.sentence()} -->")
+
+
+PROFILES = {
+    "mixed": [section_text, section_loop, section_condition, section_attributes,
+              section_table, section_form, section_script, section_comment],
+    # Django blocks inside start tags (the case the attribute-context rules handle)
+    # and long quoted values: data URIs, SVG paths and Alpine/HTMX expressions
+    "attributes": [section_attributes, section_attribute_toggles, section_attribute_loop,
+                   section_attribute_values, section_text],
+    # Elements without end tags, for timing queries/open-tags.scm
+    "open-tags": [section_open_tags, section_text],
+    # No Django syntax at all, for comparing against tree-sitter-html
+    "html": [section_html_text, section_html_list, section_html_table,
+             section_html_form, section_html_script, section_html_comment],
+}
+
+# Profiles whose pages are standalone documents rather than extending base.html
+STANDALONE_PROFILES = {"html"}
+
+
+def base_template(rng):
+    w = Writer(rng)
+    w.line("<!DOCTYPE html>")
+    w.line("{% load static i18n %}")
+    w.line("<html lang=\"en\">")
+    w.line("<head>")
+    w.line("  <meta charset=\"utf-8\">")
+    w.line("  <title>{% block title %}Site{% endblock %}</title>")
+    w.line("  <link rel=\"stylesheet\" href=\"{% static 'css/site.css' %}\">")
+    w.line("</head>")
+    w.line("<body class=\"{% block body_class %}{% endblock %}\">")
+    w.line("  {% include \"partials/nav.html\" %}")
+    w.line("  <main>{% block content %}{% endblock %}</main>")
+    w.line("  {% include \"partials/footer.html\" %}")
+    w.line("</body>")
+    w.line("</html>")
+    return w.text()
+
+
+def page_template(rng, profile, sections, partials):
+    w = Writer(rng)
+    w.line("{% extends \"base.html\" %}")
+    w.line("{% load i18n %}")
+    w.line(f"{{% block title %}}{w.sentence(3)}{{% endblock %}}")
+    w.line("{% block content %}")
+    w.depth += 1
+    for _ in range(rng.randint(sections // 2 + 1, sections)):
+        rng.choice(PROFILES[profile])(w)
+        if partials and rng.random() < 0.1:
+            w.line(f"{{% include \"{rng.choice(partials)}\" with {w.word()}={w.var()} %}}")
+    w.depth -= 1
+    w.line("{% endblock %}")
+    return w.text()
+
+
+def html_page_template(rng, profile, sections):
+    w = Writer(rng)
+    w.line("<!DOCTYPE html>")
+    w.line("<html lang=\"en\">")
+    w.line("<head>")
+    w.line("  <meta charset=\"utf-8\">")
+    w.line(f"  <title>{w.sentence(3)}</title>")
+    w.line("  <link rel=\"stylesheet\" href=\"/static/css/site.css\">")
+    w.line("</head>")
+    w.line("<body>")
+    w.line("  <main>")
+    w.depth += 2
+    for _ in range(rng.randint(sections // 2 + 1, sections)):
+        rng.choice(PROFILES[profile])(w)
+    w.depth -= 2
+    w.line("  </main>")
+    w.line("</body>")
+    w.line("</html>")
+    return w.text()
+
+
+def partial_template(rng, profile, sections):
+    w = Writer(rng)
+    for _ in range(max(1, sections // 4)):
+        rng.choice(PROFILES[profile])(w)
+    return w.text()
+
+
+def chain_template(rng, profile, sections, level):
+    """Level N extends level N - 1 and overrides every block it inherits.
+
+    The level blocks nest, so level N has N + 2 blocks up to N + 1 deep, each
+    calling {{ block.super }} where there is one to call.
+    """
+    w = Writer(rng)
+    parent = "base.html" if level == 0 else f"chain/level_{level - 1:03d}.html"
+    w.line(f"{{% extends \"{parent}\" %}}")
+    w.line("{% block content %}")
+    w.depth += 1
+    w.line("{{ block.super }}")
+    for i in range(level + 1):
+        w.line(f"{{% block level_{i:03d} %}}")
+        w.depth += 1
+        if i < level:
+            w.line("{{ block.super }}")
+        for _ in range(rng.randint(1, max(1, sections // 4))):
+            rng.choice(PROFILES[profile])(w)
+    for i in reversed(range(level + 1)):
+        w.depth -= 1
+        w.line(f"{{% endblock level_{i:03d} %}}")
+    w.depth -= 1
+    w.line("{% endblock %}")
+    return w.text()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--out", required=True, help="output directory")
+    parser.add_argument("--files", type=int, default=200, help="number of page templates")
+    parser.add_argument("--sections", type=int, default=12,
+                        help="maximum sections per page (controls file size)")
+    parser.add_argument("--profile", choices=sorted(PROFILES), default="mixed",
+                        help="kind of markup to generate")
+    parser.add_argument("--seed", type=int, default=1, help="random seed")
+    parser.add_argument("--chain", type=int, default=0,
+                        help="also write an {%% extends %%} chain this many templates deep")
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+
+    def write(relative, content):
+        path = os.path.join(args.out, relative)
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+        with open(path, "w", encoding="utf-8", newline="\n") as f:
+            f.write(content)
+
+    if args.profile in STANDALONE_PROFILES:
+        for i in range(args.files):
+            write(f"app_{i // 1000:03d}/page_{i:06d}.html", html_page_template(rng, args.profile, args.sections))
+        return
+
+    write("base.html", base_template(rng))
+    partials = []
+    for name in ("nav", "footer"):
+        write(f"partials/{name}.html", partial_template(rng, args.profile, args.sections))
+        partials.append(f"partials/{name}.html")
+
+    # Spread pages over app directories so huge corpora stay browsable
+    for i in range(args.files):
+        write(f"app_{i // 1000:03d}/page_{i:06d}.html", page_template(rng, args.profile, args.sections, partials))
+
+    for level in range(args.chain):
+        write(f"chain/level_{level:03d}.html", chain_template(rng, args.profile, args.sections, level))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,135 @@
+#include "bench.h"
+#include "tree-sitter-htmldjango.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef HTMLDJANGO_SOURCE_DIR
+#define HTMLDJANGO_SOURCE_DIR "."
+#endif
+
+// A script or style body is an outer raw_text node whose children are the
+// raw_text fragments between Django tags. injections.scm captures the
+// fragments with injection.combined, so a highlighter parses one JavaScript
+// and one CSS document per file instead of one per fragment or per element.
+// This mode counts all three so the saving can be read off directly.
+// Scripts are combined by type, into JavaScript, JSON and markup template
+// documents; other script types get no injection.
+
+typedef struct {
+    uint64_t fragments;
+    uint64_t elements;
+    uint64_t combined;
+    uint64_t fragment_bytes;
+} InjectionCounts;
+
+// The C library leaves text predicates to the host, so a script that a host
+// injects once through one pattern matches every script pattern here.
+// Fragments are counted once each by their start byte. Combined documents are
+// counted per matching pattern, so with scripts present they are an upper
+// bound on what a host that checks the type would parse.
+typedef struct {
+    uint32_t start_byte;
+    uint32_t end_byte;
+    uint32_t parent_start_byte;
+} Fragment;
+
+static int compare_fragments(const void *a, const void *b) {
+    uint32_t x = ((const Fragment *)a)->start_byte, y = ((const Fragment *)b)->start_byte;
+    return (x > y) - (x < y);
+}
+
+static void count_injections(TSQueryCursor *cursor, const TSQuery *query, uint32_t content_id,
+                             TSNode root, InjectionCounts *counts) {
+    uint64_t patterns = 0;
+    Fragment *fragments = NULL;
+    size_t count = 0, capacity = 0;
+    TSQueryMatch match;
+    ts_query_cursor_exec(cursor, query, root);
+    while (ts_query_cursor_next_match(cursor, &match)) {
+        for (uint16_t i = 0; i < match.capture_count; i++) {
+            if (match.captures[i].index != content_id) continue;
+            TSNode node = match.captures[i].node;
+            if (count == capacity) {
+                capacity = capacity ? capacity * 2 : 64;
+                fragments = realloc(fragments, capacity * sizeof(Fragment));
+            }
+            fragments[count++] = (Fragment){ts_node_start_byte(node), ts_node_end_byte(node),
+                                            ts_node_start_byte(ts_node_parent(node))};
+            patterns |= 1ull << (match.pattern_index % 64);
+        }
+    }
+    qsort(fragments, count, sizeof(Fragment), compare_fragments);
+    uint32_t last_parent = UINT32_MAX;
+    for (size_t i = 0; i < count; i++) {
+        if (i > 0 && fragments[i].start_byte == fragments[i - 1].start_byte) continue;
+        if (fragments[i].parent_start_byte != last_parent) {
+            last_parent = fragments[i].parent_start_byte;
+            counts->elements++;
+        }
+        counts->fragments++;
+        counts->fragment_bytes += fragments[i].end_byte - fragments[i].start_byte;
+    }
+    free(fragments);
+    for (; patterns; patterns &= patterns - 1) counts->combined++;
+}
+
+int bench_injections(const Corpus *corpus, const BenchOptions *options) {
+    const TSLanguage *language = tree_sitter_htmldjango();
+    TSQuery *query = bench_load_query(language, HTMLDJANGO_SOURCE_DIR "/queries/injections.scm");
+    if (!query) return 1;
+
+    uint32_t content_id = UINT32_MAX;
+    for (uint32_t i = 0; i < ts_query_capture_count(query); i++) {
+        uint32_t length;
+        const char *name = ts_query_capture_name_for_id(query, i, &length);
+        if (length == strlen("injection.content") && strncmp(name, "injection.content", length) == 0) {
+            content_id = i;
+        }
+    }
+
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, language);
+    TSQueryCursor *cursor = ts_query_cursor_new();
+    InjectionCounts counts = {0};
+    double query_time = 0;
+
+    for (size_t i = 0; i < corpus->count; i++) {
+        const Document *document = &corpus->documents[i];
+        TSTree *tree = ts_parser_parse_string(parser, NULL, document->source, document->length);
+        TSNode root = ts_tree_root_node(tree);
+        count_injections(cursor, query, content_id, root, &counts);
+
+        double start = bench_now();
+        for (unsigned j = 0; j < options->iterations; j++) {
+            InjectionCounts scratch = {0};
+            count_injections(cursor, query, content_id, root, &scratch);
+        }
+        query_time += bench_now() - start;
+        ts_tree_delete(tree);
+    }
+    ts_query_cursor_delete(cursor);
+    ts_parser_delete(parser);
+    ts_query_delete(query);
+
+    double query_us = query_time / options->iterations * 1e6;
+    if (options->json) {
+        printf("{\"files\": %zu, \"bytes\": %llu, \"fragments\": %llu, \"elements\": %llu, "
+               "\"combined_documents\": %llu, \"fragment_bytes\": %llu, \"query_us\": %.1f}\n",
+               corpus->count, (unsigned long long)corpus->total_bytes,
+               (unsigned long long)counts.fragments, (unsigned long long)counts.elements,
+               (unsigned long long)counts.combined, (unsigned long long)counts.fragment_bytes, query_us);
+        return 0;
+    }
+
+    printf("files:                %zu (%llu bytes)\n", corpus->count, (unsigned long long)corpus->total_bytes);
+    printf("script/style bodies:  %llu\n", (unsigned long long)counts.elements);
+    printf("raw_text fragments:   %llu (%llu bytes)\n",
+           (unsigned long long)counts.fragments, (unsigned long long)counts.fragment_bytes);
+    printf("injected documents:   %llu per fragment, %llu per body, %llu combined\n",
+           (unsigned long long)counts.fragments, (unsigned long long)counts.elements,
+           (unsigned long long)counts.combined);
+    printf("injections.scm:       %.1f us per pass over the corpus\n", query_us);
+    return 0;
+}
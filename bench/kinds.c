@@ -0,0 +1,164 @@
+#include "bench.h"
+#include "tree-sitter-htmldjango.h"
+#include "tree-sitter-htmldjango-tools.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Times the same tree walk three ways: comparing ts_node_type() strings, the
+// way consumers do without published IDs; switching on the stable kinds of
+// tree-sitter-htmldjango-kinds.h; and comparing raw symbols looked up once
+// with ts_language_symbol_for_name(), the fastest a consumer could go by
+// hand, but tied to one build of the parse tables. The trees are parsed once
+// up front, and every walk must count the same nodes.
+
+typedef enum {
+    CATEGORY_IF,
+    CATEGORY_FOR,
+    CATEGORY_BLOCK,
+    CATEGORY_INCLUDE,
+    CATEGORY_INTERPOLATION,
+    CATEGORY_FILTER,
+    CATEGORY_ELEMENT,
+    CATEGORY_ATTRIBUTE,
+    CATEGORY_TEXT,
+    CATEGORY_COUNT,
+} Category;
+
+static const char *const CATEGORY_TYPES[CATEGORY_COUNT] = {
+    "django_if_block",   "django_for_block", "django_block_block", "django_include_tag", "django_interpolation",
+    "filter_call",       "normal_element",   "attribute",          "text",
+};
+
+typedef struct {
+    uint64_t counts[CATEGORY_COUNT];
+} Counts;
+
+typedef void (*Classify)(TSNode node, const TSSymbol *symbols, Counts *counts);
+
+static void classify_by_string(TSNode node, const TSSymbol *symbols, Counts *counts) {
+    (void)symbols;
+    const char *type = ts_node_type(node);
+    if (strcmp(type, "django_if_block") == 0) counts->counts[CATEGORY_IF]++;
+    else if (strcmp(type, "django_for_block") == 0) counts->counts[CATEGORY_FOR]++;
+    else if (strcmp(type, "django_block_block") == 0) counts->counts[CATEGORY_BLOCK]++;
+    else if (strcmp(type, "django_include_tag") == 0) counts->counts[CATEGORY_INCLUDE]++;
+    else if (strcmp(type, "django_interpolation") == 0) counts->counts[CATEGORY_INTERPOLATION]++;
+    else if (strcmp(type, "filter_call") == 0) counts->counts[CATEGORY_FILTER]++;
+    else if (strcmp(type, "normal_element") == 0) counts->counts[CATEGORY_ELEMENT]++;
+    else if (strcmp(type, "attribute") == 0) counts->counts[CATEGORY_ATTRIBUTE]++;
+    else if (strcmp(type, "text") == 0) counts->counts[CATEGORY_TEXT]++;
+}
+
+static void classify_by_kind(TSNode node, const TSSymbol *symbols, Counts *counts) {
+    (void)symbols;
+    switch (htmldjango_node_kind(node)) {
+        case HTMLDJANGO_KIND_DJANGO_IF_BLOCK: counts->counts[CATEGORY_IF]++; break;
+        case HTMLDJANGO_KIND_DJANGO_FOR_BLOCK: counts->counts[CATEGORY_FOR]++; break;
+        case HTMLDJANGO_KIND_DJANGO_BLOCK_BLOCK: counts->counts[CATEGORY_BLOCK]++; break;
+        case HTMLDJANGO_KIND_DJANGO_INCLUDE_TAG: counts->counts[CATEGORY_INCLUDE]++; break;
+        case HTMLDJANGO_KIND_DJANGO_INTERPOLATION: counts->counts[CATEGORY_INTERPOLATION]++; break;
+        case HTMLDJANGO_KIND_FILTER_CALL: counts->counts[CATEGORY_FILTER]++; break;
+        case HTMLDJANGO_KIND_NORMAL_ELEMENT: counts->counts[CATEGORY_ELEMENT]++; break;
+        case HTMLDJANGO_KIND_ATTRIBUTE: counts->counts[CATEGORY_ATTRIBUTE]++; break;
+        case HTMLDJANGO_KIND_TEXT: counts->counts[CATEGORY_TEXT]++; break;
+        default: break;
+    }
+}
+
+static void classify_by_symbol(TSNode node, const TSSymbol *symbols, Counts *counts) {
+    TSSymbol symbol = ts_node_symbol(node);
+    for (unsigned i = 0; i < CATEGORY_COUNT; i++) {
+        if (symbol == symbols[i]) {
+            counts->counts[i]++;
+            return;
+        }
+    }
+}
+
+static void walk(const TSTree *tree, Classify classify, const TSSymbol *symbols, Counts *counts) {
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+    for (;;) {
+        classify(ts_tree_cursor_current_node(&cursor), symbols, counts);
+        if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                ts_tree_cursor_delete(&cursor);
+                return;
+            }
+        }
+    }
+}
+
+static double time_walks(TSTree *const *trees, size_t count, unsigned iterations, Classify classify,
+                         const TSSymbol *symbols, Counts *counts) {
+    double start = bench_now();
+    for (unsigned i = 0; i < iterations; i++) {
+        *counts = (Counts){0};
+        for (size_t j = 0; j < count; j++) walk(trees[j], classify, symbols, counts);
+    }
+    return (bench_now() - start) / iterations;
+}
+
+int bench_kinds(const Corpus *corpus, const BenchOptions *options) {
+    const TSLanguage *language = tree_sitter_htmldjango();
+    TSSymbol symbols[CATEGORY_COUNT];
+    for (unsigned i = 0; i < CATEGORY_COUNT; i++) {
+        symbols[i] = ts_language_symbol_for_name(language, CATEGORY_TYPES[i], (uint32_t)strlen(CATEGORY_TYPES[i]), true);
+    }
+
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, language);
+    TSTree **trees = calloc(corpus->count, sizeof(TSTree *));
+    if (!trees) {
+        fprintf(stderr, "htmldjango-bench: out of memory\n");
+        ts_parser_delete(parser);
+        return 1;
+    }
+    uint64_t node_count = 0;
+    for (size_t i = 0; i < corpus->count; i++) {
+        const Document *document = &corpus->documents[i];
+        trees[i] = ts_parser_parse_string(parser, NULL, document->source, document->length);
+        node_count += ts_node_descendant_count(ts_tree_root_node(trees[i]));
+    }
+    ts_parser_delete(parser);
+
+    // Build the kind table before timing
+    htmldjango_kind_for_symbol(0);
+    Counts by_string, by_kind, by_symbol;
+    double string_time = time_walks(trees, corpus->count, options->iterations, classify_by_string, symbols, &by_string);
+    double kind_time = time_walks(trees, corpus->count, options->iterations, classify_by_kind, symbols, &by_kind);
+    double symbol_time = time_walks(trees, corpus->count, options->iterations, classify_by_symbol, symbols, &by_symbol);
+
+    for (size_t i = 0; i < corpus->count; i++) ts_tree_delete(trees[i]);
+    free(trees);
+
+    if (memcmp(&by_string, &by_kind, sizeof(Counts)) != 0 || memcmp(&by_string, &by_symbol, sizeof(Counts)) != 0) {
+        fprintf(stderr, "htmldjango-bench: the walks counted different nodes\n");
+        for (unsigned i = 0; i < CATEGORY_COUNT; i++) {
+            fprintf(stderr, "  %-22s %llu %llu %llu\n", CATEGORY_TYPES[i], (unsigned long long)by_string.counts[i],
+                    (unsigned long long)by_kind.counts[i], (unsigned long long)by_symbol.counts[i]);
+        }
+        return 1;
+    }
+
+    if (options->json) {
+        printf("{\"files\": %zu, \"nodes\": %llu, \"string_ms\": %.3f, \"kind_ms\": %.3f, \"symbol_ms\": %.3f, "
+               "\"speedup\": %.2f}\n",
+               corpus->count, (unsigned long long)node_count, string_time * 1e3, kind_time * 1e3, symbol_time * 1e3,
+               string_time / kind_time);
+        return 0;
+    }
+
+    double nodes = (double)node_count;
+    printf("files:          %zu (%llu nodes)\n", corpus->count, (unsigned long long)node_count);
+    printf("strcmp:         %.3f ms per pass, %.1f ns per node\n", string_time * 1e3, string_time * 1e9 / nodes);
+    printf("stable kinds:   %.3f ms per pass, %.1f ns per node\n", kind_time * 1e3, kind_time * 1e9 / nodes);
+    printf("raw symbols:    %.3f ms per pass, %.1f ns per node\n", symbol_time * 1e3, symbol_time * 1e9 / nodes);
+    printf("speedup:        %.2fx over strcmp\n", string_time / kind_time);
+    for (unsigned i = 0; i < CATEGORY_COUNT; i++) {
+        printf("  %-22s %llu\n", CATEGORY_TYPES[i], (unsigned long long)by_kind.counts[i]);
+    }
+    return 0;
+}
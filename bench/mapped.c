@@ -0,0 +1,150 @@
+#define _GNU_SOURCE
+
+#include "bench.h"
+#include "tree-sitter-htmldjango.h"
+#include "tree-sitter-htmldjango-tools.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Parses each file twice, each time in a fresh child process so that peak
+// RSS belongs to one strategy only: once read into a heap buffer, as a host
+// language string would be, and once through htmldjango_parse_file(). The
+// harness does not load the files itself in this mode.
+//
+// Mapped pages still count toward RSS while they are resident, but they are
+// clean page cache that the kernel can drop, so the RSS is also split into
+// anonymous and file-backed memory (Linux only), sampled right after the
+// last parse.
+
+typedef struct {
+    int error;
+    double seconds;
+    size_t tree_peak;
+    long anon_kb;
+    long file_kb;
+} ChildResult;
+
+static long status_kb(const char *field) {
+    FILE *file = fopen("/proc/self/status", "r");
+    if (!file) return -1;
+    char line[256];
+    size_t length = strlen(field);
+    long value = -1;
+    while (fgets(line, sizeof(line), file)) {
+        if (strncmp(line, field, length) == 0 && line[length] == ':') {
+            value = strtol(line + length + 1, NULL, 10);
+            break;
+        }
+    }
+    fclose(file);
+    return value;
+}
+
+static void parse_in_child(const Document *document, bool mapped, unsigned iterations, ChildResult *result) {
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, tree_sitter_htmldjango());
+    bench_reset_peak();
+
+    double start = bench_now();
+    for (unsigned i = 0; i < iterations && !result->error; i++) {
+        TSTree *tree = NULL;
+        char *source = NULL;
+        if (mapped) {
+            tree = htmldjango_parse_file(parser, NULL, document->path, &result->error);
+        } else {
+            FILE *file = fopen(document->path, "rb");
+            if (!file) {
+                result->error = errno;
+                break;
+            }
+            source = malloc(document->length ? document->length : 1);
+            size_t read = fread(source, 1, document->length, file);
+            fclose(file);
+            tree = ts_parser_parse_string(parser, NULL, source, (uint32_t)read);
+        }
+        if (i + 1 == iterations) {
+            result->anon_kb = status_kb("RssAnon");
+            result->file_kb = status_kb("RssFile");
+        }
+        free(source);
+        if (tree) ts_tree_delete(tree);
+    }
+    result->seconds = (bench_now() - start) / iterations;
+    result->tree_peak = bench_peak_bytes();
+    ts_parser_delete(parser);
+}
+
+static bool run_child(const Document *document, bool mapped, unsigned iterations,
+                      ChildResult *result, long *peak_rss_kb) {
+    int fds[2];
+    if (pipe(fds) != 0) return false;
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return false;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        ChildResult child = {0};
+        parse_in_child(document, mapped, iterations, &child);
+        ssize_t written = write(fds[1], &child, sizeof(child));
+        _exit(written == sizeof(child) ? 0 : 1);
+    }
+
+    close(fds[1]);
+    bool ok = read(fds[0], result, sizeof(*result)) == sizeof(*result);
+    close(fds[0]);
+    int status;
+    struct rusage usage;
+    if (wait4(pid, &status, 0, &usage) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) ok = false;
+#ifdef __APPLE__
+    *peak_rss_kb = usage.ru_maxrss / 1024;
+#else
+    *peak_rss_kb = usage.ru_maxrss;
+#endif
+    return ok;
+}
+
+int bench_mapped(const Corpus *corpus, const BenchOptions *options) {
+    static const char *STRATEGIES[] = {"read", "mmap"};
+    if (!options->json) {
+        printf("%-40s %-6s %10s %10s %12s %10s %10s %12s\n", "file", "input", "MB", "MB/s",
+               "peak RSS KB", "anon KB", "file KB", "tree peak KB");
+    }
+
+    int status = 0;
+    for (size_t i = 0; i < corpus->count; i++) {
+        const Document *document = &corpus->documents[i];
+        double megabytes = (double)document->length / 1e6;
+        for (int mapped = 0; mapped < 2; mapped++) {
+            ChildResult result = {0};
+            long peak_rss_kb = 0;
+            if (!run_child(document, mapped, options->iterations, &result, &peak_rss_kb) || result.error) {
+                fprintf(stderr, "htmldjango-bench: %s (%s): %s\n", document->path, STRATEGIES[mapped],
+                        result.error ? strerror(result.error) : "child process failed");
+                status = 1;
+                continue;
+            }
+            double mb_s = result.seconds > 0 ? megabytes / result.seconds : 0;
+            if (options->json) {
+                printf("{\"file\": \"%s\", \"input\": \"%s\", \"bytes\": %u, \"mb_s\": %.2f, "
+                       "\"peak_rss_kb\": %ld, \"anon_kb\": %ld, \"file_kb\": %ld, \"tree_peak_kb\": %zu}\n",
+                       document->path, STRATEGIES[mapped], document->length, mb_s, peak_rss_kb,
+                       result.anon_kb, result.file_kb, result.tree_peak / 1024);
+            } else {
+                printf("%-40s %-6s %10.2f %10.2f %12ld %10ld %10ld %12zu\n", document->path,
+                       STRATEGIES[mapped], megabytes, mb_s, peak_rss_kb, result.anon_kb, result.file_kb,
+                       result.tree_peak / 1024);
+            }
+        }
+    }
+    return status;
+}
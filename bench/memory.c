@@ -0,0 +1,135 @@
+#include "bench.h"
+#include "tree-sitter-htmldjango.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Per-symbol tally. Symbols are public symbols, so every alias of a node
+// type (e.g. the many `tag_name` aliases) is counted under one entry.
+typedef struct {
+    TSSymbol symbol;
+    bool named;
+    uint64_t count;
+    uint64_t span_bytes;
+} TypeStats;
+
+typedef struct {
+    uint64_t nodes;
+    uint64_t named_nodes;
+    uint64_t tree_bytes;
+    uint64_t input_bytes;
+} Totals;
+
+static int compare_by_count(const void *a, const void *b) {
+    const TypeStats *left = a;
+    const TypeStats *right = b;
+    if (left->count != right->count) return left->count < right->count ? 1 : -1;
+    return (int)left->symbol - (int)right->symbol;
+}
+
+// Walks every node, named or not, since anonymous tokens occupy tree memory too
+static void count_nodes(TSTree *tree, TypeStats *stats, uint32_t symbol_count, Totals *totals) {
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+    for (;;) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        TSSymbol symbol = ts_node_symbol(node);
+        // ERROR nodes use a sentinel symbol outside the language's symbol table
+        uint32_t index = symbol < symbol_count ? symbol : symbol_count;
+        TypeStats *entry = &stats[index];
+        entry->symbol = symbol;
+        entry->named = ts_node_is_named(node);
+        entry->count++;
+        entry->span_bytes += ts_node_end_byte(node) - ts_node_start_byte(node);
+        totals->nodes++;
+        if (entry->named) totals->named_nodes++;
+
+        if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                ts_tree_cursor_delete(&cursor);
+                return;
+            }
+        }
+    }
+}
+
+int bench_memory(const Corpus *corpus, const BenchOptions *options) {
+    const TSLanguage *language = tree_sitter_htmldjango();
+    uint32_t symbol_count = ts_language_symbol_count(language);
+    TypeStats *stats = calloc(symbol_count + 1, sizeof(TypeStats));
+    Totals totals = {0};
+
+    printf("%-40s %10s %9s %9s %11s %10s %10s\n",
+           "file", "bytes", "nodes", "named", "tree bytes", "nodes/B", "tree/B");
+
+    for (size_t i = 0; i < corpus->count; i++) {
+        const Document *document = &corpus->documents[i];
+
+        // The parser is created and destroyed around each parse so that the
+        // only runtime allocations still live afterwards belong to the tree.
+        size_t before = bench_live_bytes();
+        TSParser *parser = ts_parser_new();
+        ts_parser_set_language(parser, language);
+        TSTree *tree = ts_parser_parse_string(parser, NULL, document->source, document->length);
+        ts_parser_delete(parser);
+        size_t tree_bytes = bench_live_bytes() - before;
+
+        Totals file_totals = {0};
+        count_nodes(tree, stats, symbol_count, &file_totals);
+        ts_tree_delete(tree);
+
+        double length = document->length ? (double)document->length : 1.0;
+        printf("%-40s %10u %9llu %9llu %11zu %10.3f %10.2f\n",
+               document->path,
+               document->length,
+               (unsigned long long)file_totals.nodes,
+               (unsigned long long)file_totals.named_nodes,
+               tree_bytes,
+               (double)file_totals.nodes / length,
+               (double)tree_bytes / length);
+
+        totals.nodes += file_totals.nodes;
+        totals.named_nodes += file_totals.named_nodes;
+        totals.tree_bytes += tree_bytes;
+        totals.input_bytes += document->length;
+    }
+
+    double input_bytes = totals.input_bytes ? (double)totals.input_bytes : 1.0;
+    double bytes_per_byte = (double)totals.tree_bytes / input_bytes;
+    double bytes_per_node = totals.nodes ? (double)totals.tree_bytes / (double)totals.nodes : 0.0;
+    printf("%-40s %10llu %9llu %9llu %11llu %10.3f %10.2f\n",
+           "total",
+           (unsigned long long)totals.input_bytes,
+           (unsigned long long)totals.nodes,
+           (unsigned long long)totals.named_nodes,
+           (unsigned long long)totals.tree_bytes,
+           (double)totals.nodes / input_bytes,
+           bytes_per_byte);
+
+    // The runtime does not expose per-node sizes, so each type is charged the
+    // average bytes per node. Useful for ranking, not for exact accounting.
+    qsort(stats, symbol_count + 1, sizeof(TypeStats), compare_by_count);
+    printf("\nnode types by count (%.1f tree bytes per node on average)\n", bytes_per_node);
+    printf("%-32s %6s %10s %8s %12s %12s\n", "type", "named", "count", "share", "est. bytes", "span bytes");
+    for (uint32_t i = 0; i < options->top && i <= symbol_count && stats[i].count > 0; i++) {
+        const TypeStats *entry = &stats[i];
+        const char *name = entry->symbol < symbol_count ? ts_language_symbol_name(language, entry->symbol) : "ERROR";
+        printf("%-32s %6s %10llu %7.2f%% %12.0f %12llu\n",
+               name,
+               entry->named ? "yes" : "no",
+               (unsigned long long)entry->count,
+               100.0 * (double)entry->count / (double)totals.nodes,
+               bytes_per_node * (double)entry->count,
+               (unsigned long long)entry->span_bytes);
+    }
+
+    free(stats);
+
+    if (options->budget > 0 && bytes_per_byte > options->budget) {
+        fprintf(stderr, "htmldjango-bench: %.2f tree bytes per input byte exceeds the budget of %.2f\n",
+                bytes_per_byte, options->budget);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,154 @@
+#include "bench.h"
+#include "tree-sitter-htmldjango.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef HTMLDJANGO_SOURCE_DIR
+#define HTMLDJANGO_SOURCE_DIR "."
+#endif
+
+// Times query files over parsed trees, and how long each takes to compile
+// (reading the file included). To compare two versions of a query, pass both
+// with --query.
+//
+// Text predicates such as #match? are evaluated by the host after the cursor
+// returns a match, over the full text of each capture. The cursor cannot run
+// them, so "predicate bytes" counts the captured text a host would have to
+// scan for patterns that have any.
+
+static const char *DEFAULT_QUERIES[] = {
+    HTMLDJANGO_SOURCE_DIR "/queries/highlights.scm",
+    HTMLDJANGO_SOURCE_DIR "/queries/open-tags.scm",
+    HTMLDJANGO_SOURCE_DIR "/queries/tags.scm",
+    HTMLDJANGO_SOURCE_DIR "/queries/locals.scm",
+    NULL,
+};
+
+typedef struct {
+    uint64_t matches;
+    uint64_t captures;
+    uint64_t predicate_bytes;
+} QueryCounts;
+
+// Predicates are named with a trailing '?' (#match?, #eq?, ...), unlike
+// directives such as #set!, which cost nothing per match
+static bool has_text_predicate(const TSQuery *query, uint32_t pattern) {
+    uint32_t step_count;
+    const TSQueryPredicateStep *steps = ts_query_predicates_for_pattern(query, pattern, &step_count);
+    bool at_name = true;
+    for (uint32_t i = 0; i < step_count; i++) {
+        if (steps[i].type == TSQueryPredicateStepTypeDone) {
+            at_name = true;
+            continue;
+        }
+        if (at_name && steps[i].type == TSQueryPredicateStepTypeString) {
+            uint32_t length;
+            const char *name = ts_query_string_value_for_id(query, steps[i].value_id, &length);
+            if (length > 0 && name[length - 1] == '?') return true;
+        }
+        at_name = false;
+    }
+    return false;
+}
+
+static void run_query(TSQueryCursor *cursor, const TSQuery *query, const bool *text_predicates,
+                      TSNode root, QueryCounts *counts) {
+    TSQueryMatch match;
+    ts_query_cursor_exec(cursor, query, root);
+    while (ts_query_cursor_next_match(cursor, &match)) {
+        counts->matches++;
+        counts->captures += match.capture_count;
+        if (!text_predicates[match.pattern_index]) continue;
+        for (uint16_t i = 0; i < match.capture_count; i++) {
+            TSNode node = match.captures[i].node;
+            counts->predicate_bytes += ts_node_end_byte(node) - ts_node_start_byte(node);
+        }
+    }
+}
+
+int bench_query(const Corpus *corpus, const BenchOptions *options) {
+    const TSLanguage *language = tree_sitter_htmldjango();
+    const char *const *paths = options->query_count ? options->queries : DEFAULT_QUERIES;
+    size_t path_count = options->query_count;
+    if (!path_count) {
+        while (DEFAULT_QUERIES[path_count]) path_count++;
+    }
+
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, language);
+    TSTree **trees = calloc(corpus->count, sizeof(TSTree *));
+    double start = bench_now();
+    for (size_t i = 0; i < corpus->count; i++) {
+        const Document *document = &corpus->documents[i];
+        trees[i] = ts_parser_parse_string(parser, NULL, document->source, document->length);
+    }
+    double parse_time = bench_now() - start;
+    ts_parser_delete(parser);
+
+    int status = 0;
+    double megabytes = (double)corpus->total_bytes / 1e6;
+    if (!options->json) {
+        printf("parse: %.2f ms for %llu bytes\n\n", parse_time * 1e3, (unsigned long long)corpus->total_bytes);
+        printf("%-24s %8s %10s %10s %10s %14s %10s %12s %10s\n", "query", "patterns", "compile ms",
+               "matches", "captures", "predicate B", "ms/pass", "matches/s", "MB/s");
+    }
+
+    TSQueryCursor *cursor = ts_query_cursor_new();
+    for (size_t q = 0; q < path_count; q++) {
+        start = bench_now();
+        TSQuery *query = bench_load_query(language, paths[q]);
+        if (!query) {
+            status = 1;
+            continue;
+        }
+        for (unsigned j = 1; j < options->iterations; j++) {
+            ts_query_delete(bench_load_query(language, paths[q]));
+        }
+        double compile_time = (bench_now() - start) / options->iterations;
+
+        bool *text_predicates = calloc(ts_query_pattern_count(query) + 1, sizeof(bool));
+        for (uint32_t i = 0; i < ts_query_pattern_count(query); i++) {
+            text_predicates[i] = has_text_predicate(query, i);
+        }
+
+        QueryCounts counts = {0};
+        for (size_t i = 0; i < corpus->count; i++) {
+            run_query(cursor, query, text_predicates, ts_tree_root_node(trees[i]), &counts);
+        }
+
+        start = bench_now();
+        for (unsigned j = 0; j < options->iterations; j++) {
+            QueryCounts scratch = {0};
+            for (size_t i = 0; i < corpus->count; i++) {
+                run_query(cursor, query, text_predicates, ts_tree_root_node(trees[i]), &scratch);
+            }
+        }
+        double pass_time = (bench_now() - start) / options->iterations;
+
+        const char *name = strrchr(paths[q], '/');
+        name = name ? name + 1 : paths[q];
+        double matches_per_second = (double)counts.matches / pass_time;
+        if (options->json) {
+            printf("{\"query\": \"%s\", \"patterns\": %u, \"compile_ms\": %.3f, \"matches\": %llu, "
+                   "\"captures\": %llu, \"predicate_bytes\": %llu, \"ms_per_pass\": %.3f, "
+                   "\"matches_per_s\": %.0f, \"mb_s\": %.2f}\n",
+                   name, ts_query_pattern_count(query), compile_time * 1e3, (unsigned long long)counts.matches,
+                   (unsigned long long)counts.captures, (unsigned long long)counts.predicate_bytes,
+                   pass_time * 1e3, matches_per_second, megabytes / pass_time);
+        } else {
+            printf("%-24s %8u %10.3f %10llu %10llu %14llu %10.3f %12.0f %10.2f\n",
+                   name, ts_query_pattern_count(query), compile_time * 1e3, (unsigned long long)counts.matches,
+                   (unsigned long long)counts.captures, (unsigned long long)counts.predicate_bytes,
+                   pass_time * 1e3, matches_per_second, megabytes / pass_time);
+        }
+        free(text_predicates);
+        ts_query_delete(query);
+    }
+    ts_query_cursor_delete(cursor);
+
+    for (size_t i = 0; i < corpus->count; i++) ts_tree_delete(trees[i]);
+    free(trees);
+    return status;
+}
@@ -0,0 +1,97 @@
+#include "bench.h"
+#include "tree-sitter-htmldjango.h"
+
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#ifndef HTMLDJANGO_SOURCE_DIR
+#define HTMLDJANGO_SOURCE_DIR "."
+#endif
+
+// dlopen() of an already loaded path only bumps a reference count, so the
+// library is copied to a fresh file and the copy is loaded instead. This
+// measures mapping and relocating the parse tables, which grow with them.
+static double time_library_load(const char *library, unsigned iterations) {
+    FILE *source = library ? fopen(library, "rb") : NULL;
+    if (!source) return -1;
+
+    char path[] = "/tmp/htmldjango-bench-XXXXXX";
+    int fd = mkstemp(path);
+    FILE *copy = fd >= 0 ? fdopen(fd, "wb") : NULL;
+    if (!copy) {
+        fclose(source);
+        return -1;
+    }
+    char buffer[65536];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), source)) > 0) {
+        fwrite(buffer, 1, read, copy);
+    }
+    fclose(source);
+    fclose(copy);
+
+    double total = 0;
+    for (unsigned i = 0; i < iterations; i++) {
+        double start = bench_now();
+        void *handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+        if (!handle) {
+            fprintf(stderr, "htmldjango-bench: %s\n", dlerror());
+            total = -1;
+            break;
+        }
+        const TSLanguage *(*language)(void) = NULL;
+        *(void **)&language = dlsym(handle, "tree_sitter_htmldjango");
+        if (language) ts_language_state_count(language());
+        total += bench_now() - start;
+        dlclose(handle);
+    }
+    unlink(path);
+    return total < 0 ? -1 : total / iterations;
+}
+
+int bench_tables(const Corpus *corpus, const BenchOptions *options) {
+    const TSLanguage *language = tree_sitter_htmldjango();
+    const char *library = bench_library_path();
+    long parser_size = bench_file_size(HTMLDJANGO_SOURCE_DIR "/src/parser.c");
+    long library_size = bench_file_size(library);
+    double load_time = time_library_load(library, options->iterations);
+
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, language);
+    double start = bench_now();
+    for (unsigned i = 0; i < options->iterations; i++) {
+        for (size_t j = 0; j < corpus->count; j++) {
+            const Document *document = &corpus->documents[j];
+            ts_tree_delete(ts_parser_parse_string(parser, NULL, document->source, document->length));
+        }
+    }
+    double elapsed = bench_now() - start;
+    ts_parser_delete(parser);
+    double throughput = (double)corpus->total_bytes * options->iterations / elapsed / 1e6;
+
+    // Run once before and once after a grammar change and diff the output
+    if (options->json) {
+        printf("{\"states\": %u, \"symbols\": %u, \"fields\": %u, \"parser_c_bytes\": %ld, "
+               "\"library_bytes\": %ld, \"load_ms\": %.3f, \"throughput_mb_s\": %.2f}\n",
+               ts_language_state_count(language), ts_language_symbol_count(language),
+               ts_language_field_count(language), parser_size, library_size,
+               load_time * 1e3, throughput);
+        return 0;
+    }
+
+    printf("parse states:   %u\n", ts_language_state_count(language));
+    printf("symbols:        %u\n", ts_language_symbol_count(language));
+    printf("fields:         %u\n", ts_language_field_count(language));
+    printf("parser.c bytes: %ld\n", parser_size);
+    printf("library:        %s\n", library ? library : "(unknown)");
+    printf("library bytes:  %ld\n", library_size);
+    if (load_time >= 0) {
+        printf("load time:      %.3f ms\n", load_time * 1e3);
+    } else {
+        printf("load time:      unavailable\n");
+    }
+    printf("throughput:     %.2f MB/s\n", throughput);
+    return 0;
+}
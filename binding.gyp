@@ -1,4 +1,8 @@
 {
+  "variables": {
+    # parseBatch() links the tree-sitter runtime found by pkg-config
+    "async_parse%": "<!(pkg-config --exists tree-sitter 2>/dev/null && echo true || echo false)",
+  },
   "targets": [
     {
       "target_name": "tree_sitter_htmldjango_binding",
@@ -7,11 +11,16 @@
       ],
       "include_dirs": [
         "src",
+        "bindings/c",
       ],
       "sources": [
         "bindings/node/binding.cc",
         "src/parser.c",
         "src/scanner.c",
+        "expression/src/parser.c",
+        "expression/src/scanner.c",
+        "tools/blocks.c",
+        "tools/kinds.c",
       ],
       "conditions": [
         ["OS!='win'", {
@@ -24,6 +33,32 @@
             "/utf-8",
           ],
         }],
+        ["OS!='win' and async_parse=='true'", {
+          "defines": [
+            "HTMLDJANGO_ASYNC_PARSE",
+          ],
+          "sources": [
+            "tools/cst_writer.c",
+            "tools/dependencies.c",
+            "tools/mapped.c",
+            "tools/node_kinds.c",
+          ],
+          "cflags": [
+            "<!@(pkg-config --cflags tree-sitter)",
+          ],
+          "cflags_c": [
+            "-D_POSIX_C_SOURCE=200809L",
+          ],
+          "xcode_settings": {
+            "OTHER_CFLAGS": [
+              "<!@(pkg-config --cflags tree-sitter)",
+            ],
+          },
+          "libraries": [
+            "<!@(pkg-config --libs tree-sitter)",
+            "-lpthread",
+          ],
+        }],
       ],
     }
   ]
@@ -0,0 +1,69 @@
+#ifndef TREE_SITTER_HTMLDJANGO_BLOCKS_H_
+#define TREE_SITTER_HTMLDJANGO_BLOCKS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The {% block %} structure of a template, for resolving {% extends %}
+// chains. It is found by the same tag scan as htmldjango_extract_dependencies()
+// and needs neither a tree nor the tree-sitter runtime, so every binding
+// compiles it in.
+
+#define HTMLDJANGO_NO_BLOCK UINT32_MAX
+
+typedef struct {
+    // Points into the source
+    const char *name;
+    uint32_t name_length;
+    // From the start of {% block %} to the end of {% endblock %}
+    uint32_t start_byte;
+    uint32_t end_byte;
+    // Between the two tags
+    uint32_t content_start_byte;
+    uint32_t content_end_byte;
+    // 0 for a top-level block
+    uint32_t depth;
+    // Index of the enclosing block, or HTMLDJANGO_NO_BLOCK
+    uint32_t parent;
+    // {{ block.super }} usages directly in this block, not in nested ones
+    uint32_t super_count;
+    // False if the source ends first; the block then runs to the end
+    bool closed;
+} HTMLDjangoBlock;
+
+typedef struct {
+    // Index of the innermost enclosing block
+    uint32_t block;
+    uint32_t start_byte;
+    uint32_t end_byte;
+} HTMLDjangoBlockSuper;
+
+// Blocks are in the order their {% block %} tags appear, so a block's parent
+// always comes before it, and supers in the order they appear. Zero-initialize
+// a map before its first use; building into the same map again reuses its
+// arrays.
+typedef struct {
+    HTMLDjangoBlock *blocks;
+    uint32_t block_count;
+    HTMLDjangoBlockSuper *supers;
+    uint32_t super_count;
+    uint32_t block_capacity;
+    uint32_t super_capacity;
+} HTMLDjangoBlockMap;
+
+// Fills map with the blocks of source. Tags inside comment and verbatim
+// blocks are skipped; an {% endblock %} closes the innermost open block
+// whatever its name. Returns false if memory runs out.
+bool htmldjango_block_map_build(HTMLDjangoBlockMap *map, const char *source, uint32_t length);
+
+void htmldjango_block_map_delete(HTMLDjangoBlockMap *map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREE_SITTER_HTMLDJANGO_BLOCKS_H_
@@ -0,0 +1,103 @@
+#ifndef TREE_SITTER_HTMLDJANGO_CST_H_
+#define TREE_SITTER_HTMLDJANGO_CST_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A syntax tree flattened into one buffer, for handing parse results to
+// another process without re-parsing or a text dump. The tools library
+// writes it from a TSTree (htmldjango_cst_write()); this reader needs
+// neither the tree-sitter runtime nor a copy of the buffer.
+//
+// All integers are little-endian. The buffer starts with a 32-byte header:
+//
+//    0  char[4]  magic "HDJC"
+//    4  u16      format version, HTMLDJANGO_CST_VERSION
+//    6  u16      header size (32)
+//    8  u32      node count
+//   12  u32      kind count
+//   16  u32      field count
+//   20  u32      offset of the name table
+//   24  u32      total size of the buffer
+//   28  u32      reserved (0)
+//
+// followed by the nodes in pre-order, 24 bytes each:
+//
+//    0  u16      kind
+//    2  u16      field: the node's field in its parent, 0 for none
+//    4  u16      flags (HTMLDjangoCSTFlag)
+//    6  u16      reserved (0)
+//    8  u32      start byte
+//   12  u32      end byte
+//   16  u32      parent index, HTMLDJANGO_CST_NO_NODE for the root
+//   20  u32      next: one past the node's last descendant
+//
+// A node's first child, if any, is the node after it, and each child's next
+// is the index of its next sibling (or its parent's next, after the last
+// child), so a subtree is the range [index, next).
+//
+// The name table is kind count + field count u32 offsets, relative to the
+// table, of NUL-terminated UTF-8 names: first the kinds, then the fields.
+// Kinds and fields are the stable IDs of tree-sitter-htmldjango-kinds.h
+// (kind 0 is ERROR, field 0 is ""), which are fixed for a format version.
+
+#define HTMLDJANGO_CST_VERSION 1
+#define HTMLDJANGO_CST_HEADER_SIZE 32
+#define HTMLDJANGO_CST_NODE_SIZE 24
+#define HTMLDJANGO_CST_NO_NODE UINT32_MAX
+
+typedef enum {
+    HTMLDjangoCSTNamed = 1 << 0,
+    HTMLDjangoCSTMissing = 1 << 1,
+    HTMLDjangoCSTExtra = 1 << 2,
+    HTMLDjangoCSTError = 1 << 3,
+    HTMLDjangoCSTHasError = 1 << 4,
+} HTMLDjangoCSTFlag;
+
+typedef struct {
+    uint16_t kind;
+    uint16_t field;
+    uint16_t flags;
+    uint32_t start_byte;
+    uint32_t end_byte;
+    uint32_t parent;
+    uint32_t next;
+} HTMLDjangoCSTNode;
+
+typedef struct {
+    const uint8_t *data;
+    size_t length;
+    uint32_t node_count;
+    uint32_t kind_count;
+    uint32_t field_count;
+    uint32_t names_offset;
+} HTMLDjangoCST;
+
+// Checks the header and every node's links and IDs, so that the functions
+// below can trust the buffer, and points cst at data, which must outlive it.
+// Returns false if data is not a complete buffer of this format version.
+bool htmldjango_cst_open(HTMLDjangoCST *cst, const void *data, size_t length);
+
+// index must be below node_count
+HTMLDjangoCSTNode htmldjango_cst_node(const HTMLDjangoCST *cst, uint32_t index);
+
+// HTMLDJANGO_CST_NO_NODE if there is none
+uint32_t htmldjango_cst_first_child(const HTMLDjangoCST *cst, uint32_t index);
+
+uint32_t htmldjango_cst_next_sibling(const HTMLDjangoCST *cst, uint32_t index);
+
+// Point into the buffer; NULL for an ID out of range
+const char *htmldjango_cst_kind_name(const HTMLDjangoCST *cst, uint16_t kind);
+
+const char *htmldjango_cst_field_name(const HTMLDjangoCST *cst, uint16_t field);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREE_SITTER_HTMLDJANGO_CST_H_
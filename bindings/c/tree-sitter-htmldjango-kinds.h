@@ -0,0 +1,260 @@
+// Generated by tools/gen_kinds.py from src/node-types.json. Do not edit.
+
+#ifndef TREE_SITTER_HTMLDJANGO_KINDS_H_
+#define TREE_SITTER_HTMLDJANGO_KINDS_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Stable IDs for the node kinds and fields of src/node-types.json. The
+// parser's own symbol and field IDs move whenever the grammar is
+// regenerated; these are assigned once, in tools/kind_ids.json, and never
+// move.
+
+typedef enum {
+    HTMLDJANGO_KIND_ERROR, // ERROR
+    HTMLDJANGO_KIND_COMPARISON_OPERATOR, // comparison_operator
+    HTMLDJANGO_KIND_DJANGO_STATEMENT, // django_statement
+    HTMLDJANGO_KIND_ELEMENT, // element
+    HTMLDJANGO_KIND_LITERAL, // literal
+    HTMLDJANGO_KIND_AND_EXPRESSION, // and_expression
+    HTMLDJANGO_KIND_AS_ALIAS, // as_alias
+    HTMLDJANGO_KIND_ASSIGNMENT, // assignment
+    HTMLDJANGO_KIND_ATTRIBUTE, // attribute
+    HTMLDJANGO_KIND_ATTRIBUTE_NAME, // attribute_name
+    HTMLDJANGO_KIND_ATTRIBUTE_VALUE, // attribute_value
+    HTMLDJANGO_KIND_COMPARISON_EXPRESSION, // comparison_expression
+    HTMLDJANGO_KIND_CYCLE_VALUE, // cycle_value
+    HTMLDJANGO_KIND_DJANGO_ATTRIBUTE_ELIF_BRANCH, // django_attribute_elif_branch
+    HTMLDJANGO_KIND_DJANGO_ATTRIBUTE_ELSE_BRANCH, // django_attribute_else_branch
+    HTMLDJANGO_KIND_DJANGO_ATTRIBUTE_EMPTY_BRANCH, // django_attribute_empty_branch
+    HTMLDJANGO_KIND_DJANGO_ATTRIBUTE_FOR_BLOCK, // django_attribute_for_block
+    HTMLDJANGO_KIND_DJANGO_ATTRIBUTE_IF_BLOCK, // django_attribute_if_block
+    HTMLDJANGO_KIND_DJANGO_AUTOESCAPE_BLOCK, // django_autoescape_block
+    HTMLDJANGO_KIND_DJANGO_BLOCK_BLOCK, // django_block_block
+    HTMLDJANGO_KIND_DJANGO_BLOCK_COMMENT, // django_block_comment
+    HTMLDJANGO_KIND_DJANGO_BLOCK_OPEN, // django_block_open
+    HTMLDJANGO_KIND_DJANGO_CSRF_TOKEN_TAG, // django_csrf_token_tag
+    HTMLDJANGO_KIND_DJANGO_CYCLE_TAG, // django_cycle_tag
+    HTMLDJANGO_KIND_DJANGO_DEBUG_TAG, // django_debug_tag
+    HTMLDJANGO_KIND_DJANGO_ELIF, // django_elif
+    HTMLDJANGO_KIND_DJANGO_ELIF_BRANCH, // django_elif_branch
+    HTMLDJANGO_KIND_DJANGO_ELSE, // django_else
+    HTMLDJANGO_KIND_DJANGO_ELSE_BRANCH, // django_else_branch
+    HTMLDJANGO_KIND_DJANGO_EMPTY, // django_empty
+    HTMLDJANGO_KIND_DJANGO_EMPTY_BRANCH, // django_empty_branch
+    HTMLDJANGO_KIND_DJANGO_ENDBLOCK, // django_endblock
+    HTMLDJANGO_KIND_DJANGO_ENDFOR, // django_endfor
+    HTMLDJANGO_KIND_DJANGO_ENDIF, // django_endif
+    HTMLDJANGO_KIND_DJANGO_ENDWITH, // django_endwith
+    HTMLDJANGO_KIND_DJANGO_EXTENDS_TAG, // django_extends_tag
+    HTMLDJANGO_KIND_DJANGO_FILTER_BLOCK, // django_filter_block
+    HTMLDJANGO_KIND_DJANGO_FIRSTOF_TAG, // django_firstof_tag
+    HTMLDJANGO_KIND_DJANGO_FOR_BLOCK, // django_for_block
+    HTMLDJANGO_KIND_DJANGO_FOR_OPEN, // django_for_open
+    HTMLDJANGO_KIND_DJANGO_GENERIC_BLOCK, // django_generic_block
+    HTMLDJANGO_KIND_DJANGO_GENERIC_TAG, // django_generic_tag
+    HTMLDJANGO_KIND_DJANGO_IF_BLOCK, // django_if_block
+    HTMLDJANGO_KIND_DJANGO_IF_OPEN, // django_if_open
+    HTMLDJANGO_KIND_DJANGO_IFCHANGED_BLOCK, // django_ifchanged_block
+    HTMLDJANGO_KIND_DJANGO_INCLUDE_TAG, // django_include_tag
+    HTMLDJANGO_KIND_DJANGO_INTERPOLATION, // django_interpolation
+    HTMLDJANGO_KIND_DJANGO_LOAD_TAG, // django_load_tag
+    HTMLDJANGO_KIND_DJANGO_LOREM_TAG, // django_lorem_tag
+    HTMLDJANGO_KIND_DJANGO_NOW_TAG, // django_now_tag
+    HTMLDJANGO_KIND_DJANGO_PARTIAL_TAG, // django_partial_tag
+    HTMLDJANGO_KIND_DJANGO_PARTIALDEF_BLOCK, // django_partialdef_block
+    HTMLDJANGO_KIND_DJANGO_QUERYSTRING_TAG, // django_querystring_tag
+    HTMLDJANGO_KIND_DJANGO_REGROUP_TAG, // django_regroup_tag
+    HTMLDJANGO_KIND_DJANGO_RESETCYCLE_TAG, // django_resetcycle_tag
+    HTMLDJANGO_KIND_DJANGO_SPACELESS_BLOCK, // django_spaceless_block
+    HTMLDJANGO_KIND_DJANGO_TEMPLATETAG_TAG, // django_templatetag_tag
+    HTMLDJANGO_KIND_DJANGO_URL_TAG, // django_url_tag
+    HTMLDJANGO_KIND_DJANGO_VERBATIM_BLOCK, // django_verbatim_block
+    HTMLDJANGO_KIND_DJANGO_WIDTHRATIO_TAG, // django_widthratio_tag
+    HTMLDJANGO_KIND_DJANGO_WITH_BLOCK, // django_with_block
+    HTMLDJANGO_KIND_DJANGO_WITH_OPEN, // django_with_open
+    HTMLDJANGO_KIND_DOCTYPE, // doctype
+    HTMLDJANGO_KIND_DOCUMENT, // document
+    HTMLDJANGO_KIND_END_TAG, // end_tag
+    HTMLDJANGO_KIND_ERRONEOUS_END_TAG, // erroneous_end_tag
+    HTMLDJANGO_KIND_FILTER_ARGUMENT, // filter_argument
+    HTMLDJANGO_KIND_FILTER_CALL, // filter_call
+    HTMLDJANGO_KIND_FILTER_CHAIN, // filter_chain
+    HTMLDJANGO_KIND_FILTER_EXPRESSION, // filter_expression
+    HTMLDJANGO_KIND_FOREIGN_ELEMENT, // foreign_element
+    HTMLDJANGO_KIND_LOOKUP, // lookup
+    HTMLDJANGO_KIND_LOOP_VARIABLES, // loop_variables
+    HTMLDJANGO_KIND_NAMED_ARGUMENT, // named_argument
+    HTMLDJANGO_KIND_NORMAL_ELEMENT, // normal_element
+    HTMLDJANGO_KIND_NOT_EXPRESSION, // not_expression
+    HTMLDJANGO_KIND_OR_EXPRESSION, // or_expression
+    HTMLDJANGO_KIND_PLAINTEXT_ELEMENT, // plaintext_element
+    HTMLDJANGO_KIND_QUOTED_ATTRIBUTE_VALUE, // quoted_attribute_value
+    HTMLDJANGO_KIND_RAW_TEXT, // raw_text
+    HTMLDJANGO_KIND_RCDATA_ELEMENT, // rcdata_element
+    HTMLDJANGO_KIND_SCRIPT_ELEMENT, // script_element
+    HTMLDJANGO_KIND_START_TAG, // start_tag
+    HTMLDJANGO_KIND_STRING, // string
+    HTMLDJANGO_KIND_STYLE_ELEMENT, // style_element
+    HTMLDJANGO_KIND_TAG_ARGUMENT, // tag_argument
+    HTMLDJANGO_KIND_TEST_EXPRESSION, // test_expression
+    HTMLDJANGO_KIND_TEXT, // text
+    HTMLDJANGO_KIND_UNPAIRED_END_TAG, // unpaired_end_tag
+    HTMLDJANGO_KIND_UNPAIRED_START_TAG, // unpaired_start_tag
+    HTMLDJANGO_KIND_VOID_ELEMENT, // void_element
+    HTMLDJANGO_KIND_WITH_ASSIGNMENTS, // with_assignments
+    HTMLDJANGO_KIND_WITH_LEGACY, // with_legacy
+    HTMLDJANGO_KIND_ANON_DQUOTE, // "\""
+    HTMLDJANGO_KIND_ANON_PERCENT_RBRACE, // "%}"
+    HTMLDJANGO_KIND_ANON_SQUOTE, // "'"
+    HTMLDJANGO_KIND_ANON_COMMA, // ","
+    HTMLDJANGO_KIND_ANON_DOT, // "."
+    HTMLDJANGO_KIND_ANON_SLASH_GT, // "/>"
+    HTMLDJANGO_KIND_ANON_COLON, // ":"
+    HTMLDJANGO_KIND_ANON_LT, // "<"
+    HTMLDJANGO_KIND_ANON_LT_BANG, // "<!"
+    HTMLDJANGO_KIND_ANON_LT_SLASH, // "</"
+    HTMLDJANGO_KIND_ANON_EQ, // "="
+    HTMLDJANGO_KIND_ANON_GT, // ">"
+    HTMLDJANGO_KIND_ANON_AND, // "and"
+    HTMLDJANGO_KIND_AND_KEYWORD, // and_keyword
+    HTMLDJANGO_KIND_ARGUMENT_NAME, // argument_name
+    HTMLDJANGO_KIND_ANON_AS, // "as"
+    HTMLDJANGO_KIND_ANON_AUTOESCAPE, // "autoescape"
+    HTMLDJANGO_KIND_AUTOESCAPE_VALUE, // autoescape_value
+    HTMLDJANGO_KIND_ANON_BLOCK, // "block"
+    HTMLDJANGO_KIND_BLOCK_NAME, // block_name
+    HTMLDJANGO_KIND_ANON_BY, // "by"
+    HTMLDJANGO_KIND_COMMENT, // comment
+    HTMLDJANGO_KIND_ANON_COMMENT, // "comment"
+    HTMLDJANGO_KIND_COMMENT_CONTENT, // comment_content
+    HTMLDJANGO_KIND_COMMENT_TEXT, // comment_text
+    HTMLDJANGO_KIND_ANON_CSRF_TOKEN, // "csrf_token"
+    HTMLDJANGO_KIND_ANON_CYCLE, // "cycle"
+    HTMLDJANGO_KIND_CYCLE_NAME, // cycle_name
+    HTMLDJANGO_KIND_ANON_DEBUG, // "debug"
+    HTMLDJANGO_KIND_DJANGO_LINE_COMMENT, // django_line_comment
+    HTMLDJANGO_KIND_DOCTYPE_KEYWORD, // doctype_keyword
+    HTMLDJANGO_KIND_ANON_ELIF, // "elif"
+    HTMLDJANGO_KIND_ANON_ELSE, // "else"
+    HTMLDJANGO_KIND_ANON_EMPTY, // "empty"
+    HTMLDJANGO_KIND_END_TAG_NAME, // end_tag_name
+    HTMLDJANGO_KIND_ANON_ENDAUTOESCAPE, // "endautoescape"
+    HTMLDJANGO_KIND_ANON_ENDBLOCK, // "endblock"
+    HTMLDJANGO_KIND_ANON_ENDCOMMENT, // "endcomment"
+    HTMLDJANGO_KIND_ANON_ENDFILTER, // "endfilter"
+    HTMLDJANGO_KIND_ANON_ENDFOR, // "endfor"
+    HTMLDJANGO_KIND_ANON_ENDIF, // "endif"
+    HTMLDJANGO_KIND_ANON_ENDIFCHANGED, // "endifchanged"
+    HTMLDJANGO_KIND_ANON_ENDPARTIALDEF, // "endpartialdef"
+    HTMLDJANGO_KIND_ANON_ENDSPACELESS, // "endspaceless"
+    HTMLDJANGO_KIND_ANON_ENDWITH, // "endwith"
+    HTMLDJANGO_KIND_ENTITY, // entity
+    HTMLDJANGO_KIND_ERRONEOUS_END_TAG_NAME, // erroneous_end_tag_name
+    HTMLDJANGO_KIND_ANON_EXTENDS, // "extends"
+    HTMLDJANGO_KIND_ANON_FILTER, // "filter"
+    HTMLDJANGO_KIND_FILTER_NAME, // filter_name
+    HTMLDJANGO_KIND_ANON_FIRSTOF, // "firstof"
+    HTMLDJANGO_KIND_ANON_FOR, // "for"
+    HTMLDJANGO_KIND_ANON_FROM, // "from"
+    HTMLDJANGO_KIND_GENERIC_TAG_NAME, // generic_tag_name
+    HTMLDJANGO_KIND_I18N_STRING, // i18n_string
+    HTMLDJANGO_KIND_IDENTIFIER, // identifier
+    HTMLDJANGO_KIND_ANON_IF, // "if"
+    HTMLDJANGO_KIND_ANON_IFCHANGED, // "ifchanged"
+    HTMLDJANGO_KIND_IMPLICIT_END_TAG, // implicit_end_tag
+    HTMLDJANGO_KIND_ANON_IN, // "in"
+    HTMLDJANGO_KIND_ANON_INCLUDE, // "include"
+    HTMLDJANGO_KIND_INLINE, // inline
+    HTMLDJANGO_KIND_LIBRARY_NAME, // library_name
+    HTMLDJANGO_KIND_ANON_LOAD, // "load"
+    HTMLDJANGO_KIND_ANON_LOREM, // "lorem"
+    HTMLDJANGO_KIND_METHOD, // method
+    HTMLDJANGO_KIND_NAME_SEGMENT, // name_segment
+    HTMLDJANGO_KIND_ANON_NOT, // "not"
+    HTMLDJANGO_KIND_ANON_NOW, // "now"
+    HTMLDJANGO_KIND_NUMBER, // number
+    HTMLDJANGO_KIND_NUMERIC_INDEX, // numeric_index
+    HTMLDJANGO_KIND_ONLY, // only
+    HTMLDJANGO_KIND_OP_EQ, // op_eq
+    HTMLDJANGO_KIND_OP_GT, // op_gt
+    HTMLDJANGO_KIND_OP_GTE, // op_gte
+    HTMLDJANGO_KIND_OP_IN, // op_in
+    HTMLDJANGO_KIND_OP_IS, // op_is
+    HTMLDJANGO_KIND_OP_IS_NOT, // op_is_not
+    HTMLDJANGO_KIND_OP_LT, // op_lt
+    HTMLDJANGO_KIND_OP_LTE, // op_lte
+    HTMLDJANGO_KIND_OP_NE, // op_ne
+    HTMLDJANGO_KIND_OP_NOT_IN, // op_not_in
+    HTMLDJANGO_KIND_OR_KEYWORD, // or_keyword
+    HTMLDJANGO_KIND_ANON_PARTIAL, // "partial"
+    HTMLDJANGO_KIND_PARTIAL_NAME, // partial_name
+    HTMLDJANGO_KIND_ANON_PARTIALDEF, // "partialdef"
+    HTMLDJANGO_KIND_PLAINTEXT_TEXT, // plaintext_text
+    HTMLDJANGO_KIND_ANON_QUERYSTRING, // "querystring"
+    HTMLDJANGO_KIND_RANDOM, // random
+    HTMLDJANGO_KIND_RCDATA_TEXT, // rcdata_text
+    HTMLDJANGO_KIND_ANON_REGROUP, // "regroup"
+    HTMLDJANGO_KIND_ANON_RESETCYCLE, // "resetcycle"
+    HTMLDJANGO_KIND_REVERSED, // reversed
+    HTMLDJANGO_KIND_SILENT, // silent
+    HTMLDJANGO_KIND_ANON_SPACELESS, // "spaceless"
+    HTMLDJANGO_KIND_TAG_NAME, // tag_name
+    HTMLDJANGO_KIND_ANON_TEMPLATETAG, // "templatetag"
+    HTMLDJANGO_KIND_TEMPLATETAG_ARGUMENT, // templatetag_argument
+    HTMLDJANGO_KIND_ANON_URL, // "url"
+    HTMLDJANGO_KIND_VARIABLE_NAME, // variable_name
+    HTMLDJANGO_KIND_ANON_VERBATIM, // "verbatim"
+    HTMLDJANGO_KIND_VERBATIM_CONTENT, // verbatim_content
+    HTMLDJANGO_KIND_ANON_WIDTHRATIO, // "widthratio"
+    HTMLDJANGO_KIND_ANON_WITH, // "with"
+    HTMLDJANGO_KIND_ANON_LBRACE_PERCENT, // "{%"
+    HTMLDJANGO_KIND_ANON_LBRACE_LBRACE, // "{{"
+    HTMLDJANGO_KIND_ANON_PIPE, // "|"
+    HTMLDJANGO_KIND_ANON_RBRACE_RBRACE, // "}}"
+} HTMLDjangoKind;
+
+typedef enum {
+    HTMLDJANGO_FIELD_NONE,
+    HTMLDJANGO_FIELD_ALIAS,
+    HTMLDJANGO_FIELD_ARGUMENT,
+    HTMLDJANGO_FIELD_BODY,
+    HTMLDJANGO_FIELD_CONDITION,
+    HTMLDJANGO_FIELD_COUNT,
+    HTMLDJANGO_FIELD_END_NAME,
+    HTMLDJANGO_FIELD_FILTERS,
+    HTMLDJANGO_FIELD_FORMAT,
+    HTMLDJANGO_FIELD_GROUPER,
+    HTMLDJANGO_FIELD_ITERABLE,
+    HTMLDJANGO_FIELD_MAX_VALUE,
+    HTMLDJANGO_FIELD_MAX_WIDTH,
+    HTMLDJANGO_FIELD_NAME,
+    HTMLDJANGO_FIELD_SOURCE,
+    HTMLDJANGO_FIELD_TARGET,
+    HTMLDJANGO_FIELD_TEMPLATE,
+    HTMLDJANGO_FIELD_URL_NAME,
+    HTMLDJANGO_FIELD_VALUE,
+} HTMLDjangoField;
+
+#define HTMLDJANGO_NUM_KINDS 201
+#define HTMLDJANGO_NUM_FIELDS 19
+
+// Fills kinds[symbol] for each parser symbol below count, the way
+// ts_node_symbol() numbers them, and returns the number of symbols. Symbols
+// that never name a node map to HTMLDJANGO_KIND_ERROR, as does the ERROR
+// symbol (65535) itself, which is past the end of the table. Needs no
+// tree-sitter runtime.
+uint32_t htmldjango_symbol_kinds(uint16_t *kinds, uint32_t count);
+
+// The same for the parser's field IDs, including 0 for none
+uint32_t htmldjango_field_ids(uint16_t *fields, uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREE_SITTER_HTMLDJANGO_KINDS_H_
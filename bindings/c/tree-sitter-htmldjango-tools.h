@@ -0,0 +1,253 @@
+#ifndef TREE_SITTER_HTMLDJANGO_TOOLS_H_
+#define TREE_SITTER_HTMLDJANGO_TOOLS_H_
+
+// Companion library to tree-sitter-htmldjango for tools that process many
+// templates at once. Unlike the grammar itself, it links against the
+// tree-sitter runtime (and pthreads).
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <tree_sitter/api.h>
+
+#include "tree-sitter-htmldjango-blocks.h"
+#include "tree-sitter-htmldjango-cst.h"
+#include "tree-sitter-htmldjango-kinds.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Batch parsing
+// ============================================================================
+
+// One template to parse: either a buffer or, when source is NULL, a file.
+// The name is only passed back to the callback.
+typedef struct {
+    const char *source;
+    uint32_t length;
+    const char *path;
+} HTMLDjangoInput;
+
+typedef struct {
+    // 0, or the errno value from reading a path; the tree is then NULL
+    int read_error;
+    uint32_t bytes;
+    uint32_t node_count;
+    bool has_error;
+    double parse_seconds;
+    // The text that was parsed, whether passed in or read from the path. It
+    // is only valid until the callback returns, and NULL after a read error.
+    const char *source;
+} HTMLDjangoSummary;
+
+// Called once per input, from the worker thread that parsed it, so calls run
+// concurrently. worker is in [0, threads) and lets a callback keep per-thread
+// state without locking. Return true to take ownership of the tree (and
+// delete it with ts_tree_delete); otherwise it is deleted when the callback
+// returns.
+typedef bool (*HTMLDjangoBatchCallback)(void *payload, unsigned worker, size_t index,
+                                        TSTree *tree, const HTMLDjangoSummary *summary);
+
+typedef struct {
+    // Worker threads, each with its own parser; 0 uses one per online CPU
+    unsigned threads;
+    HTMLDjangoBatchCallback callback;
+    void *payload;
+} HTMLDjangoBatchOptions;
+
+// Parses every input on a pool of worker threads and returns the number of
+// inputs that could not be read, or -1 if memory runs out. Each worker starts
+// on its own contiguous share of the inputs and steals half of the remainder
+// of another worker's share once its own runs out, so a few large templates
+// do not leave the other threads idle. The calling thread is one of the
+// workers.
+long htmldjango_parse_batch(const HTMLDjangoInput *inputs, size_t count,
+                            const HTMLDjangoBatchOptions *options);
+
+// Number of workers htmldjango_parse_batch() uses for the given options
+unsigned htmldjango_batch_threads(const HTMLDjangoBatchOptions *options);
+
+// ============================================================================
+// Memory-mapped files
+// ============================================================================
+
+// A read-only mapping of a whole file. An empty file has data == NULL.
+typedef struct {
+    const char *data;
+    uint32_t length;
+} HTMLDjangoMappedFile;
+
+// Maps a file and returns 0, or an errno value. Files of 4 GiB or more, which
+// tree-sitter's 32-bit byte offsets cannot address, fail with EFBIG.
+int htmldjango_map_file(const char *path, HTMLDjangoMappedFile *file);
+
+void htmldjango_unmap_file(HTMLDjangoMappedFile *file);
+
+// A TSInput whose read callback hands the parser pointers into the mapping,
+// so no byte of the file is copied. The mapping must outlive the parse.
+TSInput htmldjango_mapped_input(const HTMLDjangoMappedFile *file);
+
+// Maps a file, parses it and unmaps it again, so a large template never has
+// a heap copy. Keep the file mapped with htmldjango_map_file() instead when
+// node text is needed afterwards. On failure returns NULL and sets *error to
+// an errno value, or to 0 when the parser itself gave up (cancellation or
+// timeout).
+TSTree *htmldjango_parse_file(TSParser *parser, const TSTree *old_tree, const char *path, int *error);
+
+// ============================================================================
+// Dependency extraction
+// ============================================================================
+
+typedef enum {
+    HTMLDjangoDependencyExtends,
+    HTMLDjangoDependencyInclude,
+    HTMLDjangoDependencyLoad,
+    HTMLDjangoDependencyPartial,
+} HTMLDjangoDependencyKind;
+
+// A template, tag library or partial that a template depends on. target
+// points into the source: a template name without its quotes (escapes are
+// left as written), a library name or a partial name. The byte range is the
+// whole tag.
+typedef struct {
+    HTMLDjangoDependencyKind kind;
+    const char *target;
+    uint32_t target_length;
+    uint32_t start_byte;
+    uint32_t end_byte;
+} HTMLDjangoDependency;
+
+// Return false to stop the extraction
+typedef bool (*HTMLDjangoDependencyCallback)(void *payload, const HTMLDjangoDependency *dependency);
+
+// Streams the static dependencies of a template to callback in source order
+// and returns how many were found: {% extends %} and {% include %} with a
+// string literal, every library of {% load %} (or the one after "from"), and
+// {% partial %}. It only tokenizes Django tags, without parsing or building a
+// tree, and allocates nothing. Tags inside comment and verbatim blocks are
+// skipped; tags inside HTML comments are not, since Django renders them.
+size_t htmldjango_extract_dependencies(const char *source, uint32_t length,
+                                       HTMLDjangoDependencyCallback callback, void *payload);
+
+// ============================================================================
+// Project index
+// ============================================================================
+
+// Bump when the summaries change, so that older caches are rebuilt
+#define HTMLDJANGO_INDEX_FORMAT_VERSION 1
+
+typedef enum {
+    HTMLDjangoIndexBlock,
+    HTMLDjangoIndexExtends,
+    HTMLDjangoIndexInclude,
+    HTMLDjangoIndexLoad,
+    HTMLDjangoIndexCustomTag,
+} HTMLDjangoIndexRecordKind;
+
+// Template names are literal {% extends %} and {% include %} arguments without
+// their quotes. Custom tags are tags the grammar parses as generic tags or
+// blocks. Each (kind, name) pair appears once per file.
+typedef struct {
+    HTMLDjangoIndexRecordKind kind;
+    const char *name;
+} HTMLDjangoIndexRecord;
+
+typedef struct {
+    // Relative to the indexed directory, with '/' separators
+    const char *path;
+    // 64-bit FNV-1a of the content
+    uint64_t hash;
+    bool has_error;
+    uint32_t record_count;
+    const HTMLDjangoIndexRecord *records;
+} HTMLDjangoIndexedFile;
+
+typedef struct {
+    size_t files;
+    size_t parsed;
+    size_t reused;
+    size_t removed;
+    size_t unreadable;
+} HTMLDjangoIndexStats;
+
+typedef struct HTMLDjangoIndex HTMLDjangoIndex;
+
+HTMLDjangoIndex *htmldjango_index_new(void);
+
+void htmldjango_index_delete(HTMLDjangoIndex *index);
+
+// Replaces the index with a cache written by htmldjango_index_save() and
+// returns 0, or an errno value. A cache from another format version, or one
+// that is truncated, fails with EINVAL and leaves the index empty.
+int htmldjango_index_load(HTMLDjangoIndex *index, const char *path);
+
+// Writes the index to a temporary file next to path and renames it over path
+int htmldjango_index_save(const HTMLDjangoIndex *index, const char *path);
+
+// Brings the index up to date with the template files (.html, .htm, .django,
+// .htmldjango) under root, skipping dot files and directories. Symlinks are
+// followed, except to a directory the walk is already inside. Every file is
+// hashed, but only files that are new or whose hash changed are parsed, on
+// the given number of threads (0 for one per online CPU). Summaries of
+// unchanged files are kept, and those of deleted files are dropped, so edges
+// are only recomputed for the files that changed. Returns 0, or an errno
+// value if root cannot be read.
+int htmldjango_index_update(HTMLDjangoIndex *index, const char *root, unsigned threads,
+                            HTMLDjangoIndexStats *stats);
+
+// Files sorted by path
+size_t htmldjango_index_file_count(const HTMLDjangoIndex *index);
+
+const HTMLDjangoIndexedFile *htmldjango_index_file(const HTMLDjangoIndex *index, size_t i);
+
+// The file a template name refers to: the one whose path is the name, or
+// failing that, the first one whose path ends in '/' and the name (a name
+// relative to an app's templates directory). NULL if there is none.
+const HTMLDjangoIndexedFile *htmldjango_index_resolve(const HTMLDjangoIndex *index, const char *name);
+
+// The nearest template up the {% extends %} chain of file that also defines
+// block, i.e. the one file's block overrides, or NULL if it defines it first
+const HTMLDjangoIndexedFile *htmldjango_index_overridden(const HTMLDjangoIndex *index,
+                                                        const HTMLDjangoIndexedFile *file,
+                                                        const char *block);
+
+// ============================================================================
+// Node kinds
+// ============================================================================
+
+// The stable kind ID (HTMLDjangoKind) of a node or parser symbol, for
+// switching on instead of comparing ts_node_type() strings. The table behind
+// them is built from htmldjango_symbol_kinds() on first use.
+uint16_t htmldjango_node_kind(TSNode node);
+uint16_t htmldjango_kind_for_symbol(TSSymbol symbol);
+
+// The stable field ID (HTMLDjangoField) of a parser field ID, such as
+// ts_tree_cursor_current_field_id() returns
+uint16_t htmldjango_field_for_id(TSFieldId field);
+
+// ============================================================================
+// Binary trees
+// ============================================================================
+
+// Zero-initialize before the first write; later writes reuse the memory
+typedef struct {
+    uint8_t *data;
+    size_t length;
+    size_t capacity;
+} HTMLDjangoCSTBuffer;
+
+// Replaces the contents of buffer with tree in the format described in
+// tree-sitter-htmldjango-cst.h. Returns 0, ENOMEM, EINVAL if tree is not a
+// tree_sitter_htmldjango() tree, or EFBIG if the buffer would reach 4 GiB.
+int htmldjango_cst_write(const TSTree *tree, HTMLDjangoCSTBuffer *buffer);
+
+void htmldjango_cst_buffer_delete(HTMLDjangoCSTBuffer *buffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREE_SITTER_HTMLDJANGO_TOOLS_H_
@@ -8,6 +8,7 @@ extern "C" {
 #endif
 
 const TSLanguage *tree_sitter_htmldjango(void);
+const TSLanguage *tree_sitter_htmldjango_expression(void);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,376 @@
+#ifndef TREE_SITTER_HTMLDJANGO_HPP_
+#define TREE_SITTER_HTMLDJANGO_HPP_
+
+// Header-only C++17 wrapper over the tree-sitter runtime for this grammar.
+// Parser, Tree, TreeCursor, Query and QueryCursor own their handles and are
+// move-only; get() returns the raw handle for anything not wrapped here.
+// walk() visits a tree with a visitor whose overloads are chosen by node kind
+// at compile time. Needs the grammar library and the tree-sitter runtime, not
+// the tools library.
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <tree_sitter/api.h>
+
+#include "tree-sitter-htmldjango-kinds.h"
+#include "tree-sitter-htmldjango.h"
+
+namespace htmldjango {
+
+namespace detail {
+
+template <typename T, void (*Delete)(T *)> struct Deleter {
+    void operator()(T *handle) const noexcept { Delete(handle); }
+};
+
+template <typename T, void (*Delete)(T *)> using Handle = std::unique_ptr<T, Deleter<T, Delete>>;
+
+inline const std::vector<uint16_t> &symbol_kinds() {
+    static const std::vector<uint16_t> kinds = [] {
+        std::vector<uint16_t> table(htmldjango_symbol_kinds(nullptr, 0));
+        htmldjango_symbol_kinds(table.data(), static_cast<uint32_t>(table.size()));
+        return table;
+    }();
+    return kinds;
+}
+
+inline const std::vector<uint16_t> &field_ids() {
+    static const std::vector<uint16_t> fields = [] {
+        std::vector<uint16_t> table(htmldjango_field_ids(nullptr, 0));
+        htmldjango_field_ids(table.data(), static_cast<uint32_t>(table.size()));
+        return table;
+    }();
+    return fields;
+}
+
+} // namespace detail
+
+// ============================================================================
+// Node kinds
+// ============================================================================
+
+// The stable kind of a parser symbol, from tree-sitter-htmldjango-kinds.h.
+// Only meaningful for trees of tree_sitter_htmldjango(), not the expression
+// language. The ERROR symbol and unknown symbols give HTMLDJANGO_KIND_ERROR.
+inline uint16_t kind_of(TSSymbol symbol) {
+    const std::vector<uint16_t> &kinds = detail::symbol_kinds();
+    return symbol < kinds.size() ? kinds[symbol] : uint16_t{HTMLDJANGO_KIND_ERROR};
+}
+
+inline uint16_t kind_of(TSNode node) { return kind_of(ts_node_symbol(node)); }
+
+// The stable field of a parser field ID, HTMLDJANGO_FIELD_NONE for 0
+inline uint16_t field_of(TSFieldId field) {
+    const std::vector<uint16_t> &fields = detail::field_ids();
+    return field < fields.size() ? fields[field] : uint16_t{HTMLDJANGO_FIELD_NONE};
+}
+
+// The source text of a node
+inline std::string_view text(TSNode node, std::string_view source) {
+    uint32_t start = ts_node_start_byte(node);
+    return source.substr(start, ts_node_end_byte(node) - start);
+}
+
+// ============================================================================
+// Owners
+// ============================================================================
+
+class Tree {
+  public:
+    Tree() = default;
+    explicit Tree(TSTree *tree) : tree_(tree) {}
+
+    explicit operator bool() const { return tree_ != nullptr; }
+    TSTree *get() const { return tree_.get(); }
+    TSTree *release() { return tree_.release(); }
+
+    TSNode root() const { return ts_tree_root_node(tree_.get()); }
+    const TSLanguage *language() const { return ts_tree_language(tree_.get()); }
+
+    // A cheap shallow copy that can be used on another thread
+    Tree copy() const { return Tree(ts_tree_copy(tree_.get())); }
+
+    void edit(const TSInputEdit &edit) { ts_tree_edit(tree_.get(), &edit); }
+
+  private:
+    detail::Handle<TSTree, ts_tree_delete> tree_;
+};
+
+class Parser {
+  public:
+    explicit Parser(const TSLanguage *language = tree_sitter_htmldjango()) : parser_(ts_parser_new()) {
+        if (!ts_parser_set_language(parser_.get(), language)) {
+            throw std::runtime_error("tree-sitter-htmldjango: the language version does not match the runtime");
+        }
+    }
+
+    TSParser *get() const { return parser_.get(); }
+    const TSLanguage *language() const { return ts_parser_language(parser_.get()); }
+
+    // The tree is empty only if the parse was cancelled or timed out
+    Tree parse(std::string_view source, const Tree *old_tree = nullptr) {
+        if (source.size() > UINT32_MAX) throw std::length_error("tree-sitter-htmldjango: source is 4 GiB or larger");
+        return Tree(ts_parser_parse_string(parser_.get(), old_tree ? old_tree->get() : nullptr, source.data(),
+                                           static_cast<uint32_t>(source.size())));
+    }
+
+    void reset() { ts_parser_reset(parser_.get()); }
+
+  private:
+    detail::Handle<TSParser, ts_parser_delete> parser_;
+};
+
+// TSTreeCursor is a value rather than a pointer, so this one tracks whether
+// it still owns it
+class TreeCursor {
+  public:
+    explicit TreeCursor(TSNode node) : cursor_(ts_tree_cursor_new(node)), owned_(true) {}
+    TreeCursor(TreeCursor &&other) noexcept : cursor_(other.cursor_), owned_(std::exchange(other.owned_, false)) {}
+    TreeCursor &operator=(TreeCursor &&other) noexcept {
+        if (this != &other) {
+            if (owned_) ts_tree_cursor_delete(&cursor_);
+            cursor_ = other.cursor_;
+            owned_ = std::exchange(other.owned_, false);
+        }
+        return *this;
+    }
+    TreeCursor(const TreeCursor &) = delete;
+    TreeCursor &operator=(const TreeCursor &) = delete;
+    ~TreeCursor() {
+        if (owned_) ts_tree_cursor_delete(&cursor_);
+    }
+
+    TSTreeCursor *get() { return &cursor_; }
+
+    TSNode node() const { return ts_tree_cursor_current_node(&cursor_); }
+    TSFieldId field_id() const { return ts_tree_cursor_current_field_id(&cursor_); }
+    uint32_t depth() const { return ts_tree_cursor_current_depth(&cursor_); }
+
+    bool goto_first_child() { return ts_tree_cursor_goto_first_child(&cursor_); }
+    bool goto_next_sibling() { return ts_tree_cursor_goto_next_sibling(&cursor_); }
+    bool goto_parent() { return ts_tree_cursor_goto_parent(&cursor_); }
+    void reset(TSNode node) { ts_tree_cursor_reset(&cursor_, node); }
+
+  private:
+    TSTreeCursor cursor_;
+    bool owned_;
+};
+
+// Thrown when a query does not compile
+class QueryError : public std::runtime_error {
+  public:
+    QueryError(TSQueryError type, uint32_t offset)
+        : std::runtime_error("tree-sitter-htmldjango: query error " + std::to_string(type) + " at byte " +
+                             std::to_string(offset)),
+          type_(type), offset_(offset) {}
+
+    TSQueryError type() const { return type_; }
+    uint32_t offset() const { return offset_; }
+
+  private:
+    TSQueryError type_;
+    uint32_t offset_;
+};
+
+class Query {
+  public:
+    explicit Query(std::string_view source, const TSLanguage *language = tree_sitter_htmldjango()) {
+        uint32_t offset = 0;
+        TSQueryError type = TSQueryErrorNone;
+        query_.reset(ts_query_new(language, source.data(), static_cast<uint32_t>(source.size()), &offset, &type));
+        if (!query_) throw QueryError(type, offset);
+    }
+
+    TSQuery *get() const { return query_.get(); }
+
+    uint32_t pattern_count() const { return ts_query_pattern_count(query_.get()); }
+    uint32_t capture_count() const { return ts_query_capture_count(query_.get()); }
+
+    std::string_view capture_name(uint32_t index) const {
+        uint32_t length = 0;
+        const char *name = ts_query_capture_name_for_id(query_.get(), index, &length);
+        return std::string_view(name, length);
+    }
+
+  private:
+    detail::Handle<TSQuery, ts_query_delete> query_;
+};
+
+class QueryCursor {
+  public:
+    QueryCursor() : cursor_(ts_query_cursor_new()) {}
+
+    TSQueryCursor *get() const { return cursor_.get(); }
+
+    // The query must outlive the matches
+    void exec(const Query &query, TSNode node) { ts_query_cursor_exec(cursor_.get(), query.get(), node); }
+    bool next_match(TSQueryMatch &match) { return ts_query_cursor_next_match(cursor_.get(), &match); }
+    bool next_capture(TSQueryMatch &match, uint32_t &capture_index) {
+        return ts_query_cursor_next_capture(cursor_.get(), &match, &capture_index);
+    }
+
+  private:
+    detail::Handle<TSQueryCursor, ts_query_cursor_delete> cursor_;
+};
+
+// ============================================================================
+// Parser pool
+// ============================================================================
+
+// Hands out parsers for one language so that threads reuse them instead of
+// creating one per parse. acquire() may be called from any thread; each lease
+// is used by one thread at a time and must not outlive the pool.
+class ParserPool {
+  public:
+    class Lease {
+      public:
+        Lease(Lease &&other) noexcept
+            : pool_(std::exchange(other.pool_, nullptr)), parser_(std::move(other.parser_)) {}
+        Lease &operator=(Lease &&other) noexcept {
+            if (this != &other) {
+                give_back();
+                pool_ = std::exchange(other.pool_, nullptr);
+                parser_ = std::move(other.parser_);
+            }
+            return *this;
+        }
+        ~Lease() { give_back(); }
+
+        Parser &operator*() { return *parser_; }
+        Parser *operator->() { return parser_.get(); }
+
+      private:
+        friend class ParserPool;
+        Lease(ParserPool *pool, std::unique_ptr<Parser> parser) : pool_(pool), parser_(std::move(parser)) {}
+
+        void give_back() noexcept {
+            if (pool_ && parser_) pool_->release(std::move(parser_));
+            pool_ = nullptr;
+        }
+
+        ParserPool *pool_;
+        std::unique_ptr<Parser> parser_;
+    };
+
+    // Keeps at most max_idle returned parsers; 0 keeps all of them
+    explicit ParserPool(const TSLanguage *language = tree_sitter_htmldjango(), size_t max_idle = 0)
+        : language_(language), max_idle_(max_idle) {}
+    ParserPool(const ParserPool &) = delete;
+    ParserPool &operator=(const ParserPool &) = delete;
+
+    Lease acquire() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!idle_.empty()) {
+                std::unique_ptr<Parser> parser = std::move(idle_.back());
+                idle_.pop_back();
+                return Lease(this, std::move(parser));
+            }
+        }
+        return Lease(this, std::make_unique<Parser>(language_));
+    }
+
+    Tree parse(std::string_view source) { return acquire()->parse(source); }
+
+    size_t idle() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return idle_.size();
+    }
+
+  private:
+    // A parse that was cancelled leaves state behind, so parsers are reset
+    // before the next lease. A parser that cannot be kept is deleted.
+    void release(std::unique_ptr<Parser> parser) noexcept {
+        parser->reset();
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (max_idle_ && idle_.size() >= max_idle_) return;
+        try {
+            idle_.push_back(std::move(parser));
+        } catch (const std::bad_alloc &) {
+        }
+    }
+
+    const TSLanguage *language_;
+    size_t max_idle_;
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<Parser>> idle_;
+};
+
+// ============================================================================
+// Visitors
+// ============================================================================
+
+// Tag type for one node kind. A visitor handles a kind by overloading
+// operator()(Kind<HTMLDJANGO_KIND_...>, TSNode); returning false from it skips
+// the node's children. Kinds without an overload are passed over.
+template <uint16_t K> struct Kind {
+    static constexpr uint16_t value = K;
+};
+
+namespace detail {
+
+template <typename Visitor, uint16_t K>
+constexpr bool handles = std::is_invocable_v<Visitor &, Kind<K>, TSNode>;
+
+template <typename Visitor, uint16_t K>
+inline bool dispatch_one(Visitor &visitor, uint16_t kind, TSNode node, bool &descend) {
+    if constexpr (handles<Visitor, K>) {
+        if (kind == K) {
+            if constexpr (std::is_same_v<std::invoke_result_t<Visitor &, Kind<K>, TSNode>, bool>) {
+                descend = visitor(Kind<K>{}, node);
+            } else {
+                visitor(Kind<K>{}, node);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+// Expands to one comparison per kind the visitor handles, which the compiler
+// turns into a jump table or a short branch chain
+template <typename Visitor, uint16_t... Kinds>
+inline bool dispatch(Visitor &visitor, uint16_t kind, TSNode node, std::integer_sequence<uint16_t, Kinds...>) {
+    bool descend = true;
+    (dispatch_one<Visitor, Kinds>(visitor, kind, node, descend) || ...);
+    return descend;
+}
+
+} // namespace detail
+
+// Calls the visitor's overload for the node's kind, if it has one, and returns
+// whether to visit the node's children
+template <typename Visitor> bool visit(Visitor &visitor, TSNode node) {
+    return detail::dispatch(visitor, kind_of(node), node,
+                            std::make_integer_sequence<uint16_t, HTMLDJANGO_NUM_KINDS>{});
+}
+
+// Visits node and its descendants in pre-order
+template <typename Visitor> void walk(TSNode node, Visitor &&visitor) {
+    const std::vector<uint16_t> &kinds = detail::symbol_kinds();
+    TreeCursor cursor(node);
+    for (;;) {
+        TSNode current = cursor.node();
+        TSSymbol symbol = ts_node_symbol(current);
+        uint16_t kind = symbol < kinds.size() ? kinds[symbol] : uint16_t{HTMLDJANGO_KIND_ERROR};
+        if (detail::dispatch(visitor, kind, current, std::make_integer_sequence<uint16_t, HTMLDJANGO_NUM_KINDS>{}) &&
+            cursor.goto_first_child()) {
+            continue;
+        }
+        while (!cursor.goto_next_sibling()) {
+            if (!cursor.goto_parent()) return;
+        }
+    }
+}
+
+} // namespace htmldjango
+
+#endif // TREE_SITTER_HTMLDJANGO_HPP_
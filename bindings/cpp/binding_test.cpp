@@ -0,0 +1,176 @@
+// Tests for tree-sitter-htmldjango.hpp. Exits non-zero if any check fails.
+
+#include "tree-sitter-htmldjango.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+#define CHECK(condition)                                                                                               \
+    do {                                                                                                               \
+        if (!(condition)) {                                                                                            \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);                         \
+            failures++;                                                                                                \
+        }                                                                                                              \
+    } while (0)
+
+const std::string SOURCE = "{% extends \"base.html\" %}"
+                           "{% block content %}<p class=\"lead\">{{ user.name|upper }}</p>"
+                           "{% if user %}{% include \"card.html\" %}{% endif %}{% endblock %}";
+
+static_assert(!std::is_copy_constructible_v<htmldjango::Parser>);
+static_assert(!std::is_copy_constructible_v<htmldjango::Tree>);
+static_assert(!std::is_copy_constructible_v<htmldjango::TreeCursor>);
+static_assert(!std::is_copy_constructible_v<htmldjango::Query>);
+static_assert(!std::is_copy_constructible_v<htmldjango::QueryCursor>);
+static_assert(!std::is_copy_constructible_v<htmldjango::ParserPool::Lease>);
+static_assert(std::is_nothrow_move_constructible_v<htmldjango::Parser>);
+static_assert(std::is_nothrow_move_constructible_v<htmldjango::Tree>);
+static_assert(std::is_nothrow_move_constructible_v<htmldjango::TreeCursor>);
+static_assert(std::is_nothrow_move_constructible_v<htmldjango::ParserPool::Lease>);
+
+struct Counter {
+    unsigned blocks = 0, elements = 0, interpolations = 0, includes = 0, text = 0;
+
+    void operator()(htmldjango::Kind<HTMLDJANGO_KIND_DJANGO_BLOCK_BLOCK>, TSNode) { blocks++; }
+    void operator()(htmldjango::Kind<HTMLDJANGO_KIND_NORMAL_ELEMENT>, TSNode) { elements++; }
+    void operator()(htmldjango::Kind<HTMLDJANGO_KIND_DJANGO_INTERPOLATION>, TSNode) { interpolations++; }
+    void operator()(htmldjango::Kind<HTMLDJANGO_KIND_DJANGO_INCLUDE_TAG>, TSNode) { includes++; }
+    void operator()(htmldjango::Kind<HTMLDJANGO_KIND_TEXT>, TSNode) { text++; }
+};
+
+// Stops at {% if %} blocks, so the include inside one is never seen
+struct SkipIf {
+    unsigned includes = 0;
+
+    bool operator()(htmldjango::Kind<HTMLDJANGO_KIND_DJANGO_IF_BLOCK>, TSNode) { return false; }
+    void operator()(htmldjango::Kind<HTMLDJANGO_KIND_DJANGO_INCLUDE_TAG>, TSNode) { includes++; }
+};
+
+unsigned count_type(TSNode node, const char *type) {
+    unsigned count = std::strcmp(ts_node_type(node), type) == 0;
+    for (uint32_t i = 0; i < ts_node_child_count(node); i++) count += count_type(ts_node_child(node, i), type);
+    return count;
+}
+
+void test_parse() {
+    htmldjango::Parser parser;
+    htmldjango::Tree tree = parser.parse(SOURCE);
+    CHECK(tree);
+    CHECK(!ts_node_has_error(tree.root()));
+    CHECK(htmldjango::kind_of(tree.root()) == HTMLDJANGO_KIND_DOCUMENT);
+
+    TSNode extends = ts_node_named_child(tree.root(), 0);
+    CHECK(htmldjango::kind_of(extends) == HTMLDJANGO_KIND_DJANGO_EXTENDS_TAG);
+    CHECK(htmldjango::text(extends, SOURCE) == "{% extends \"base.html\" %}");
+    CHECK(htmldjango::kind_of(TSSymbol{0xFFFF}) == HTMLDJANGO_KIND_ERROR);
+    CHECK(htmldjango::field_of(0) == HTMLDJANGO_FIELD_NONE);
+
+    // Moving hands over the tree and leaves the source empty
+    htmldjango::Tree moved = std::move(tree);
+    CHECK(moved && !tree);
+    htmldjango::Tree copy = moved.copy();
+    CHECK(copy && copy.get() != moved.get());
+}
+
+void test_walk() {
+    htmldjango::Parser parser;
+    htmldjango::Tree tree = parser.parse(SOURCE);
+
+    Counter counter;
+    htmldjango::walk(tree.root(), counter);
+    CHECK(counter.blocks == 1);
+    CHECK(counter.elements == 1);
+    CHECK(counter.interpolations == 1);
+    CHECK(counter.includes == 1);
+
+    // The same count as comparing type names
+    CHECK(counter.text == count_type(tree.root(), "text"));
+
+    SkipIf skip;
+    htmldjango::walk(tree.root(), skip);
+    CHECK(skip.includes == 0);
+
+    // visit() dispatches one node without walking
+    Counter single;
+    CHECK(htmldjango::visit(single, ts_node_named_child(tree.root(), 1)));
+    CHECK(single.blocks == 1 && single.elements == 0);
+}
+
+void test_query() {
+    htmldjango::Query query("(django_include_tag) @include (normal_element) @element");
+    CHECK(query.pattern_count() == 2);
+    CHECK(query.capture_name(0) == "include");
+
+    htmldjango::Parser parser;
+    htmldjango::Tree tree = parser.parse(SOURCE);
+    htmldjango::QueryCursor cursor;
+    cursor.exec(query, tree.root());
+    TSQueryMatch match;
+    unsigned matches = 0;
+    while (cursor.next_match(match)) matches++;
+    CHECK(matches == 2);
+
+    bool threw = false;
+    try {
+        htmldjango::Query broken("(django_include_tag @include");
+    } catch (const htmldjango::QueryError &error) {
+        threw = error.type() == TSQueryErrorSyntax;
+    }
+    CHECK(threw);
+}
+
+void test_pool() {
+    htmldjango::ParserPool pool;
+    {
+        htmldjango::ParserPool::Lease first = pool.acquire();
+        htmldjango::ParserPool::Lease second = pool.acquire();
+        CHECK(first->get() != second->get());
+        CHECK(pool.idle() == 0);
+    }
+    CHECK(pool.idle() == 2);
+
+    std::vector<std::thread> threads;
+    std::vector<unsigned> blocks(4);
+    for (size_t i = 0; i < blocks.size(); i++) {
+        threads.emplace_back([&pool, &blocks, i] {
+            for (int j = 0; j < 25; j++) {
+                Counter counter;
+                htmldjango::walk(pool.parse(SOURCE).root(), counter);
+                blocks[i] += counter.blocks;
+            }
+        });
+    }
+    for (std::thread &thread : threads) thread.join();
+    for (unsigned count : blocks) CHECK(count == 25);
+    CHECK(pool.idle() >= 2 && pool.idle() <= blocks.size());
+
+    htmldjango::ParserPool bounded(tree_sitter_htmldjango(), 1);
+    {
+        htmldjango::ParserPool::Lease first = bounded.acquire();
+        htmldjango::ParserPool::Lease second = bounded.acquire();
+    }
+    CHECK(bounded.idle() == 1);
+}
+
+} // namespace
+
+int main() {
+    test_parse();
+    test_walk();
+    test_query();
+    test_pool();
+    if (failures) {
+        std::fprintf(stderr, "%d checks failed\n", failures);
+        return 1;
+    }
+    std::puts("all checks passed");
+    return 0;
+}
@@ -13,3 +13,46 @@ func TestCanLoadGrammar(t *testing.T) {
 		t.Errorf("Error loading HTML grammar")
 	}
 }
+
+func TestCanLoadExpressionGrammar(t *testing.T) {
+	language := tree_sitter.NewLanguage(tree_sitter_html.LanguageExpression())
+	if language == nil {
+		t.Errorf("Error loading Django expression grammar")
+	}
+}
+
+func TestBlockMap(t *testing.T) {
+	source := []byte("{% block content %}{{ block.super }}{% block inner %}x{% endblock %}{% endblock %}")
+	blocks := tree_sitter_html.BlockMap(source)
+	if len(blocks.Blocks) != 2 || blocks.Blocks[1].Name != "inner" || blocks.Blocks[1].Parent != 0 {
+		t.Errorf("Unexpected blocks %+v", blocks.Blocks)
+	}
+	if inner := blocks.Blocks[1]; string(source[inner.ContentStartByte:inner.ContentEndByte]) != "x" {
+		t.Errorf("Unexpected content range %+v", inner)
+	}
+	if len(blocks.Supers) != 1 || blocks.Supers[0].Block != 0 {
+		t.Errorf("Unexpected supers %+v", blocks.Supers)
+	}
+}
+
+func TestKindOf(t *testing.T) {
+	language := tree_sitter.NewLanguage(tree_sitter_html.Language())
+	parser := tree_sitter.NewParser()
+	defer parser.Close()
+	parser.SetLanguage(language)
+	tree := parser.Parse([]byte("{% block content %}<p>{{ x }}</p>{% endblock %}"), nil)
+	defer tree.Close()
+	block := tree.RootNode().Child(0)
+	if kind := tree_sitter_html.KindOf(block.KindId()); kind != tree_sitter_html.KindDjangoBlockBlock {
+		t.Errorf("Unexpected kind %d for %s", kind, block.Kind())
+	}
+	for symbol := uint16(0); symbol < uint16(language.NodeKindCount()); symbol++ {
+		kind := tree_sitter_html.KindOf(symbol)
+		if kind != tree_sitter_html.KindError && tree_sitter_html.KindNames[kind] != language.NodeKindForId(symbol) {
+			t.Errorf("Symbol %d maps to %s", symbol, tree_sitter_html.KindNames[kind])
+		}
+	}
+	if tree_sitter_html.KindOf(0xFFFF) != tree_sitter_html.KindError {
+		t.Errorf("ERROR symbol does not map to KindError")
+	}
+}
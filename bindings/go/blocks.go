@@ -0,0 +1,96 @@
+package tree_sitter_htmldjango
+
+// #cgo CFLAGS: -std=c11 -fPIC -I../c
+// #include "../../tools/blocks.c"
+import "C"
+
+import (
+	"math"
+	"unsafe"
+)
+
+// A {% block %} tag pair found by BlockMap. Offsets are in bytes.
+type Block struct {
+	Name string
+	// From the start of {% block %} to the end of {% endblock %}
+	StartByte, EndByte uint32
+	// Between the two tags
+	ContentStartByte, ContentEndByte uint32
+	// 0 for a top-level block
+	Depth uint32
+	// Index of the enclosing block in Blocks, or -1
+	Parent int
+	// {{ block.super }} usages directly in this block, not in nested ones
+	SuperCount uint32
+	// False if the source ends first; the block then runs to the end
+	Closed bool
+}
+
+// A {{ block.super }} usage in the block at index Block.
+type BlockSuper struct {
+	Block              int
+	StartByte, EndByte uint32
+}
+
+// The blocks of a template, in the order their opening tags appear (so a
+// block's parent always comes before it), and the {{ block.super }} usages in
+// source order.
+type Blocks struct {
+	Blocks []Block
+	Supers []BlockSuper
+}
+
+// Find the {% block %} tags and {{ block.super }} usages in a template, for
+// resolving {% extends %} chains. This is a native scan of the source rather
+// than a tree walk, so it needs no parser. Tags inside comment and verbatim
+// blocks are skipped.
+func BlockMap(source []byte) Blocks {
+	if uint64(len(source)) > math.MaxUint32 {
+		panic("tree_sitter_htmldjango: source is larger than 4 GiB")
+	}
+	var data *C.char
+	if len(source) > 0 {
+		data = (*C.char)(unsafe.Pointer(&source[0]))
+	}
+	var native C.HTMLDjangoBlockMap
+	ok := C.htmldjango_block_map_build(&native, data, C.uint32_t(len(source)))
+	defer C.htmldjango_block_map_delete(&native)
+	if !ok {
+		panic("tree_sitter_htmldjango: out of memory")
+	}
+
+	result := Blocks{
+		Blocks: make([]Block, native.block_count),
+		Supers: make([]BlockSuper, native.super_count),
+	}
+	if native.block_count > 0 {
+		for i, block := range unsafe.Slice(native.blocks, native.block_count) {
+			start := uintptr(unsafe.Pointer(block.name)) - uintptr(unsafe.Pointer(data))
+			parent := -1
+			if block.parent != math.MaxUint32 {
+				parent = int(block.parent)
+			}
+			result.Blocks[i] = Block{
+				Name:             string(source[start : start+uintptr(block.name_length)]),
+				StartByte:        uint32(block.start_byte),
+				EndByte:          uint32(block.end_byte),
+				ContentStartByte: uint32(block.content_start_byte),
+				ContentEndByte:   uint32(block.content_end_byte),
+				Depth:            uint32(block.depth),
+				Parent:           parent,
+				SuperCount:       uint32(block.super_count),
+				Closed:           bool(block.closed),
+			}
+		}
+	}
+	if native.super_count > 0 {
+		for i, usage := range unsafe.Slice(native.supers, native.super_count) {
+			result.Supers[i] = BlockSuper{
+				Block:     int(usage.block),
+				StartByte: uint32(usage.start_byte),
+				EndByte:   uint32(usage.end_byte),
+			}
+		}
+	}
+	return result
+}
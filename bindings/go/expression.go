@@ -0,0 +1,13 @@
+package tree_sitter_htmldjango
+
+// #cgo CFLAGS: -std=c11 -fPIC
+// #include "../../expression/src/parser.c"
+// #include "../../expression/src/scanner.c"
+import "C"
+
+import "unsafe"
+
+// Get the tree-sitter Language for standalone Django expressions.
+func LanguageExpression() unsafe.Pointer {
+	return unsafe.Pointer(C.tree_sitter_htmldjango_expression())
+}
@@ -0,0 +1,458 @@
+// Generated by tools/gen_kinds.py from src/node-types.json. Do not edit.
+
+package tree_sitter_htmldjango
+
+// Node kind IDs, as returned by KindOf and stored in a binary CST.
+const (
+	KindError uint16 = iota
+	KindComparisonOperator
+	KindDjangoStatement
+	KindElement
+	KindLiteral
+	KindAndExpression
+	KindAsAlias
+	KindAssignment
+	KindAttribute
+	KindAttributeName
+	KindAttributeValue
+	KindComparisonExpression
+	KindCycleValue
+	KindDjangoAttributeElifBranch
+	KindDjangoAttributeElseBranch
+	KindDjangoAttributeEmptyBranch
+	KindDjangoAttributeForBlock
+	KindDjangoAttributeIfBlock
+	KindDjangoAutoescapeBlock
+	KindDjangoBlockBlock
+	KindDjangoBlockComment
+	KindDjangoBlockOpen
+	KindDjangoCsrfTokenTag
+	KindDjangoCycleTag
+	KindDjangoDebugTag
+	KindDjangoElif
+	KindDjangoElifBranch
+	KindDjangoElse
+	KindDjangoElseBranch
+	KindDjangoEmpty
+	KindDjangoEmptyBranch
+	KindDjangoEndblock
+	KindDjangoEndfor
+	KindDjangoEndif
+	KindDjangoEndwith
+	KindDjangoExtendsTag
+	KindDjangoFilterBlock
+	KindDjangoFirstofTag
+	KindDjangoForBlock
+	KindDjangoForOpen
+	KindDjangoGenericBlock
+	KindDjangoGenericTag
+	KindDjangoIfBlock
+	KindDjangoIfOpen
+	KindDjangoIfchangedBlock
+	KindDjangoIncludeTag
+	KindDjangoInterpolation
+	KindDjangoLoadTag
+	KindDjangoLoremTag
+	KindDjangoNowTag
+	KindDjangoPartialTag
+	KindDjangoPartialdefBlock
+	KindDjangoQuerystringTag
+	KindDjangoRegroupTag
+	KindDjangoResetcycleTag
+	KindDjangoSpacelessBlock
+	KindDjangoTemplatetagTag
+	KindDjangoUrlTag
+	KindDjangoVerbatimBlock
+	KindDjangoWidthratioTag
+	KindDjangoWithBlock
+	KindDjangoWithOpen
+	KindDoctype
+	KindDocument
+	KindEndTag
+	KindErroneousEndTag
+	KindFilterArgument
+	KindFilterCall
+	KindFilterChain
+	KindFilterExpression
+	KindForeignElement
+	KindLookup
+	KindLoopVariables
+	KindNamedArgument
+	KindNormalElement
+	KindNotExpression
+	KindOrExpression
+	KindPlaintextElement
+	KindQuotedAttributeValue
+	KindRawText
+	KindRcdataElement
+	KindScriptElement
+	KindStartTag
+	KindString
+	KindStyleElement
+	KindTagArgument
+	KindTestExpression
+	KindText
+	KindUnpairedEndTag
+	KindUnpairedStartTag
+	KindVoidElement
+	KindWithAssignments
+	KindWithLegacy
+	KindAnonDquote
+	KindAnonPercentRbrace
+	KindAnonSquote
+	KindAnonComma
+	KindAnonDot
+	KindAnonSlashGt
+	KindAnonColon
+	KindAnonLt
+	KindAnonLtBang
+	KindAnonLtSlash
+	KindAnonEq
+	KindAnonGt
+	KindAnonAnd
+	KindAndKeyword
+	KindArgumentName
+	KindAnonAs
+	KindAnonAutoescape
+	KindAutoescapeValue
+	KindAnonBlock
+	KindBlockName
+	KindAnonBy
+	KindComment
+	KindAnonComment
+	KindCommentContent
+	KindCommentText
+	KindAnonCsrfToken
+	KindAnonCycle
+	KindCycleName
+	KindAnonDebug
+	KindDjangoLineComment
+	KindDoctypeKeyword
+	KindAnonElif
+	KindAnonElse
+	KindAnonEmpty
+	KindEndTagName
+	KindAnonEndautoescape
+	KindAnonEndblock
+	KindAnonEndcomment
+	KindAnonEndfilter
+	KindAnonEndfor
+	KindAnonEndif
+	KindAnonEndifchanged
+	KindAnonEndpartialdef
+	KindAnonEndspaceless
+	KindAnonEndwith
+	KindEntity
+	KindErroneousEndTagName
+	KindAnonExtends
+	KindAnonFilter
+	KindFilterName
+	KindAnonFirstof
+	KindAnonFor
+	KindAnonFrom
+	KindGenericTagName
+	KindI18nString
+	KindIdentifier
+	KindAnonIf
+	KindAnonIfchanged
+	KindImplicitEndTag
+	KindAnonIn
+	KindAnonInclude
+	KindInline
+	KindLibraryName
+	KindAnonLoad
+	KindAnonLorem
+	KindMethod
+	KindNameSegment
+	KindAnonNot
+	KindAnonNow
+	KindNumber
+	KindNumericIndex
+	KindOnly
+	KindOpEq
+	KindOpGt
+	KindOpGte
+	KindOpIn
+	KindOpIs
+	KindOpIsNot
+	KindOpLt
+	KindOpLte
+	KindOpNe
+	KindOpNotIn
+	KindOrKeyword
+	KindAnonPartial
+	KindPartialName
+	KindAnonPartialdef
+	KindPlaintextText
+	KindAnonQuerystring
+	KindRandom
+	KindRcdataText
+	KindAnonRegroup
+	KindAnonResetcycle
+	KindReversed
+	KindSilent
+	KindAnonSpaceless
+	KindTagName
+	KindAnonTemplatetag
+	KindTemplatetagArgument
+	KindAnonUrl
+	KindVariableName
+	KindAnonVerbatim
+	KindVerbatimContent
+	KindAnonWidthratio
+	KindAnonWith
+	KindAnonLbracePercent
+	KindAnonLbraceLbrace
+	KindAnonPipe
+	KindAnonRbraceRbrace
+)
+
+// Field IDs, as returned by FieldOf. FieldNone is no field.
+const (
+	FieldNone uint16 = iota
+	FieldAlias
+	FieldArgument
+	FieldBody
+	FieldCondition
+	FieldCount
+	FieldEndName
+	FieldFilters
+	FieldFormat
+	FieldGrouper
+	FieldIterable
+	FieldMaxValue
+	FieldMaxWidth
+	FieldName
+	FieldSource
+	FieldTarget
+	FieldTemplate
+	FieldUrlName
+	FieldValue
+)
+
+// The node type name of each kind ID
+var KindNames = [...]string{
+	"ERROR",
+	"comparison_operator",
+	"django_statement",
+	"element",
+	"literal",
+	"and_expression",
+	"as_alias",
+	"assignment",
+	"attribute",
+	"attribute_name",
+	"attribute_value",
+	"comparison_expression",
+	"cycle_value",
+	"django_attribute_elif_branch",
+	"django_attribute_else_branch",
+	"django_attribute_empty_branch",
+	"django_attribute_for_block",
+	"django_attribute_if_block",
+	"django_autoescape_block",
+	"django_block_block",
+	"django_block_comment",
+	"django_block_open",
+	"django_csrf_token_tag",
+	"django_cycle_tag",
+	"django_debug_tag",
+	"django_elif",
+	"django_elif_branch",
+	"django_else",
+	"django_else_branch",
+	"django_empty",
+	"django_empty_branch",
+	"django_endblock",
+	"django_endfor",
+	"django_endif",
+	"django_endwith",
+	"django_extends_tag",
+	"django_filter_block",
+	"django_firstof_tag",
+	"django_for_block",
+	"django_for_open",
+	"django_generic_block",
+	"django_generic_tag",
+	"django_if_block",
+	"django_if_open",
+	"django_ifchanged_block",
+	"django_include_tag",
+	"django_interpolation",
+	"django_load_tag",
+	"django_lorem_tag",
+	"django_now_tag",
+	"django_partial_tag",
+	"django_partialdef_block",
+	"django_querystring_tag",
+	"django_regroup_tag",
+	"django_resetcycle_tag",
+	"django_spaceless_block",
+	"django_templatetag_tag",
+	"django_url_tag",
+	"django_verbatim_block",
+	"django_widthratio_tag",
+	"django_with_block",
+	"django_with_open",
+	"doctype",
+	"document",
+	"end_tag",
+	"erroneous_end_tag",
+	"filter_argument",
+	"filter_call",
+	"filter_chain",
+	"filter_expression",
+	"foreign_element",
+	"lookup",
+	"loop_variables",
+	"named_argument",
+	"normal_element",
+	"not_expression",
+	"or_expression",
+	"plaintext_element",
+	"quoted_attribute_value",
+	"raw_text",
+	"rcdata_element",
+	"script_element",
+	"start_tag",
+	"string",
+	"style_element",
+	"tag_argument",
+	"test_expression",
+	"text",
+	"unpaired_end_tag",
+	"unpaired_start_tag",
+	"void_element",
+	"with_assignments",
+	"with_legacy",
+	"\"",
+	"%}",
+	"'",
+	",",
+	".",
+	"/>",
+	":",
+	"<",
+	"<!",
+	"</",
+	"=",
+	">",
+	"and",
+	"and_keyword",
+	"argument_name",
+	"as",
+	"autoescape",
+	"autoescape_value",
+	"block",
+	"block_name",
+	"by",
+	"comment",
+	"comment",
+	"comment_content",
+	"comment_text",
+	"csrf_token",
+	"cycle",
+	"cycle_name",
+	"debug",
+	"django_line_comment",
+	"doctype_keyword",
+	"elif",
+	"else",
+	"empty",
+	"end_tag_name",
+	"endautoescape",
+	"endblock",
+	"endcomment",
+	"endfilter",
+	"endfor",
+	"endif",
+	"endifchanged",
+	"endpartialdef",
+	"endspaceless",
+	"endwith",
+	"entity",
+	"erroneous_end_tag_name",
+	"extends",
+	"filter",
+	"filter_name",
+	"firstof",
+	"for",
+	"from",
+	"generic_tag_name",
+	"i18n_string",
+	"identifier",
+	"if",
+	"ifchanged",
+	"implicit_end_tag",
+	"in",
+	"include",
+	"inline",
+	"library_name",
+	"load",
+	"lorem",
+	"method",
+	"name_segment",
+	"not",
+	"now",
+	"number",
+	"numeric_index",
+	"only",
+	"op_eq",
+	"op_gt",
+	"op_gte",
+	"op_in",
+	"op_is",
+	"op_is_not",
+	"op_lt",
+	"op_lte",
+	"op_ne",
+	"op_not_in",
+	"or_keyword",
+	"partial",
+	"partial_name",
+	"partialdef",
+	"plaintext_text",
+	"querystring",
+	"random",
+	"rcdata_text",
+	"regroup",
+	"resetcycle",
+	"reversed",
+	"silent",
+	"spaceless",
+	"tag_name",
+	"templatetag",
+	"templatetag_argument",
+	"url",
+	"variable_name",
+	"verbatim",
+	"verbatim_content",
+	"widthratio",
+	"with",
+	"{%",
+	"{{",
+	"|",
+	"}}",
+}
+
+var FieldNames = [...]string{
+	"",
+	"alias",
+	"argument",
+	"body",
+	"condition",
+	"count",
+	"end_name",
+	"filters",
+	"format",
+	"grouper",
+	"iterable",
+	"max_value",
+	"max_width",
+	"name",
+	"source",
+	"target",
+	"template",
+	"url_name",
+	"value",
+}
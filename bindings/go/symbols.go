@@ -0,0 +1,49 @@
+package tree_sitter_htmldjango
+
+// #cgo CFLAGS: -std=c11 -fPIC -I../c -I../../src
+// #include "../../tools/kinds.c"
+import "C"
+
+import (
+	"sync"
+	"unsafe"
+)
+
+var (
+	symbolTables sync.Once
+	symbolKinds  []uint16
+	fieldIDs     []uint16
+)
+
+func loadSymbolTables() {
+	symbolKinds = make([]uint16, C.htmldjango_symbol_kinds(nil, 0))
+	if len(symbolKinds) > 0 {
+		C.htmldjango_symbol_kinds((*C.uint16_t)(unsafe.Pointer(&symbolKinds[0])), C.uint32_t(len(symbolKinds)))
+	}
+	fieldIDs = make([]uint16, C.htmldjango_field_ids(nil, 0))
+	if len(fieldIDs) > 0 {
+		C.htmldjango_field_ids((*C.uint16_t)(unsafe.Pointer(&fieldIDs[0])), C.uint32_t(len(fieldIDs)))
+	}
+}
+
+// The stable kind ID of a parser symbol, such as Node.KindId() returns, for
+// switching on instead of comparing Node.Kind() strings. Symbols move whenever
+// the grammar is regenerated; the Kind constants only move with
+// node-types.json. ERROR nodes are KindError.
+func KindOf(symbol uint16) uint16 {
+	symbolTables.Do(loadSymbolTables)
+	if int(symbol) < len(symbolKinds) {
+		return symbolKinds[symbol]
+	}
+	return KindError
+}
+
+// The stable field ID of a parser field ID, such as TreeCursor.FieldId()
+// returns.
+func FieldOf(fieldID uint16) uint16 {
+	symbolTables.Do(loadSymbolTables)
+	if int(fieldID) < len(fieldIDs) {
+		return fieldIDs[fieldID]
+	}
+	return FieldNone
+}
@@ -1,19 +1,430 @@
 #include <napi.h>
 
+#include <string>
+
+#include "tree-sitter-htmldjango-blocks.h"
+#include "tree-sitter-htmldjango-kinds.h"
+
+#ifdef HTMLDJANGO_ASYNC_PARSE
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <uv.h>
+
+#include "tree-sitter-htmldjango-tools.h"
+#endif
+
 typedef struct TSLanguage TSLanguage;
 
 extern "C" TSLanguage *tree_sitter_htmldjango();
+extern "C" TSLanguage *tree_sitter_htmldjango_expression();
 
 // "tree-sitter", "language" hashed with BLAKE2
 const napi_type_tag LANGUAGE_TYPE_TAG = {
     0x8AF2E5212AD58ABF, 0xD5006CAD83ABBA16
 };
 
+// blockMap(source: Buffer | string): offsets are in UTF-8 bytes either way
+Napi::Value BlockMap(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    std::string text;
+    const char *source;
+    size_t length;
+    if (info.Length() > 0 && info[0].IsBuffer()) {
+        auto buffer = info[0].As<Napi::Buffer<char>>();
+        source = buffer.Data();
+        length = buffer.Length();
+    } else if (info.Length() > 0 && info[0].IsString()) {
+        text = info[0].As<Napi::String>().Utf8Value();
+        source = text.data();
+        length = text.size();
+    } else {
+        Napi::TypeError::New(env, "source must be a Buffer or a string").ThrowAsJavaScriptException();
+        return env.Undefined();
+    }
+    if (length > UINT32_MAX) {
+        Napi::RangeError::New(env, "source is larger than 4 GiB").ThrowAsJavaScriptException();
+        return env.Undefined();
+    }
+
+    HTMLDjangoBlockMap map = {};
+    if (!htmldjango_block_map_build(&map, source, static_cast<uint32_t>(length))) {
+        htmldjango_block_map_delete(&map);
+        Napi::Error::New(env, "out of memory").ThrowAsJavaScriptException();
+        return env.Undefined();
+    }
+
+    auto blocks = Napi::Array::New(env, map.block_count);
+    for (uint32_t i = 0; i < map.block_count; i++) {
+        const HTMLDjangoBlock &block = map.blocks[i];
+        auto object = Napi::Object::New(env);
+        object["name"] = Napi::String::New(env, block.name, block.name_length);
+        object["startByte"] = block.start_byte;
+        object["endByte"] = block.end_byte;
+        object["contentStartByte"] = block.content_start_byte;
+        object["contentEndByte"] = block.content_end_byte;
+        object["depth"] = block.depth;
+        if (block.parent == HTMLDJANGO_NO_BLOCK) {
+            object["parent"] = env.Null();
+        } else {
+            object["parent"] = block.parent;
+        }
+        object["superCount"] = block.super_count;
+        object["closed"] = block.closed;
+        blocks[i] = object;
+    }
+    auto supers = Napi::Array::New(env, map.super_count);
+    for (uint32_t i = 0; i < map.super_count; i++) {
+        auto object = Napi::Object::New(env);
+        object["block"] = map.supers[i].block;
+        object["startByte"] = map.supers[i].start_byte;
+        object["endByte"] = map.supers[i].end_byte;
+        supers[i] = object;
+    }
+    htmldjango_block_map_delete(&map);
+
+    auto result = Napi::Object::New(env);
+    result["blocks"] = blocks;
+    result["supers"] = supers;
+    return result;
+}
+
+// symbolKinds() and fieldIds(): the stable ID of each parser symbol and field ID
+template <uint32_t (*Fill)(uint16_t *, uint32_t)>
+Napi::Value IdTable(const Napi::CallbackInfo &info) {
+    uint32_t count = Fill(nullptr, 0);
+    auto table = Napi::Uint16Array::New(info.Env(), count);
+    Fill(table.Data(), count);
+    return table;
+}
+
+#ifdef HTMLDJANGO_ASYNC_PARSE
+
+// parseBatch() runs on libuv's thread pool, in this addon's own copy of the
+// tree-sitter runtime, so the event loop only converts inputs and results.
+// Each pool thread keeps one parser for its lifetime.
+class ThreadParser {
+  public:
+    ThreadParser() : parser_(ts_parser_new()) { ts_parser_set_language(parser_, tree_sitter_htmldjango()); }
+    ~ThreadParser() { ts_parser_delete(parser_); }
+    ThreadParser(const ThreadParser &) = delete;
+    ThreadParser &operator=(const ThreadParser &) = delete;
+    TSParser *get() const { return parser_; }
+
+  private:
+    TSParser *parser_;
+};
+
+TSParser *WorkerParser() {
+    thread_local ThreadParser parser;
+    return parser.get();
+}
+
+struct ParseInput {
+    // Points into a Buffer that the batch holds a reference to
+    const char *source = nullptr;
+    uint32_t length = 0;
+    // A string input's UTF-8 text, or a path when is_path is set
+    std::string text;
+    bool is_path = false;
+};
+
+struct Dependency {
+    HTMLDjangoDependencyKind kind;
+    std::string target;
+    uint32_t start_byte;
+    uint32_t end_byte;
+};
+
+struct ParseOutput {
+    int read_error = 0;
+    // ENOMEM or EFBIG from building the results, which fails the batch
+    int error = 0;
+    uint32_t length = 0;
+    uint32_t node_count = 0;
+    bool has_error = false;
+    double parse_seconds = 0;
+    std::vector<std::pair<uint32_t, uint32_t>> error_ranges;
+    std::vector<Dependency> dependencies;
+    HTMLDjangoCSTBuffer cst = {};
+
+    ParseOutput() = default;
+    ParseOutput(const ParseOutput &) = delete;
+    ParseOutput &operator=(const ParseOutput &) = delete;
+    ~ParseOutput() { htmldjango_cst_buffer_delete(&cst); }
+};
+
+struct ParseBatch {
+    std::vector<ParseInput> inputs;
+    std::unique_ptr<ParseOutput[]> outputs;
+    std::vector<Napi::ObjectReference> buffers;
+    std::atomic<size_t> next{0};
+    bool trees = false;
+    bool dependencies = true;
+    // Only touched on the main thread, from OnOK() and OnError()
+    unsigned pending = 0;
+    std::string error;
+    Napi::Promise::Deferred deferred;
+
+    explicit ParseBatch(Napi::Env env) : deferred(Napi::Promise::Deferred::New(env)) {}
+};
+
+// Records the outermost ERROR and MISSING nodes, skipping subtrees without
+// errors
+void CollectErrors(TSNode root, ParseOutput &output) {
+    TSTreeCursor cursor = ts_tree_cursor_new(root);
+    for (;;) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        bool descend = false;
+        if (ts_node_is_error(node) || ts_node_is_missing(node)) {
+            try {
+                output.error_ranges.emplace_back(ts_node_start_byte(node), ts_node_end_byte(node));
+            } catch (const std::bad_alloc &) {
+                output.error = ENOMEM;
+                break;
+            }
+        } else {
+            descend = ts_node_has_error(node);
+        }
+        if (descend && ts_tree_cursor_goto_first_child(&cursor)) continue;
+        bool done = false;
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                done = true;
+                break;
+            }
+        }
+        if (done) break;
+    }
+    ts_tree_cursor_delete(&cursor);
+}
+
+// Called from C, so nothing may be thrown through it
+bool AddDependency(void *payload, const HTMLDjangoDependency *dependency) {
+    auto output = static_cast<ParseOutput *>(payload);
+    try {
+        output->dependencies.push_back(Dependency{dependency->kind,
+                                                  std::string(dependency->target, dependency->target_length),
+                                                  dependency->start_byte, dependency->end_byte});
+    } catch (const std::bad_alloc &) {
+        output->error = ENOMEM;
+        return false;
+    }
+    return true;
+}
+
+void ParseOne(const ParseInput &input, const ParseBatch &batch, ParseOutput &output) {
+    HTMLDjangoMappedFile file = {};
+    const char *source = input.source;
+    uint32_t length = input.length;
+    if (input.is_path) {
+        output.read_error = htmldjango_map_file(input.text.c_str(), &file);
+        if (output.read_error) return;
+        source = file.data ? file.data : "";
+        length = file.length;
+    } else if (!source) {
+        source = input.text.data();
+        length = static_cast<uint32_t>(input.text.size());
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    TSTree *tree = ts_parser_parse_string(WorkerParser(), nullptr, source, length);
+    output.parse_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    output.length = length;
+    if (tree) {
+        TSNode root = ts_tree_root_node(tree);
+        output.node_count = ts_node_descendant_count(root);
+        output.has_error = ts_node_has_error(root);
+        if (output.has_error) CollectErrors(root, output);
+        if (batch.dependencies && !output.error) {
+            htmldjango_extract_dependencies(source, length, AddDependency, &output);
+        }
+        if (batch.trees && !output.error) output.error = htmldjango_cst_write(tree, &output.cst);
+        ts_tree_delete(tree);
+    } else {
+        output.error = ENOMEM;
+    }
+    if (input.is_path) htmldjango_unmap_file(&file);
+}
+
+Napi::Value ErrorCode(Napi::Env env, int error) {
+    if (!error) return env.Null();
+    return Napi::String::New(env, uv_err_name(uv_translate_sys_error(error)));
+}
+
+Napi::Object SummaryObject(Napi::Env env, const ParseOutput &output, bool trees) {
+    auto object = Napi::Object::New(env);
+    object["readError"] = ErrorCode(env, output.read_error);
+    object["length"] = output.length;
+    object["nodeCount"] = output.node_count;
+    object["hasError"] = output.has_error;
+    object["parseSeconds"] = output.parse_seconds;
+
+    auto ranges = Napi::Array::New(env, output.error_ranges.size());
+    for (uint32_t i = 0; i < output.error_ranges.size(); i++) {
+        auto range = Napi::Array::New(env, 2);
+        range[0u] = output.error_ranges[i].first;
+        range[1u] = output.error_ranges[i].second;
+        ranges[i] = range;
+    }
+    object["errorRanges"] = ranges;
+
+    static const char *const KINDS[] = {"extends", "include", "load", "partial"};
+    auto dependencies = Napi::Array::New(env, output.dependencies.size());
+    for (uint32_t i = 0; i < output.dependencies.size(); i++) {
+        const Dependency &dependency = output.dependencies[i];
+        auto item = Napi::Object::New(env);
+        item["kind"] = KINDS[dependency.kind];
+        item["target"] = Napi::String::New(env, dependency.target);
+        item["startByte"] = dependency.start_byte;
+        item["endByte"] = dependency.end_byte;
+        dependencies[i] = item;
+    }
+    object["dependencies"] = dependencies;
+
+    if (trees && output.cst.data) {
+        object["tree"] = Napi::Buffer<uint8_t>::Copy(env, output.cst.data, output.cst.length);
+    } else {
+        object["tree"] = env.Null();
+    }
+    return object;
+}
+
+void Settle(Napi::Env env, ParseBatch &batch) {
+    for (Napi::ObjectReference &buffer : batch.buffers) buffer.Reset();
+    size_t count = batch.inputs.size();
+    for (size_t i = 0; i < count && batch.error.empty(); i++) {
+        if (batch.outputs[i].error) batch.error = std::strerror(batch.outputs[i].error);
+    }
+    if (!batch.error.empty()) {
+        batch.deferred.Reject(Napi::Error::New(env, batch.error).Value());
+        return;
+    }
+    auto summaries = Napi::Array::New(env, count);
+    for (uint32_t i = 0; i < count; i++) summaries[i] = SummaryObject(env, batch.outputs[i], batch.trees);
+    batch.deferred.Resolve(summaries);
+}
+
+// One of the batch's workers. Each takes the next unparsed input until none
+// are left, so a few large templates do not leave the other workers idle.
+class ParseWorker : public Napi::AsyncWorker {
+  public:
+    ParseWorker(Napi::Env env, std::shared_ptr<ParseBatch> batch)
+        : Napi::AsyncWorker(env, "htmldjango.parseBatch"), batch_(std::move(batch)) {}
+
+    void Execute() override {
+        ParseBatch &batch = *batch_;
+        for (size_t i; (i = batch.next.fetch_add(1)) < batch.inputs.size();) {
+            ParseOne(batch.inputs[i], batch, batch.outputs[i]);
+        }
+    }
+
+    void OnOK() override { Finish(); }
+
+    void OnError(const Napi::Error &error) override {
+        if (batch_->error.empty()) batch_->error = error.Message();
+        Finish();
+    }
+
+  private:
+    void Finish() {
+        if (--batch_->pending == 0) Settle(Env(), *batch_);
+    }
+
+    std::shared_ptr<ParseBatch> batch_;
+};
+
+// Buffers are sources, strings are sources too, and {path} objects are read
+// by the workers themselves
+bool ConvertInput(Napi::Env env, Napi::Value value, ParseBatch &batch, ParseInput &input) {
+    if (value.IsBuffer()) {
+        auto buffer = value.As<Napi::Buffer<char>>();
+        if (buffer.Length() > UINT32_MAX) {
+            Napi::RangeError::New(env, "source is larger than 4 GiB").ThrowAsJavaScriptException();
+            return false;
+        }
+        input.source = buffer.Length() ? buffer.Data() : "";
+        input.length = static_cast<uint32_t>(buffer.Length());
+        batch.buffers.push_back(Napi::Persistent(buffer.As<Napi::Object>()));
+        return true;
+    }
+    if (value.IsString()) {
+        input.text = value.As<Napi::String>().Utf8Value();
+        if (input.text.size() > UINT32_MAX) {
+            Napi::RangeError::New(env, "source is larger than 4 GiB").ThrowAsJavaScriptException();
+            return false;
+        }
+        return true;
+    }
+    if (value.IsObject()) {
+        Napi::Value path = value.As<Napi::Object>().Get("path");
+        if (path.IsString()) {
+            input.text = path.As<Napi::String>().Utf8Value();
+            input.is_path = true;
+            return true;
+        }
+    }
+    Napi::TypeError::New(env, "each input must be a Buffer, a string or a {path} object")
+        .ThrowAsJavaScriptException();
+    return false;
+}
+
+// parseBatch(inputs: Array, trees: boolean, dependencies: boolean, workers: number): Promise<object[]>
+Napi::Value ParseBatchAsync(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 4 || !info[0].IsArray() || !info[3].IsNumber()) {
+        Napi::TypeError::New(env, "parseBatch(inputs, trees, dependencies, workers)").ThrowAsJavaScriptException();
+        return env.Undefined();
+    }
+    auto items = info[0].As<Napi::Array>();
+    auto batch = std::make_shared<ParseBatch>(env);
+    batch->trees = info[1].ToBoolean();
+    batch->dependencies = info[2].ToBoolean();
+    size_t count = items.Length();
+    batch->inputs.resize(count);
+    batch->outputs.reset(new ParseOutput[count]);
+    for (uint32_t i = 0; i < count; i++) {
+        if (!ConvertInput(env, items.Get(i), *batch, batch->inputs[i])) return env.Undefined();
+    }
+    Napi::Promise promise = batch->deferred.Promise();
+    if (count == 0) {
+        batch->deferred.Resolve(Napi::Array::New(env));
+        return promise;
+    }
+    int64_t requested = info[3].As<Napi::Number>().Int64Value();
+    unsigned workers = static_cast<unsigned>(std::max<int64_t>(1, std::min<int64_t>(requested, count)));
+    batch->pending = workers;
+    for (unsigned i = 0; i < workers; i++) (new ParseWorker(env, batch))->Queue();
+    return promise;
+}
+
+#endif
+
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports["name"] = Napi::String::New(env, "htmldjango");
     auto language = Napi::External<TSLanguage>::New(env, tree_sitter_htmldjango());
     language.TypeTag(&LANGUAGE_TYPE_TAG);
     exports["language"] = language;
+
+    auto expression = Napi::Object::New(env);
+    expression["name"] = Napi::String::New(env, "htmldjango_expression");
+    auto expression_language = Napi::External<TSLanguage>::New(env, tree_sitter_htmldjango_expression());
+    expression_language.TypeTag(&LANGUAGE_TYPE_TAG);
+    expression["language"] = expression_language;
+    exports["expression"] = expression;
+    exports["blockMap"] = Napi::Function::New(env, BlockMap, "blockMap");
+    exports["symbolKinds"] = Napi::Function::New(env, IdTable<htmldjango_symbol_kinds>, "symbolKinds");
+    exports["fieldIds"] = Napi::Function::New(env, IdTable<htmldjango_field_ids>, "fieldIds");
+#ifdef HTMLDJANGO_ASYNC_PARSE
+    exports["parseBatch"] = Napi::Function::New(env, ParseBatchAsync, "parseBatch");
+#endif
     return exports;
 }
 
@@ -7,3 +7,74 @@ test("can load grammar", () => {
   const parser = new Parser();
   assert.doesNotThrow(() => parser.setLanguage(require(".")));
 });
+
+test("can load expression grammar", () => {
+  const parser = new Parser();
+  assert.doesNotThrow(() => parser.setLanguage(require(".").expression));
+});
+
+test("block map", () => {
+  const source = "{% block content %}{{ block.super }}{% block inner %}x{% endblock %}{% endblock %}";
+  const { blocks, supers } = require(".").blockMap(source);
+  assert.deepStrictEqual(blocks.map((block) => block.name), ["content", "inner"]);
+  assert.strictEqual(blocks[1].parent, 0);
+  assert.strictEqual(source.slice(blocks[1].contentStartByte, blocks[1].contentEndByte), "x");
+  assert.strictEqual(supers.length, 1);
+});
+
+test("node kinds", () => {
+  const language = require(".");
+  const parser = new Parser();
+  parser.setLanguage(language);
+  const tree = parser.parse("{% block content %}<p>{{ x }}</p>{% endblock %}");
+  const block = tree.rootNode.child(0);
+  assert.strictEqual(language.nodeKind(block), language.Kind.DJANGO_BLOCK_BLOCK);
+  const check = (node) => {
+    assert.strictEqual(language.kindNames[language.nodeKind(node)][0], node.type);
+    node.children.forEach(check);
+  };
+  check(tree.rootNode);
+});
+
+test("async batch parsing", async (t) => {
+  const language = require(".");
+  const fs = require("node:fs");
+  const os = require("node:os");
+  const path = require("node:path");
+  if (!(await language.parseAsync("").then(() => true, () => false))) {
+    t.skip("built without the tree-sitter runtime");
+    return;
+  }
+  const directory = fs.mkdtempSync(path.join(os.tmpdir(), "htmldjango-"));
+  const page = path.join(directory, "page.html");
+  fs.writeFileSync(page, "{% extends 'base.html' %}{% load static %}");
+  try {
+    const [included, extending, missing, broken] = await language.parseBatchAsync(
+      [
+        Buffer.from("{% include 'card.html' %}<p>{{ x }}</p>"),
+        { path: page },
+        { path: path.join(directory, "missing.html") },
+        "<p>{% if %}</p>",
+      ],
+      { trees: true, concurrency: 2 },
+    );
+    assert.strictEqual(included.hasError, false);
+    assert.deepStrictEqual(included.dependencies, [
+      { kind: "include", target: "card.html", startByte: 0, endByte: 25 },
+    ]);
+    assert.strictEqual(included.tree.root.kind, "document");
+    assert.strictEqual(included.tree.length, included.nodeCount);
+    assert.deepStrictEqual(
+      extending.dependencies.map((dependency) => [dependency.kind, dependency.target]),
+      [["extends", "base.html"], ["load", "static"]],
+    );
+    assert.strictEqual(missing.readError, "ENOENT");
+    assert.strictEqual(missing.tree, null);
+    assert.strictEqual(broken.hasError, true);
+    assert.ok(broken.errorRanges.length > 0);
+    await assert.rejects(language.parseAsync({ path: path.join(directory, "missing.html") }), { code: "ENOENT" });
+    assert.strictEqual((await language.parseAsync("x", { dependencies: false })).tree, null);
+  } finally {
+    fs.rmSync(directory, { recursive: true });
+  }
+});
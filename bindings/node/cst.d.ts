@@ -0,0 +1,49 @@
+/** A binary syntax tree, read in place from the buffer htmldjango_cst_write() produced */
+export declare class CST implements Iterable<CSTNode> {
+  /** Checks every node once; throws for a buffer that is truncated, of another version or not a tree */
+  constructor(data: Uint8Array);
+  /** Number of nodes */
+  readonly length: number;
+  /** Kind names by kind ID; kind 0 is ERROR */
+  readonly kinds: string[];
+  /** Field names by field ID; field 0 is "" */
+  readonly fields: string[];
+  readonly root: CSTNode | null;
+  node(index: number): CSTNode;
+  kindName(kind: number): string;
+  fieldName(field: number): string;
+  /** All nodes in pre-order */
+  [Symbol.iterator](): Iterator<CSTNode>;
+}
+
+export declare class CSTNode {
+  readonly cst: CST;
+  readonly index: number;
+  readonly kindId: number;
+  readonly kind: string;
+  /** The node's field in its parent, 0 for none */
+  readonly fieldId: number;
+  readonly fieldName: string | null;
+  readonly flags: number;
+  readonly isNamed: boolean;
+  readonly isMissing: boolean;
+  readonly isExtra: boolean;
+  readonly isError: boolean;
+  readonly hasError: boolean;
+  readonly startByte: number;
+  readonly endByte: number;
+  readonly parent: CSTNode | null;
+  /** The number of nodes in this node's subtree, itself included */
+  readonly descendantCount: number;
+  readonly children: CSTNode[];
+  /** This node and its descendants, in pre-order */
+  descendants(): Generator<CSTNode>;
+}
+
+export declare const VERSION: 1;
+export declare const NO_NODE: 0xffffffff;
+export declare const NAMED: number;
+export declare const MISSING: number;
+export declare const EXTRA: number;
+export declare const ERROR: number;
+export declare const HAS_ERROR: number;
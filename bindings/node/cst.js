@@ -0,0 +1,177 @@
+// Reader for the binary syntax trees written by htmldjango_cst_write().
+//
+// The layout is documented in bindings/c/tree-sitter-htmldjango-cst.h. A CST
+// reads a Buffer or any other Uint8Array in place through a DataView and
+// decodes a node only when it is looked at.
+
+const VERSION = 1;
+const HEADER_SIZE = 32;
+const NODE_SIZE = 24;
+const NO_NODE = 0xffffffff;
+const MAGIC = "HDJC";
+
+const NAMED = 1 << 0;
+const MISSING = 1 << 1;
+const EXTRA = 1 << 2;
+const ERROR = 1 << 3;
+const HAS_ERROR = 1 << 4;
+
+const invalid = () => new Error("not a valid binary syntax tree");
+
+class CST {
+  // Opening a CST checks every node once, so that the accessors can trust the
+  // buffer. The buffer must not change while the CST is in use.
+  constructor(data) {
+    if (!(data instanceof Uint8Array) || data.length < HEADER_SIZE) throw invalid();
+    const view = new DataView(data.buffer, data.byteOffset, data.byteLength);
+    const magic = String.fromCharCode(data[0], data[1], data[2], data[3]);
+    const nodeCount = view.getUint32(8, true);
+    const kindCount = view.getUint32(12, true);
+    const fieldCount = view.getUint32(16, true);
+    const namesOffset = view.getUint32(20, true);
+    const total = view.getUint32(24, true);
+    if (magic !== MAGIC || view.getUint16(4, true) !== VERSION ||
+        view.getUint16(6, true) !== HEADER_SIZE || total > data.length) {
+      throw invalid();
+    }
+    const nodesEnd = HEADER_SIZE + nodeCount * NODE_SIZE;
+    this._view = view;
+    this.length = nodeCount;
+    const names = readNames(data.subarray(0, total), namesOffset, nodesEnd, kindCount + fieldCount);
+    this.kinds = names.slice(0, kindCount);
+    this.fields = names.slice(kindCount);
+    checkNodes(view, nodeCount, kindCount, fieldCount);
+  }
+
+  get root() {
+    return this.length ? new CSTNode(this, 0) : null;
+  }
+
+  node(index) {
+    if (!Number.isInteger(index) || index < 0 || index >= this.length) {
+      throw new RangeError("node index out of range");
+    }
+    return new CSTNode(this, index);
+  }
+
+  /** All nodes in pre-order */
+  *[Symbol.iterator]() {
+    for (let index = 0; index < this.length; index++) yield new CSTNode(this, index);
+  }
+
+  kindName(kind) {
+    return this.kinds[kind];
+  }
+
+  fieldName(field) {
+    return this.fields[field];
+  }
+
+  _u16(index, offset) {
+    return this._view.getUint16(HEADER_SIZE + index * NODE_SIZE + offset, true);
+  }
+
+  _u32(index, offset) {
+    return this._view.getUint32(HEADER_SIZE + index * NODE_SIZE + offset, true);
+  }
+}
+
+class CSTNode {
+  constructor(cst, index) {
+    this.cst = cst;
+    this.index = index;
+  }
+
+  get kindId() { return this.cst._u16(this.index, 0); }
+  get kind() { return this.cst.kinds[this.kindId]; }
+  /** The node's field in its parent, 0 for none */
+  get fieldId() { return this.cst._u16(this.index, 2); }
+  get fieldName() { return this.fieldId ? this.cst.fields[this.fieldId] : null; }
+  get flags() { return this.cst._u16(this.index, 4); }
+  get isNamed() { return (this.flags & NAMED) !== 0; }
+  get isMissing() { return (this.flags & MISSING) !== 0; }
+  get isExtra() { return (this.flags & EXTRA) !== 0; }
+  get isError() { return (this.flags & ERROR) !== 0; }
+  get hasError() { return (this.flags & HAS_ERROR) !== 0; }
+  get startByte() { return this.cst._u32(this.index, 8); }
+  get endByte() { return this.cst._u32(this.index, 12); }
+
+  get parent() {
+    const parent = this.cst._u32(this.index, 16);
+    return parent === NO_NODE ? null : new CSTNode(this.cst, parent);
+  }
+
+  /** The number of nodes in this node's subtree, itself included */
+  get descendantCount() {
+    return this.cst._u32(this.index, 20) - this.index;
+  }
+
+  get children() {
+    const children = [];
+    const end = this.cst._u32(this.index, 20);
+    for (let index = this.index + 1; index < end; index = this.cst._u32(index, 20)) {
+      children.push(new CSTNode(this.cst, index));
+    }
+    return children;
+  }
+
+  /** This node and its descendants, in pre-order */
+  *descendants() {
+    const end = this.cst._u32(this.index, 20);
+    for (let index = this.index; index < end; index++) yield new CSTNode(this.cst, index);
+  }
+}
+
+function readNames(data, table, nodesEnd, entries) {
+  const total = data.length;
+  if (table < nodesEnd || table > total || Math.floor((total - table) / 4) < entries) throw invalid();
+  const view = new DataView(data.buffer, data.byteOffset + table, total - table);
+  const decoder = new TextDecoder();
+  const names = [];
+  for (let i = 0; i < entries; i++) {
+    const offset = view.getUint32(i * 4, true);
+    const start = table + offset;
+    const end = data.indexOf(0, start);
+    if (offset < entries * 4 || start >= total || end < 0) throw invalid();
+    names.push(decoder.decode(data.subarray(start, end)));
+  }
+  return names;
+}
+
+// Same checks as htmldjango_cst_open(): each parent is the innermost node whose
+// range still contains the child, found by climbing from the previous node
+function checkNodes(view, count, kindCount, fieldCount) {
+  const parents = new Uint32Array(count);
+  const nexts = new Uint32Array(count);
+  for (let index = 0; index < count; index++) {
+    const base = HEADER_SIZE + index * NODE_SIZE;
+    const kind = view.getUint16(base, true);
+    const field = view.getUint16(base + 2, true);
+    const start = view.getUint32(base + 8, true);
+    const end = view.getUint32(base + 12, true);
+    const parent = view.getUint32(base + 16, true);
+    const next = view.getUint32(base + 20, true);
+    if (kind >= kindCount || field >= fieldCount || start > end || !(index < next && next <= count)) {
+      throw invalid();
+    }
+    let open = index ? index - 1 : NO_NODE;
+    while (open !== NO_NODE && nexts[open] <= index) open = parents[open];
+    if (parent !== open || (index && parent === NO_NODE) || (parent !== NO_NODE && next > nexts[parent])) {
+      throw invalid();
+    }
+    parents[index] = parent;
+    nexts[index] = next;
+  }
+}
+
+module.exports = {
+  CST,
+  CSTNode,
+  VERSION,
+  NO_NODE,
+  NAMED,
+  MISSING,
+  EXTRA,
+  ERROR,
+  HAS_ERROR,
+};
@@ -24,5 +24,94 @@ type Language = {
   nodeTypeInfo: NodeInfo[];
 };
 
-declare const language: Language;
+/** A {% block %} tag pair; offsets are in UTF-8 bytes */
+type Block = {
+  name: string;
+  startByte: number;
+  endByte: number;
+  contentStartByte: number;
+  contentEndByte: number;
+  /** 0 for a top-level block */
+  depth: number;
+  /** Index of the enclosing block in `blocks` */
+  parent: number | null;
+  superCount: number;
+  /** False if the template ends before {% endblock %} */
+  closed: boolean;
+};
+
+/** A {{ block.super }} usage in the block at index `block` */
+type BlockSuper = {
+  block: number;
+  startByte: number;
+  endByte: number;
+};
+
+/** A static dependency of a template; the byte range is the whole tag */
+type Dependency = {
+  kind: "extends" | "include" | "load" | "partial";
+  target: string;
+  startByte: number;
+  endByte: number;
+};
+
+/** What parseBatchAsync() reports for one input */
+type ParseSummary = {
+  /** An error code such as "ENOENT" from reading a path, in which case nothing else is set */
+  readError: string | null;
+  /** Bytes of UTF-8 source */
+  length: number;
+  nodeCount: number;
+  hasError: boolean;
+  parseSeconds: number;
+  /** `[startByte, endByte]` of each outermost ERROR and MISSING node */
+  errorRanges: [number, number][];
+  dependencies: Dependency[];
+  /** Only built when asked for with `trees: true` */
+  tree: import("./cst").CST | null;
+};
+
+type ParseOptions = {
+  /** Build each tree as a binary CST; defaults to false */
+  trees?: boolean;
+  /** Extract {% extends %}, {% include %}, {% load %} and {% partial %} targets; defaults to true */
+  dependencies?: boolean;
+};
+
+/** A source, as a Buffer or a string, or a file that the worker reads itself */
+type ParseInput = Buffer | string | { path: string };
+
+declare const language: Language & {
+  expression: Language;
+  /** The {% block %} tags and {{ block.super }} usages of a template, found without parsing */
+  blockMap(source: Buffer | string): { blocks: Block[]; supers: BlockSuper[] };
+  /** Stable node kind IDs, which only change with node-types.json */
+  Kind: typeof import("./kinds").Kind;
+  /** Stable field IDs; `Field.NONE` is no field */
+  Field: typeof import("./kinds").Field;
+  /** `[type, named]` by kind ID */
+  kindNames: typeof import("./kinds").kindNames;
+  fieldNames: typeof import("./kinds").fieldNames;
+  /** The stable kind of a node, for switching on instead of comparing `node.type` */
+  nodeKind(node: { typeId: number }): number;
+  /** The stable field of a cursor's current node */
+  cursorField(cursor: { currentFieldId: number }): number;
+  /** The stable kind ID of each parser symbol, indexed by `node.typeId` */
+  symbolKinds(): Uint16Array;
+  /** The stable field ID of each parser field ID */
+  fieldIds(): Uint16Array;
+  /** Reader for the binary trees that `trees: true` returns */
+  CST: typeof import("./cst").CST;
+  /**
+   * Parse templates on libuv's thread pool, `concurrency` at a time (by default one per pool
+   * thread), resolving with a summary per input, in order. Rejects if the addon was built
+   * without the tree-sitter runtime.
+   */
+  parseBatchAsync(
+    inputs: Iterable<ParseInput>,
+    options?: ParseOptions & { concurrency?: number },
+  ): Promise<ParseSummary[]>;
+  /** parseBatchAsync() for one input; rejects with the read error for a path that cannot be read */
+  parseAsync(input: ParseInput, options?: ParseOptions): Promise<ParseSummary>;
+};
 export = language;
@@ -6,6 +6,55 @@ module.exports =
     ? require(`../../prebuilds/${process.platform}-${process.arch}/tree-sitter-htmldjango.node`)
     : require("node-gyp-build")(root);
 
+const { Kind, Field, kindNames, fieldNames } = require("./kinds");
+const { CST } = require("./cst");
+const symbolKinds = module.exports.symbolKinds();
+const fieldIds = module.exports.fieldIds();
+const nativeParseBatch = module.exports.parseBatch;
+
+// The workers share libuv's thread pool with fs, dns and zlib
+const threadPoolSize = () => Math.max(1, parseInt(process.env.UV_THREADPOOL_SIZE, 10) || 4);
+
+async function parseBatch(inputs, { trees = false, dependencies = true, concurrency = threadPoolSize() } = {}) {
+  if (!nativeParseBatch) {
+    throw new Error("tree-sitter-htmldjango was built without the tree-sitter runtime");
+  }
+  if (!Number.isInteger(concurrency) || concurrency < 1) {
+    throw new RangeError("concurrency must be a positive integer");
+  }
+  const summaries = await nativeParseBatch(Array.from(inputs), trees, dependencies, concurrency);
+  for (const summary of summaries) {
+    if (summary.tree) summary.tree = new CST(summary.tree);
+  }
+  return summaries;
+}
+
+async function parse(input, options = {}) {
+  const [summary] = await parseBatch([input], { ...options, concurrency: 1 });
+  if (summary.readError) {
+    const error = new Error(`${summary.readError}: cannot read ${input.path}`);
+    error.code = summary.readError;
+    error.path = input.path;
+    throw error;
+  }
+  return summary;
+}
+
+Object.assign(module.exports, {
+  Kind,
+  Field,
+  kindNames,
+  fieldNames,
+  // ERROR nodes have typeId 65535, past the end of the table
+  nodeKind: (node) => symbolKinds[node.typeId] ?? Kind.ERROR,
+  cursorField: (cursor) => fieldIds[cursor.currentFieldId ?? 0] ?? Field.NONE,
+  CST,
+  parseAsync: parse,
+  parseBatchAsync: parseBatch,
+});
+delete module.exports.parseBatch;
+
 try {
   module.exports.nodeTypeInfo = require("../../src/node-types.json");
+  module.exports.expression.nodeTypeInfo = require("../../expression/src/node-types.json");
 } catch (_) {}
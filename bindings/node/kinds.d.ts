@@ -0,0 +1,230 @@
+// Generated by tools/gen_kinds.py from src/node-types.json. Do not edit.
+
+export declare const Kind: {
+  readonly ERROR: 0;
+  readonly COMPARISON_OPERATOR: 1;
+  readonly DJANGO_STATEMENT: 2;
+  readonly ELEMENT: 3;
+  readonly LITERAL: 4;
+  readonly AND_EXPRESSION: 5;
+  readonly AS_ALIAS: 6;
+  readonly ASSIGNMENT: 7;
+  readonly ATTRIBUTE: 8;
+  readonly ATTRIBUTE_NAME: 9;
+  readonly ATTRIBUTE_VALUE: 10;
+  readonly COMPARISON_EXPRESSION: 11;
+  readonly CYCLE_VALUE: 12;
+  readonly DJANGO_ATTRIBUTE_ELIF_BRANCH: 13;
+  readonly DJANGO_ATTRIBUTE_ELSE_BRANCH: 14;
+  readonly DJANGO_ATTRIBUTE_EMPTY_BRANCH: 15;
+  readonly DJANGO_ATTRIBUTE_FOR_BLOCK: 16;
+  readonly DJANGO_ATTRIBUTE_IF_BLOCK: 17;
+  readonly DJANGO_AUTOESCAPE_BLOCK: 18;
+  readonly DJANGO_BLOCK_BLOCK: 19;
+  readonly DJANGO_BLOCK_COMMENT: 20;
+  readonly DJANGO_BLOCK_OPEN: 21;
+  readonly DJANGO_CSRF_TOKEN_TAG: 22;
+  readonly DJANGO_CYCLE_TAG: 23;
+  readonly DJANGO_DEBUG_TAG: 24;
+  readonly DJANGO_ELIF: 25;
+  readonly DJANGO_ELIF_BRANCH: 26;
+  readonly DJANGO_ELSE: 27;
+  readonly DJANGO_ELSE_BRANCH: 28;
+  readonly DJANGO_EMPTY: 29;
+  readonly DJANGO_EMPTY_BRANCH: 30;
+  readonly DJANGO_ENDBLOCK: 31;
+  readonly DJANGO_ENDFOR: 32;
+  readonly DJANGO_ENDIF: 33;
+  readonly DJANGO_ENDWITH: 34;
+  readonly DJANGO_EXTENDS_TAG: 35;
+  readonly DJANGO_FILTER_BLOCK: 36;
+  readonly DJANGO_FIRSTOF_TAG: 37;
+  readonly DJANGO_FOR_BLOCK: 38;
+  readonly DJANGO_FOR_OPEN: 39;
+  readonly DJANGO_GENERIC_BLOCK: 40;
+  readonly DJANGO_GENERIC_TAG: 41;
+  readonly DJANGO_IF_BLOCK: 42;
+  readonly DJANGO_IF_OPEN: 43;
+  readonly DJANGO_IFCHANGED_BLOCK: 44;
+  readonly DJANGO_INCLUDE_TAG: 45;
+  readonly DJANGO_INTERPOLATION: 46;
+  readonly DJANGO_LOAD_TAG: 47;
+  readonly DJANGO_LOREM_TAG: 48;
+  readonly DJANGO_NOW_TAG: 49;
+  readonly DJANGO_PARTIAL_TAG: 50;
+  readonly DJANGO_PARTIALDEF_BLOCK: 51;
+  readonly DJANGO_QUERYSTRING_TAG: 52;
+  readonly DJANGO_REGROUP_TAG: 53;
+  readonly DJANGO_RESETCYCLE_TAG: 54;
+  readonly DJANGO_SPACELESS_BLOCK: 55;
+  readonly DJANGO_TEMPLATETAG_TAG: 56;
+  readonly DJANGO_URL_TAG: 57;
+  readonly DJANGO_VERBATIM_BLOCK: 58;
+  readonly DJANGO_WIDTHRATIO_TAG: 59;
+  readonly DJANGO_WITH_BLOCK: 60;
+  readonly DJANGO_WITH_OPEN: 61;
+  readonly DOCTYPE: 62;
+  readonly DOCUMENT: 63;
+  readonly END_TAG: 64;
+  readonly ERRONEOUS_END_TAG: 65;
+  readonly FILTER_ARGUMENT: 66;
+  readonly FILTER_CALL: 67;
+  readonly FILTER_CHAIN: 68;
+  readonly FILTER_EXPRESSION: 69;
+  readonly FOREIGN_ELEMENT: 70;
+  readonly LOOKUP: 71;
+  readonly LOOP_VARIABLES: 72;
+  readonly NAMED_ARGUMENT: 73;
+  readonly NORMAL_ELEMENT: 74;
+  readonly NOT_EXPRESSION: 75;
+  readonly OR_EXPRESSION: 76;
+  readonly PLAINTEXT_ELEMENT: 77;
+  readonly QUOTED_ATTRIBUTE_VALUE: 78;
+  readonly RAW_TEXT: 79;
+  readonly RCDATA_ELEMENT: 80;
+  readonly SCRIPT_ELEMENT: 81;
+  readonly START_TAG: 82;
+  readonly STRING: 83;
+  readonly STYLE_ELEMENT: 84;
+  readonly TAG_ARGUMENT: 85;
+  readonly TEST_EXPRESSION: 86;
+  readonly TEXT: 87;
+  readonly UNPAIRED_END_TAG: 88;
+  readonly UNPAIRED_START_TAG: 89;
+  readonly VOID_ELEMENT: 90;
+  readonly WITH_ASSIGNMENTS: 91;
+  readonly WITH_LEGACY: 92;
+  readonly ANON_DQUOTE: 93;
+  readonly ANON_PERCENT_RBRACE: 94;
+  readonly ANON_SQUOTE: 95;
+  readonly ANON_COMMA: 96;
+  readonly ANON_DOT: 97;
+  readonly ANON_SLASH_GT: 98;
+  readonly ANON_COLON: 99;
+  readonly ANON_LT: 100;
+  readonly ANON_LT_BANG: 101;
+  readonly ANON_LT_SLASH: 102;
+  readonly ANON_EQ: 103;
+  readonly ANON_GT: 104;
+  readonly ANON_AND: 105;
+  readonly AND_KEYWORD: 106;
+  readonly ARGUMENT_NAME: 107;
+  readonly ANON_AS: 108;
+  readonly ANON_AUTOESCAPE: 109;
+  readonly AUTOESCAPE_VALUE: 110;
+  readonly ANON_BLOCK: 111;
+  readonly BLOCK_NAME: 112;
+  readonly ANON_BY: 113;
+  readonly COMMENT: 114;
+  readonly ANON_COMMENT: 115;
+  readonly COMMENT_CONTENT: 116;
+  readonly COMMENT_TEXT: 117;
+  readonly ANON_CSRF_TOKEN: 118;
+  readonly ANON_CYCLE: 119;
+  readonly CYCLE_NAME: 120;
+  readonly ANON_DEBUG: 121;
+  readonly DJANGO_LINE_COMMENT: 122;
+  readonly DOCTYPE_KEYWORD: 123;
+  readonly ANON_ELIF: 124;
+  readonly ANON_ELSE: 125;
+  readonly ANON_EMPTY: 126;
+  readonly END_TAG_NAME: 127;
+  readonly ANON_ENDAUTOESCAPE: 128;
+  readonly ANON_ENDBLOCK: 129;
+  readonly ANON_ENDCOMMENT: 130;
+  readonly ANON_ENDFILTER: 131;
+  readonly ANON_ENDFOR: 132;
+  readonly ANON_ENDIF: 133;
+  readonly ANON_ENDIFCHANGED: 134;
+  readonly ANON_ENDPARTIALDEF: 135;
+  readonly ANON_ENDSPACELESS: 136;
+  readonly ANON_ENDWITH: 137;
+  readonly ENTITY: 138;
+  readonly ERRONEOUS_END_TAG_NAME: 139;
+  readonly ANON_EXTENDS: 140;
+  readonly ANON_FILTER: 141;
+  readonly FILTER_NAME: 142;
+  readonly ANON_FIRSTOF: 143;
+  readonly ANON_FOR: 144;
+  readonly ANON_FROM: 145;
+  readonly GENERIC_TAG_NAME: 146;
+  readonly I18N_STRING: 147;
+  readonly IDENTIFIER: 148;
+  readonly ANON_IF: 149;
+  readonly ANON_IFCHANGED: 150;
+  readonly IMPLICIT_END_TAG: 151;
+  readonly ANON_IN: 152;
+  readonly ANON_INCLUDE: 153;
+  readonly INLINE: 154;
+  readonly LIBRARY_NAME: 155;
+  readonly ANON_LOAD: 156;
+  readonly ANON_LOREM: 157;
+  readonly METHOD: 158;
+  readonly NAME_SEGMENT: 159;
+  readonly ANON_NOT: 160;
+  readonly ANON_NOW: 161;
+  readonly NUMBER: 162;
+  readonly NUMERIC_INDEX: 163;
+  readonly ONLY: 164;
+  readonly OP_EQ: 165;
+  readonly OP_GT: 166;
+  readonly OP_GTE: 167;
+  readonly OP_IN: 168;
+  readonly OP_IS: 169;
+  readonly OP_IS_NOT: 170;
+  readonly OP_LT: 171;
+  readonly OP_LTE: 172;
+  readonly OP_NE: 173;
+  readonly OP_NOT_IN: 174;
+  readonly OR_KEYWORD: 175;
+  readonly ANON_PARTIAL: 176;
+  readonly PARTIAL_NAME: 177;
+  readonly ANON_PARTIALDEF: 178;
+  readonly PLAINTEXT_TEXT: 179;
+  readonly ANON_QUERYSTRING: 180;
+  readonly RANDOM: 181;
+  readonly RCDATA_TEXT: 182;
+  readonly ANON_REGROUP: 183;
+  readonly ANON_RESETCYCLE: 184;
+  readonly REVERSED: 185;
+  readonly SILENT: 186;
+  readonly ANON_SPACELESS: 187;
+  readonly TAG_NAME: 188;
+  readonly ANON_TEMPLATETAG: 189;
+  readonly TEMPLATETAG_ARGUMENT: 190;
+  readonly ANON_URL: 191;
+  readonly VARIABLE_NAME: 192;
+  readonly ANON_VERBATIM: 193;
+  readonly VERBATIM_CONTENT: 194;
+  readonly ANON_WIDTHRATIO: 195;
+  readonly ANON_WITH: 196;
+  readonly ANON_LBRACE_PERCENT: 197;
+  readonly ANON_LBRACE_LBRACE: 198;
+  readonly ANON_PIPE: 199;
+  readonly ANON_RBRACE_RBRACE: 200;
+};
+
+export declare const Field: {
+  readonly NONE: 0;
+  readonly ALIAS: 1;
+  readonly ARGUMENT: 2;
+  readonly BODY: 3;
+  readonly CONDITION: 4;
+  readonly COUNT: 5;
+  readonly END_NAME: 6;
+  readonly FILTERS: 7;
+  readonly FORMAT: 8;
+  readonly GROUPER: 9;
+  readonly ITERABLE: 10;
+  readonly MAX_VALUE: 11;
+  readonly MAX_WIDTH: 12;
+  readonly NAME: 13;
+  readonly SOURCE: 14;
+  readonly TARGET: 15;
+  readonly TEMPLATE: 16;
+  readonly URL_NAME: 17;
+  readonly VALUE: 18;
+};
+
+export declare const kindNames: readonly (readonly [string, boolean])[];
+export declare const fieldNames: readonly string[];
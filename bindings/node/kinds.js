@@ -0,0 +1,458 @@
+// Generated by tools/gen_kinds.py from src/node-types.json. Do not edit.
+
+"use strict";
+
+const Kind = Object.freeze({
+  ERROR: 0,
+  COMPARISON_OPERATOR: 1,
+  DJANGO_STATEMENT: 2,
+  ELEMENT: 3,
+  LITERAL: 4,
+  AND_EXPRESSION: 5,
+  AS_ALIAS: 6,
+  ASSIGNMENT: 7,
+  ATTRIBUTE: 8,
+  ATTRIBUTE_NAME: 9,
+  ATTRIBUTE_VALUE: 10,
+  COMPARISON_EXPRESSION: 11,
+  CYCLE_VALUE: 12,
+  DJANGO_ATTRIBUTE_ELIF_BRANCH: 13,
+  DJANGO_ATTRIBUTE_ELSE_BRANCH: 14,
+  DJANGO_ATTRIBUTE_EMPTY_BRANCH: 15,
+  DJANGO_ATTRIBUTE_FOR_BLOCK: 16,
+  DJANGO_ATTRIBUTE_IF_BLOCK: 17,
+  DJANGO_AUTOESCAPE_BLOCK: 18,
+  DJANGO_BLOCK_BLOCK: 19,
+  DJANGO_BLOCK_COMMENT: 20,
+  DJANGO_BLOCK_OPEN: 21,
+  DJANGO_CSRF_TOKEN_TAG: 22,
+  DJANGO_CYCLE_TAG: 23,
+  DJANGO_DEBUG_TAG: 24,
+  DJANGO_ELIF: 25,
+  DJANGO_ELIF_BRANCH: 26,
+  DJANGO_ELSE: 27,
+  DJANGO_ELSE_BRANCH: 28,
+  DJANGO_EMPTY: 29,
+  DJANGO_EMPTY_BRANCH: 30,
+  DJANGO_ENDBLOCK: 31,
+  DJANGO_ENDFOR: 32,
+  DJANGO_ENDIF: 33,
+  DJANGO_ENDWITH: 34,
+  DJANGO_EXTENDS_TAG: 35,
+  DJANGO_FILTER_BLOCK: 36,
+  DJANGO_FIRSTOF_TAG: 37,
+  DJANGO_FOR_BLOCK: 38,
+  DJANGO_FOR_OPEN: 39,
+  DJANGO_GENERIC_BLOCK: 40,
+  DJANGO_GENERIC_TAG: 41,
+  DJANGO_IF_BLOCK: 42,
+  DJANGO_IF_OPEN: 43,
+  DJANGO_IFCHANGED_BLOCK: 44,
+  DJANGO_INCLUDE_TAG: 45,
+  DJANGO_INTERPOLATION: 46,
+  DJANGO_LOAD_TAG: 47,
+  DJANGO_LOREM_TAG: 48,
+  DJANGO_NOW_TAG: 49,
+  DJANGO_PARTIAL_TAG: 50,
+  DJANGO_PARTIALDEF_BLOCK: 51,
+  DJANGO_QUERYSTRING_TAG: 52,
+  DJANGO_REGROUP_TAG: 53,
+  DJANGO_RESETCYCLE_TAG: 54,
+  DJANGO_SPACELESS_BLOCK: 55,
+  DJANGO_TEMPLATETAG_TAG: 56,
+  DJANGO_URL_TAG: 57,
+  DJANGO_VERBATIM_BLOCK: 58,
+  DJANGO_WIDTHRATIO_TAG: 59,
+  DJANGO_WITH_BLOCK: 60,
+  DJANGO_WITH_OPEN: 61,
+  DOCTYPE: 62,
+  DOCUMENT: 63,
+  END_TAG: 64,
+  ERRONEOUS_END_TAG: 65,
+  FILTER_ARGUMENT: 66,
+  FILTER_CALL: 67,
+  FILTER_CHAIN: 68,
+  FILTER_EXPRESSION: 69,
+  FOREIGN_ELEMENT: 70,
+  LOOKUP: 71,
+  LOOP_VARIABLES: 72,
+  NAMED_ARGUMENT: 73,
+  NORMAL_ELEMENT: 74,
+  NOT_EXPRESSION: 75,
+  OR_EXPRESSION: 76,
+  PLAINTEXT_ELEMENT: 77,
+  QUOTED_ATTRIBUTE_VALUE: 78,
+  RAW_TEXT: 79,
+  RCDATA_ELEMENT: 80,
+  SCRIPT_ELEMENT: 81,
+  START_TAG: 82,
+  STRING: 83,
+  STYLE_ELEMENT: 84,
+  TAG_ARGUMENT: 85,
+  TEST_EXPRESSION: 86,
+  TEXT: 87,
+  UNPAIRED_END_TAG: 88,
+  UNPAIRED_START_TAG: 89,
+  VOID_ELEMENT: 90,
+  WITH_ASSIGNMENTS: 91,
+  WITH_LEGACY: 92,
+  ANON_DQUOTE: 93,
+  ANON_PERCENT_RBRACE: 94,
+  ANON_SQUOTE: 95,
+  ANON_COMMA: 96,
+  ANON_DOT: 97,
+  ANON_SLASH_GT: 98,
+  ANON_COLON: 99,
+  ANON_LT: 100,
+  ANON_LT_BANG: 101,
+  ANON_LT_SLASH: 102,
+  ANON_EQ: 103,
+  ANON_GT: 104,
+  ANON_AND: 105,
+  AND_KEYWORD: 106,
+  ARGUMENT_NAME: 107,
+  ANON_AS: 108,
+  ANON_AUTOESCAPE: 109,
+  AUTOESCAPE_VALUE: 110,
+  ANON_BLOCK: 111,
+  BLOCK_NAME: 112,
+  ANON_BY: 113,
+  COMMENT: 114,
+  ANON_COMMENT: 115,
+  COMMENT_CONTENT: 116,
+  COMMENT_TEXT: 117,
+  ANON_CSRF_TOKEN: 118,
+  ANON_CYCLE: 119,
+  CYCLE_NAME: 120,
+  ANON_DEBUG: 121,
+  DJANGO_LINE_COMMENT: 122,
+  DOCTYPE_KEYWORD: 123,
+  ANON_ELIF: 124,
+  ANON_ELSE: 125,
+  ANON_EMPTY: 126,
+  END_TAG_NAME: 127,
+  ANON_ENDAUTOESCAPE: 128,
+  ANON_ENDBLOCK: 129,
+  ANON_ENDCOMMENT: 130,
+  ANON_ENDFILTER: 131,
+  ANON_ENDFOR: 132,
+  ANON_ENDIF: 133,
+  ANON_ENDIFCHANGED: 134,
+  ANON_ENDPARTIALDEF: 135,
+  ANON_ENDSPACELESS: 136,
+  ANON_ENDWITH: 137,
+  ENTITY: 138,
+  ERRONEOUS_END_TAG_NAME: 139,
+  ANON_EXTENDS: 140,
+  ANON_FILTER: 141,
+  FILTER_NAME: 142,
+  ANON_FIRSTOF: 143,
+  ANON_FOR: 144,
+  ANON_FROM: 145,
+  GENERIC_TAG_NAME: 146,
+  I18N_STRING: 147,
+  IDENTIFIER: 148,
+  ANON_IF: 149,
+  ANON_IFCHANGED: 150,
+  IMPLICIT_END_TAG: 151,
+  ANON_IN: 152,
+  ANON_INCLUDE: 153,
+  INLINE: 154,
+  LIBRARY_NAME: 155,
+  ANON_LOAD: 156,
+  ANON_LOREM: 157,
+  METHOD: 158,
+  NAME_SEGMENT: 159,
+  ANON_NOT: 160,
+  ANON_NOW: 161,
+  NUMBER: 162,
+  NUMERIC_INDEX: 163,
+  ONLY: 164,
+  OP_EQ: 165,
+  OP_GT: 166,
+  OP_GTE: 167,
+  OP_IN: 168,
+  OP_IS: 169,
+  OP_IS_NOT: 170,
+  OP_LT: 171,
+  OP_LTE: 172,
+  OP_NE: 173,
+  OP_NOT_IN: 174,
+  OR_KEYWORD: 175,
+  ANON_PARTIAL: 176,
+  PARTIAL_NAME: 177,
+  ANON_PARTIALDEF: 178,
+  PLAINTEXT_TEXT: 179,
+  ANON_QUERYSTRING: 180,
+  RANDOM: 181,
+  RCDATA_TEXT: 182,
+  ANON_REGROUP: 183,
+  ANON_RESETCYCLE: 184,
+  REVERSED: 185,
+  SILENT: 186,
+  ANON_SPACELESS: 187,
+  TAG_NAME: 188,
+  ANON_TEMPLATETAG: 189,
+  TEMPLATETAG_ARGUMENT: 190,
+  ANON_URL: 191,
+  VARIABLE_NAME: 192,
+  ANON_VERBATIM: 193,
+  VERBATIM_CONTENT: 194,
+  ANON_WIDTHRATIO: 195,
+  ANON_WITH: 196,
+  ANON_LBRACE_PERCENT: 197,
+  ANON_LBRACE_LBRACE: 198,
+  ANON_PIPE: 199,
+  ANON_RBRACE_RBRACE: 200,
+});
+
+const Field = Object.freeze({
+  NONE: 0,
+  ALIAS: 1,
+  ARGUMENT: 2,
+  BODY: 3,
+  CONDITION: 4,
+  COUNT: 5,
+  END_NAME: 6,
+  FILTERS: 7,
+  FORMAT: 8,
+  GROUPER: 9,
+  ITERABLE: 10,
+  MAX_VALUE: 11,
+  MAX_WIDTH: 12,
+  NAME: 13,
+  SOURCE: 14,
+  TARGET: 15,
+  TEMPLATE: 16,
+  URL_NAME: 17,
+  VALUE: 18,
+});
+
+/** [type, named] by kind ID */
+const kindNames = Object.freeze([
+  ["ERROR", true],
+  ["comparison_operator", true],
+  ["django_statement", true],
+  ["element", true],
+  ["literal", true],
+  ["and_expression", true],
+  ["as_alias", true],
+  ["assignment", true],
+  ["attribute", true],
+  ["attribute_name", true],
+  ["attribute_value", true],
+  ["comparison_expression", true],
+  ["cycle_value", true],
+  ["django_attribute_elif_branch", true],
+  ["django_attribute_else_branch", true],
+  ["django_attribute_empty_branch", true],
+  ["django_attribute_for_block", true],
+  ["django_attribute_if_block", true],
+  ["django_autoescape_block", true],
+  ["django_block_block", true],
+  ["django_block_comment", true],
+  ["django_block_open", true],
+  ["django_csrf_token_tag", true],
+  ["django_cycle_tag", true],
+  ["django_debug_tag", true],
+  ["django_elif", true],
+  ["django_elif_branch", true],
+  ["django_else", true],
+  ["django_else_branch", true],
+  ["django_empty", true],
+  ["django_empty_branch", true],
+  ["django_endblock", true],
+  ["django_endfor", true],
+  ["django_endif", true],
+  ["django_endwith", true],
+  ["django_extends_tag", true],
+  ["django_filter_block", true],
+  ["django_firstof_tag", true],
+  ["django_for_block", true],
+  ["django_for_open", true],
+  ["django_generic_block", true],
+  ["django_generic_tag", true],
+  ["django_if_block", true],
+  ["django_if_open", true],
+  ["django_ifchanged_block", true],
+  ["django_include_tag", true],
+  ["django_interpolation", true],
+  ["django_load_tag", true],
+  ["django_lorem_tag", true],
+  ["django_now_tag", true],
+  ["django_partial_tag", true],
+  ["django_partialdef_block", true],
+  ["django_querystring_tag", true],
+  ["django_regroup_tag", true],
+  ["django_resetcycle_tag", true],
+  ["django_spaceless_block", true],
+  ["django_templatetag_tag", true],
+  ["django_url_tag", true],
+  ["django_verbatim_block", true],
+  ["django_widthratio_tag", true],
+  ["django_with_block", true],
+  ["django_with_open", true],
+  ["doctype", true],
+  ["document", true],
+  ["end_tag", true],
+  ["erroneous_end_tag", true],
+  ["filter_argument", true],
+  ["filter_call", true],
+  ["filter_chain", true],
+  ["filter_expression", true],
+  ["foreign_element", true],
+  ["lookup", true],
+  ["loop_variables", true],
+  ["named_argument", true],
+  ["normal_element", true],
+  ["not_expression", true],
+  ["or_expression", true],
+  ["plaintext_element", true],
+  ["quoted_attribute_value", true],
+  ["raw_text", true],
+  ["rcdata_element", true],
+  ["script_element", true],
+  ["start_tag", true],
+  ["string", true],
+  ["style_element", true],
+  ["tag_argument", true],
+  ["test_expression", true],
+  ["text", true],
+  ["unpaired_end_tag", true],
+  ["unpaired_start_tag", true],
+  ["void_element", true],
+  ["with_assignments", true],
+  ["with_legacy", true],
+  ["\"", false],
+  ["%}", false],
+  ["'", false],
+  [",", false],
+  [".", false],
+  ["/>", false],
+  [":", false],
+  ["<", false],
+  ["<!", false],
+  ["</", false],
+  ["=", false],
+  [">", false],
+  ["and", false],
+  ["and_keyword", true],
+  ["argument_name", true],
+  ["as", false],
+  ["autoescape", false],
+  ["autoescape_value", true],
+  ["block", false],
+  ["block_name", true],
+  ["by", false],
+  ["comment", true],
+  ["comment", false],
+  ["comment_content", true],
+  ["comment_text", true],
+  ["csrf_token", false],
+  ["cycle", false],
+  ["cycle_name", true],
+  ["debug", false],
+  ["django_line_comment", true],
+  ["doctype_keyword", true],
+  ["elif", false],
+  ["else", false],
+  ["empty", false],
+  ["end_tag_name", true],
+  ["endautoescape", false],
+  ["endblock", false],
+  ["endcomment", false],
+  ["endfilter", false],
+  ["endfor", false],
+  ["endif", false],
+  ["endifchanged", false],
+  ["endpartialdef", false],
+  ["endspaceless", false],
+  ["endwith", false],
+  ["entity", true],
+  ["erroneous_end_tag_name", true],
+  ["extends", false],
+  ["filter", false],
+  ["filter_name", true],
+  ["firstof", false],
+  ["for", false],
+  ["from", false],
+  ["generic_tag_name", true],
+  ["i18n_string", true],
+  ["identifier", true],
+  ["if", false],
+  ["ifchanged", false],
+  ["implicit_end_tag", true],
+  ["in", false],
+  ["include", false],
+  ["inline", true],
+  ["library_name", true],
+  ["load", false],
+  ["lorem", false],
+  ["method", true],
+  ["name_segment", true],
+  ["not", false],
+  ["now", false],
+  ["number", true],
+  ["numeric_index", true],
+  ["only", true],
+  ["op_eq", true],
+  ["op_gt", true],
+  ["op_gte", true],
+  ["op_in", true],
+  ["op_is", true],
+  ["op_is_not", true],
+  ["op_lt", true],
+  ["op_lte", true],
+  ["op_ne", true],
+  ["op_not_in", true],
+  ["or_keyword", true],
+  ["partial", false],
+  ["partial_name", true],
+  ["partialdef", false],
+  ["plaintext_text", true],
+  ["querystring", false],
+  ["random", true],
+  ["rcdata_text", true],
+  ["regroup", false],
+  ["resetcycle", false],
+  ["reversed", true],
+  ["silent", true],
+  ["spaceless", false],
+  ["tag_name", true],
+  ["templatetag", false],
+  ["templatetag_argument", true],
+  ["url", false],
+  ["variable_name", true],
+  ["verbatim", false],
+  ["verbatim_content", true],
+  ["widthratio", false],
+  ["with", false],
+  ["{%", false],
+  ["{{", false],
+  ["|", false],
+  ["}}", false],
+]);
+
+const fieldNames = Object.freeze([
+  "",
+  "alias",
+  "argument",
+  "body",
+  "condition",
+  "count",
+  "end_name",
+  "filters",
+  "format",
+  "grouper",
+  "iterable",
+  "max_value",
+  "max_width",
+  "name",
+  "source",
+  "target",
+  "template",
+  "url_name",
+  "value",
+]);
+
+module.exports = { Kind, Field, kindNames, fieldNames };
@@ -1,4 +1,9 @@
-from unittest import TestCase
+import errno
+import os
+import platform
+import struct
+import tempfile
+from unittest import TestCase, skipIf
 
 import tree_sitter, tree_sitter_htmldjango
 
@@ -9,3 +14,144 @@ class TestLanguage(TestCase):
             tree_sitter.Language(tree_sitter_htmldjango.language())
         except Exception:
             self.fail("Error loading Joint HTML + Django grammar")
+
+    def test_can_load_expression_grammar(self):
+        try:
+            tree_sitter.Language(tree_sitter_htmldjango.language_expression())
+        except Exception:
+            self.fail("Error loading Django expression grammar")
+
+    def test_parse_file(self):
+        parser = tree_sitter.Parser(tree_sitter.Language(tree_sitter_htmldjango.language()))
+        with tempfile.TemporaryDirectory() as directory:
+            path = os.path.join(directory, "page.html")
+            with open(path, "wb") as file:
+                file.write(b"{% if user %}<p>{{ user.name }}</p>{% endif %}")
+            tree = tree_sitter_htmldjango.parse_file(parser, path)
+            self.assertFalse(tree.root_node.has_error)
+            self.assertEqual(tree.root_node.child(0).type, "django_if_block")
+
+    def test_script_injections(self):
+        language = tree_sitter.Language(tree_sitter_htmldjango.language())
+        tree = tree_sitter.Parser(language).parse(
+            b"<script>let a = 1;</script>"
+            b'<script type="module">import b from "b";</script>'
+            b"<script type=text/javascript>c();</script>"
+            b'<script type="application/ld+json">{"name": "{{ name }}"}</script>'
+            b'<script type="importmap">{"imports": {}}</script>'
+            b'<script type="text/x-template"><p>{{ x }}</p></script>'
+            b'<script type="text/plain">notes</script>'
+            b"<style>p { color: red; }</style>")
+        query = tree_sitter.Query(language, tree_sitter_htmldjango.INJECTIONS_QUERY)
+        injected = sorted(
+            (node.start_byte, query.pattern_settings(pattern)["injection.language"], node.text)
+            for pattern, captures in tree_sitter.QueryCursor(query).matches(tree.root_node)
+            for node in captures.get("injection.content", []))
+        self.assertEqual([(language, text) for _, language, text in injected], [
+            ("javascript", b"let a = 1;"),
+            ("javascript", b'import b from "b";'),
+            ("javascript", b"c();"),
+            ("json", b'{"name": "'),
+            ("json", b'"}'),
+            ("json", b'{"imports": {}}'),
+            ("html", b"<p>"),
+            ("html", b"</p>"),
+            ("css", b"p { color: red; }"),
+        ])
+
+    def test_locals_attribute_for(self):
+        language = tree_sitter.Language(tree_sitter_htmldjango.language())
+        source = b'<div {% for a in attrs %}{{ a.name }}="{{ a.value }}" {% endfor %}>{{ a }}</div>'
+        tree = tree_sitter.Parser(language).parse(source)
+        query = tree_sitter.Query(language, tree_sitter_htmldjango.LOCALS_QUERY)
+        captures = tree_sitter.QueryCursor(query).captures(tree.root_node)
+        scopes = sorted(captures["local.scope"], key=lambda node: node.start_byte)
+        self.assertEqual([node.type for node in scopes], ["document", "django_attribute_for_block"])
+        loop = scopes[1]
+        definitions = captures["local.definition"]
+        self.assertEqual([node.text for node in definitions], [b"a"])
+        self.assertTrue(loop.start_byte <= definitions[0].start_byte < loop.end_byte)
+        # The a in the element's content is outside the loop's scope
+        references = sorted(node.start_byte for node in captures["local.reference"])
+        self.assertEqual(len(references), 4)
+        self.assertEqual([loop.start_byte <= start < loop.end_byte for start in references],
+                         [True, True, True, False])
+
+    # A build without _batch anywhere else fails this test rather than skipping it
+    @skipIf(platform.system() == "Windows" or os.environ.get("TREE_SITTER_HTMLDJANGO_BATCH") == "0",
+            "built without the _batch extension")
+    def test_parse_batch(self):
+        with tempfile.TemporaryDirectory() as directory:
+            path = os.path.join(directory, "page.html")
+            with open(path, "wb") as file:
+                file.write(b"{% extends 'base.html' %}{% load static %}")
+            sources = [b"{% include 'card.html' %}<p>{{ x }}</p>", path,
+                       os.path.join(directory, "missing.html"), b"<p>{% if %}</p>"]
+            included, extending, missing, broken = tree_sitter_htmldjango.parse_batch(
+                sources, threads=2, trees=True)
+
+        self.assertFalse(included.has_error)
+        self.assertEqual(included.dependencies, [("include", "card.html", 0, 25)])
+        self.assertEqual(included.tree.root.kind, "document")
+        self.assertEqual(len(included.tree), included.node_count)
+        self.assertEqual([(d.kind, d.target) for d in extending.dependencies],
+                         [("extends", "base.html"), ("load", "static")])
+        self.assertEqual(missing.read_error, errno.ENOENT)
+        self.assertIsNone(missing.tree)
+        self.assertTrue(broken.has_error)
+        self.assertTrue(broken.error_ranges)
+        self.assertIsNone(tree_sitter_htmldjango.parse_batch([b"x"], dependencies=False)[0].tree)
+
+    def test_block_map(self):
+        source = (b"{% extends 'base.html' %}{% block content %}{{ block.super }}"
+                  b"{% block inner %}x{% endblock inner %}{% endblock %}")
+        blocks, supers = tree_sitter_htmldjango.block_map(source)
+        self.assertEqual([block.name for block in blocks], ["content", "inner"])
+        self.assertEqual(blocks[1].parent, 0)
+        self.assertEqual(blocks[1].depth, 1)
+        self.assertEqual(source[blocks[1].content_start_byte:blocks[1].content_end_byte], b"x")
+        self.assertEqual(blocks[0].end_byte, len(source))
+        self.assertEqual(blocks[0].super_count, 1)
+        self.assertEqual(source[supers[0].start_byte:supers[0].end_byte], b"{{ block.super }}")
+
+    def test_kinds(self):
+        from tree_sitter_htmldjango import kinds
+
+        parser = tree_sitter.Parser(tree_sitter.Language(tree_sitter_htmldjango.language()))
+        tree = parser.parse(b"{% block content %}<p>{{ x }}</p>{% endblock %}")
+        block = tree.root_node.child(0)
+        self.assertEqual(tree_sitter_htmldjango.node_kind(block), kinds.KIND_DJANGO_BLOCK_BLOCK)
+        cursor = block.walk()
+        cursor.goto_first_child()
+        self.assertEqual(tree_sitter_htmldjango.node_kind(cursor.node), kinds.KIND_DJANGO_BLOCK_OPEN)
+        for symbol, kind in enumerate(tree_sitter_htmldjango.symbol_kinds()):
+            if kind != kinds.KIND_ERROR:
+                self.assertEqual(kinds.KIND_NAMES[kind][0], tree.language.node_kind_for_id(symbol))
+
+    def test_cst(self):
+        # (kind, field, flags, start, end, parent, next)
+        nodes = [(1, 0, 0x11, 0, 12, 0xFFFFFFFF, 4), (2, 1, 0x11, 0, 10, 0, 3),
+                 (0, 0, 0x19, 6, 7, 1, 3), (3, 0, 0, 10, 12, 0, 4)]
+        names = [b"ERROR", b"template", b"django_if_block", b"{%", b"", b"condition"]
+        names_offset = 32 + 24 * len(nodes)
+        table, strings = b"", b""
+        for name in names:
+            table += struct.pack("<I", 4 * len(names) + len(strings))
+            strings += name + b"\0"
+        total = names_offset + len(table) + len(strings)
+        data = struct.pack("<4sHH6I", b"HDJC", 1, 32, len(nodes), 4, 2, names_offset, total, 0)
+        data += b"".join(struct.pack("<4H4I", k, f, fl, 0, s, e, p, n) for k, f, fl, s, e, p, n in nodes)
+        data += table + strings
+
+        cst = tree_sitter_htmldjango.CST(data)
+        self.assertEqual(len(cst), 4)
+        self.assertEqual(cst.root.kind, "template")
+        self.assertEqual([child.kind for child in cst.root.children], ["django_if_block", "{%"])
+        block = cst.root.children[0]
+        self.assertEqual(block.field_name, "condition")
+        self.assertTrue(block.children[0].is_error)
+        self.assertEqual(block.children[0].parent, block)
+        self.assertFalse(cst.node(3).is_named)
+        self.assertEqual(sum(node.has_error for node in cst), 3)
+        with self.assertRaises(ValueError):
+            tree_sitter_htmldjango.CST(data[:-1])
@@ -1,8 +1,18 @@
 """HTML + Django template grammar for tree-sitter"""
 
+import mmap as _mmap
+import os as _os
 from importlib.resources import files as _files
+from typing import NamedTuple as _NamedTuple
 
-from ._binding import language
+from . import kinds
+from ._binding import block_map as _block_map, field_ids, language, language_expression, symbol_kinds
+from .cst import CST
+
+try:
+    from ._batch import parse_batch as _parse_batch
+except ImportError:
+    _parse_batch = None
 
 
 def _get_query(name, file):
@@ -11,19 +21,173 @@ def _get_query(name, file):
     return globals()[name]
 
 
+def parse_file(parser, path, old_tree=None):
+    """Parse a template straight from a read-only memory map of the file.
+
+    The parser reads the mapped pages in place, so a large template is never
+    copied into a bytes object. The map is closed once nothing refers to it
+    any more.
+    """
+    with open(path, "rb") as file:
+        if _os.fstat(file.fileno()).st_size == 0:
+            source = b""
+        else:
+            source = _mmap.mmap(file.fileno(), 0, access=_mmap.ACCESS_READ)
+    return parser.parse(source, old_tree=old_tree)
+
+
+class Block(_NamedTuple):
+    """A {% block %} tag pair. Offsets are in bytes; parent is an index into
+    BlockMap.blocks, or None for a top-level block."""
+
+    name: str
+    start_byte: int
+    end_byte: int
+    content_start_byte: int
+    content_end_byte: int
+    depth: int
+    parent: int | None
+    super_count: int
+    closed: bool
+
+
+class BlockSuper(_NamedTuple):
+    """A {{ block.super }} usage in the block at index block."""
+
+    block: int
+    start_byte: int
+    end_byte: int
+
+
+class BlockMap(_NamedTuple):
+    blocks: list[Block]
+    supers: list[BlockSuper]
+
+
+def block_map(source):
+    """Find the {% block %} tags and {{ block.super }} usages in a template.
+
+    This is a native scan of the source, not a tree walk, so it needs no
+    parser. Blocks come in the order their opening tags appear, which puts a
+    block's parent before it. Tags inside comment and verbatim blocks are
+    skipped.
+    """
+    if isinstance(source, str):
+        source = source.encode()
+    blocks, supers = _block_map(source)
+    return BlockMap(list(map(Block._make, blocks)), list(map(BlockSuper._make, supers)))
+
+
+class Dependency(_NamedTuple):
+    """A static dependency of a template: kind is "extends", "include",
+    "load" or "partial", and the byte range is the whole tag."""
+
+    kind: str
+    target: str
+    start_byte: int
+    end_byte: int
+
+
+class ParseSummary(_NamedTuple):
+    """What parse_batch() reports for one input. read_error is 0, or the
+    errno value from reading a path, in which case nothing else is set.
+    error_ranges are the byte ranges of the outermost ERROR and MISSING
+    nodes; tree is a CST when parse_batch() was asked for trees."""
+
+    read_error: int
+    length: int
+    node_count: int
+    has_error: bool
+    parse_seconds: float
+    error_ranges: list[tuple[int, int]]
+    dependencies: list[Dependency]
+    tree: CST | None
+
+
+_DEPENDENCY_KINDS = ("extends", "include", "load", "partial")
+
+
+def parse_batch(inputs, *, threads=0, trees=False, dependencies=True):
+    """Parse many templates on native threads with the GIL released.
+
+    Bytes-like inputs are template sources; str and os.PathLike inputs are
+    paths, which the worker threads read themselves. threads=0 uses one
+    thread per CPU. Returns a ParseSummary per input, in order. The trees
+    are binary CSTs rather than tree_sitter.Tree objects, since the parse
+    happens outside py-tree-sitter's runtime; they are only built when
+    trees is true.
+
+    Needs the _batch extension, which is built everywhere except Windows
+    unless TREE_SITTER_HTMLDJANGO_BATCH=0 left it out.
+    """
+    if _parse_batch is None:
+        raise NotImplementedError("tree_sitter_htmldjango was built without the _batch extension")
+    if threads < 0:
+        raise ValueError("threads must not be negative")
+    return [
+        ParseSummary(read_error, length, node_count, has_error, parse_seconds, error_ranges,
+                     [Dependency(_DEPENDENCY_KINDS[kind], *rest) for kind, *rest in found],
+                     CST(tree) if tree is not None else None)
+        for read_error, length, node_count, has_error, parse_seconds, error_ranges, found, tree
+        in _parse_batch(inputs, threads, trees, dependencies)
+    ]
+
+
+_SYMBOL_KINDS = symbol_kinds()
+_FIELD_IDS = field_ids()
+
+
+def node_kind(node):
+    """The stable kind ID of a tree_sitter.Node, one of kinds.KIND_*.
+
+    node.kind_id changes whenever the grammar is regenerated; this only
+    changes with node-types.json. In a hot loop, index the tuple returned by
+    symbol_kinds() with node.kind_id directly; ERROR nodes are past its end.
+    """
+    symbol = node.kind_id
+    return _SYMBOL_KINDS[symbol] if symbol < len(_SYMBOL_KINDS) else kinds.KIND_ERROR
+
+
+def cursor_field(cursor):
+    """The stable field ID of a tree_sitter.TreeCursor's node, one of kinds.FIELD_*."""
+    field = cursor.field_id or 0
+    return _FIELD_IDS[field] if field < len(_FIELD_IDS) else kinds.FIELD_NONE
+
+
 def __getattr__(name):
     if name == "HIGHLIGHTS_QUERY":
         return _get_query("HIGHLIGHTS_QUERY", "highlights.scm")
     if name == "INJECTIONS_QUERY":
         return _get_query("INJECTIONS_QUERY", "injections.scm")
+    if name == "TAGS_QUERY":
+        return _get_query("TAGS_QUERY", "tags.scm")
+    if name == "LOCALS_QUERY":
+        return _get_query("LOCALS_QUERY", "locals.scm")
 
     raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
 
 
 __all__ = [
     "language",
+    "language_expression",
+    "parse_file",
+    "parse_batch",
+    "ParseSummary",
+    "Dependency",
+    "block_map",
+    "Block",
+    "BlockMap",
+    "BlockSuper",
+    "CST",
+    "kinds",
+    "node_kind",
+    "cursor_field",
+    "symbol_kinds",
+    "field_ids",
     "HIGHLIGHTS_QUERY",
     "INJECTIONS_QUERY",
+    "TAGS_QUERY",
+    "LOCALS_QUERY",
 ]
 
 
@@ -1,6 +1,73 @@
-from typing import Final
+from collections.abc import Buffer, Iterable
+from os import PathLike
+from typing import Final, NamedTuple
+
+from tree_sitter import Node, Parser, Tree, TreeCursor
+
+from . import kinds as kinds
+from .cst import CST as CST
 
 HIGHLIGHTS_QUERY: Final[str]
 INJECTIONS_QUERY: Final[str]
+TAGS_QUERY: Final[str]
+LOCALS_QUERY: Final[str]
 
 def language() -> object: ...
+
+def language_expression() -> object: ...
+
+def parse_file(parser: Parser, path: str | PathLike[str], old_tree: Tree | None = None) -> Tree: ...
+
+class Dependency(NamedTuple):
+    kind: str
+    target: str
+    start_byte: int
+    end_byte: int
+
+class ParseSummary(NamedTuple):
+    read_error: int
+    length: int
+    node_count: int
+    has_error: bool
+    parse_seconds: float
+    error_ranges: list[tuple[int, int]]
+    dependencies: list[Dependency]
+    tree: CST | None
+
+def parse_batch(
+    inputs: Iterable[Buffer | str | PathLike[str]],
+    *,
+    threads: int = 0,
+    trees: bool = False,
+    dependencies: bool = True,
+) -> list[ParseSummary]: ...
+
+class Block(NamedTuple):
+    name: str
+    start_byte: int
+    end_byte: int
+    content_start_byte: int
+    content_end_byte: int
+    depth: int
+    parent: int | None
+    super_count: int
+    closed: bool
+
+class BlockSuper(NamedTuple):
+    block: int
+    start_byte: int
+    end_byte: int
+
+class BlockMap(NamedTuple):
+    blocks: list[Block]
+    supers: list[BlockSuper]
+
+def block_map(source: str | Buffer) -> BlockMap: ...
+
+def symbol_kinds() -> tuple[int, ...]: ...
+
+def field_ids() -> tuple[int, ...]: ...
+
+def node_kind(node: Node) -> int: ...
+
+def cursor_field(cursor: TreeCursor) -> int: ...
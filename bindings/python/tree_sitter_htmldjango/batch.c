@@ -0,0 +1,283 @@
+#include <Python.h>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tree-sitter-htmldjango-tools.h"
+
+// The _batch extension. Unlike _binding it links the tree-sitter runtime and
+// the tools library, so it is only built where the runtime can be found.
+// Inputs are collected with the GIL held, parsed by htmldjango_parse_batch()
+// with it released, and turned into Python objects once it is taken back:
+// the worker threads never touch a Python object.
+
+typedef struct {
+    uint32_t start_byte;
+    uint32_t end_byte;
+} ErrorRange;
+
+// target is an offset into Result.targets, since a file's text is gone once
+// its callback returns
+typedef struct {
+    HTMLDjangoDependencyKind kind;
+    size_t target;
+    uint32_t target_length;
+    uint32_t start_byte;
+    uint32_t end_byte;
+} Dependency;
+
+typedef struct {
+    HTMLDjangoSummary summary;
+    int error;
+    ErrorRange *errors;
+    size_t error_count;
+    size_t error_capacity;
+    Dependency *dependencies;
+    size_t dependency_count;
+    size_t dependency_capacity;
+    char *targets;
+    size_t targets_length;
+    size_t targets_capacity;
+    HTMLDjangoCSTBuffer cst;
+} Result;
+
+typedef struct {
+    Result *results;
+    bool trees;
+    bool dependencies;
+} Batch;
+
+static bool grow(void **items, size_t *capacity, size_t needed, size_t size) {
+    if (needed <= *capacity) return true;
+    size_t new_capacity = *capacity ? *capacity * 2 : 8;
+    while (new_capacity < needed) new_capacity *= 2;
+    void *grown = realloc(*items, new_capacity * size);
+    if (!grown) return false;
+    *items = grown;
+    *capacity = new_capacity;
+    return true;
+}
+
+// Records the outermost ERROR and MISSING nodes, skipping subtrees without
+// errors
+static bool collect_errors(Result *result, TSNode root) {
+    TSTreeCursor cursor = ts_tree_cursor_new(root);
+    bool ok = true;
+    for (;;) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        bool descend = false;
+        if (ts_node_is_error(node) || ts_node_is_missing(node)) {
+            ok = grow((void **)&result->errors, &result->error_capacity, result->error_count + 1, sizeof(ErrorRange));
+            if (!ok) break;
+            result->errors[result->error_count++] = (ErrorRange){ts_node_start_byte(node), ts_node_end_byte(node)};
+        } else {
+            descend = ts_node_has_error(node);
+        }
+        if (descend && ts_tree_cursor_goto_first_child(&cursor)) continue;
+        bool done = false;
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                done = true;
+                break;
+            }
+        }
+        if (done) break;
+    }
+    ts_tree_cursor_delete(&cursor);
+    return ok;
+}
+
+static bool add_dependency(void *payload, const HTMLDjangoDependency *dependency) {
+    Result *result = payload;
+    if (!grow((void **)&result->dependencies, &result->dependency_capacity, result->dependency_count + 1,
+              sizeof(Dependency)) ||
+        !grow((void **)&result->targets, &result->targets_capacity,
+              result->targets_length + dependency->target_length, 1)) {
+        result->error = ENOMEM;
+        return false;
+    }
+    memcpy(result->targets + result->targets_length, dependency->target, dependency->target_length);
+    result->dependencies[result->dependency_count++] = (Dependency){
+        .kind = dependency->kind,
+        .target = result->targets_length,
+        .target_length = dependency->target_length,
+        .start_byte = dependency->start_byte,
+        .end_byte = dependency->end_byte,
+    };
+    result->targets_length += dependency->target_length;
+    return true;
+}
+
+static bool summarize(void *payload, unsigned worker, size_t index, TSTree *tree,
+                      const HTMLDjangoSummary *summary) {
+    (void)worker;
+    Batch *batch = payload;
+    Result *result = &batch->results[index];
+    result->summary = *summary;
+    result->summary.source = NULL;
+    if (!tree) return false;
+
+    if (summary->has_error && !collect_errors(result, ts_tree_root_node(tree))) result->error = ENOMEM;
+    if (batch->dependencies && !result->error) {
+        htmldjango_extract_dependencies(summary->source, summary->bytes, add_dependency, result);
+    }
+    if (batch->trees && !result->error) result->error = htmldjango_cst_write(tree, &result->cst);
+    return false;
+}
+
+static PyObject *error_list(const Result *result) {
+    PyObject *list = PyList_New((Py_ssize_t)result->error_count);
+    for (size_t i = 0; list && i < result->error_count; i++) {
+        PyObject *item = Py_BuildValue("(II)", result->errors[i].start_byte, result->errors[i].end_byte);
+        if (!item) {
+            Py_CLEAR(list);
+            break;
+        }
+        PyList_SetItem(list, (Py_ssize_t)i, item);
+    }
+    return list;
+}
+
+static PyObject *dependency_list(const Result *result) {
+    PyObject *list = PyList_New((Py_ssize_t)result->dependency_count);
+    for (size_t i = 0; list && i < result->dependency_count; i++) {
+        const Dependency *dependency = &result->dependencies[i];
+        PyObject *target =
+            PyUnicode_DecodeUTF8(result->targets + dependency->target, dependency->target_length, "replace");
+        PyObject *item = target ? Py_BuildValue("(iNII)", (int)dependency->kind, target, dependency->start_byte,
+                                                dependency->end_byte)
+                                : NULL;
+        if (!item) {
+            Py_CLEAR(list);
+            break;
+        }
+        PyList_SetItem(list, (Py_ssize_t)i, item);
+    }
+    return list;
+}
+
+static PyObject *result_tuple(const Result *result, bool trees) {
+    if (result->error) {
+        errno = result->error;
+        return PyErr_SetFromErrno(PyExc_OSError);
+    }
+    PyObject *errors = error_list(result);
+    PyObject *dependencies = errors ? dependency_list(result) : NULL;
+    PyObject *cst = NULL;
+    if (dependencies) {
+        cst = trees && result->cst.data
+                  ? PyBytes_FromStringAndSize((const char *)result->cst.data, (Py_ssize_t)result->cst.length)
+                  : Py_NewRef(Py_None);
+    }
+    if (!cst) {
+        Py_XDECREF(errors);
+        Py_XDECREF(dependencies);
+        return NULL;
+    }
+    const HTMLDjangoSummary *summary = &result->summary;
+    return Py_BuildValue("(iIIOdNNN)", summary->read_error, summary->bytes, summary->node_count,
+                         summary->has_error ? Py_True : Py_False, summary->parse_seconds, errors, dependencies,
+                         cst);
+}
+
+static void release_inputs(Py_buffer *views, PyObject **paths, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (views[i].obj) PyBuffer_Release(&views[i]);
+        Py_XDECREF(paths[i]);
+    }
+}
+
+// Bytes-like objects are sources; str and os.PathLike objects are paths
+static bool convert_input(PyObject *item, Py_buffer *view, PyObject **path, HTMLDjangoInput *input) {
+    if (PyObject_CheckBuffer(item)) {
+        if (PyObject_GetBuffer(item, view, PyBUF_SIMPLE) != 0) return false;
+        if ((size_t)view->len > UINT32_MAX) {
+            PyErr_SetString(PyExc_ValueError, "source is larger than 4 GiB");
+            return false;
+        }
+        input->source = view->len ? view->buf : "";
+        input->length = (uint32_t)view->len;
+        return true;
+    }
+    if (!PyUnicode_FSConverter(item, path)) return false;
+    input->path = PyBytes_AsString(*path);
+    return input->path != NULL;
+}
+
+static PyObject* _batch_parse_batch(PyObject *Py_UNUSED(self), PyObject *args) {
+    PyObject *iterable;
+    unsigned int threads;
+    int trees, dependencies;
+    if (!PyArg_ParseTuple(args, "OIpp:parse_batch", &iterable, &threads, &trees, &dependencies)) return NULL;
+    PyObject *items = PySequence_List(iterable);
+    if (!items) return NULL;
+
+    size_t count = (size_t)PyList_Size(items);
+    Py_buffer *views = PyMem_Calloc(count + 1, sizeof(Py_buffer));
+    PyObject **paths = PyMem_Calloc(count + 1, sizeof(PyObject *));
+    HTMLDjangoInput *inputs = PyMem_Calloc(count + 1, sizeof(HTMLDjangoInput));
+    Result *results = calloc(count + 1, sizeof(Result));
+    PyObject *list = NULL;
+    if (!views || !paths || !inputs || !results) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (!convert_input(PyList_GetItem(items, (Py_ssize_t)i), &views[i], &paths[i], &inputs[i])) goto done;
+    }
+
+    Batch batch = {.results = results, .trees = trees, .dependencies = dependencies};
+    HTMLDjangoBatchOptions options = {.threads = threads, .callback = summarize, .payload = &batch};
+    long status;
+    Py_BEGIN_ALLOW_THREADS
+    status = htmldjango_parse_batch(inputs, count, &options);
+    Py_END_ALLOW_THREADS
+    if (status < 0) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    list = PyList_New((Py_ssize_t)count);
+    for (size_t i = 0; list && i < count; i++) {
+        PyObject *result = result_tuple(&results[i], trees);
+        if (!result) {
+            Py_CLEAR(list);
+            break;
+        }
+        PyList_SetItem(list, (Py_ssize_t)i, result);
+    }
+
+done:
+    if (views && paths) release_inputs(views, paths, count);
+    for (size_t i = 0; results && i < count; i++) {
+        free(results[i].errors);
+        free(results[i].dependencies);
+        free(results[i].targets);
+        htmldjango_cst_buffer_delete(&results[i].cst);
+    }
+    free(results);
+    PyMem_Free(inputs);
+    PyMem_Free(paths);
+    PyMem_Free(views);
+    Py_DECREF(items);
+    return list;
+}
+
+static PyMethodDef methods[] = {
+    {"parse_batch", _batch_parse_batch, METH_VARARGS,
+     "Parse templates on native threads with the GIL released."},
+    {NULL, NULL, 0, NULL}
+};
+
+static struct PyModuleDef module = {
+    .m_base = PyModuleDef_HEAD_INIT,
+    .m_name = "_batch",
+    .m_doc = NULL,
+    .m_size = -1,
+    .m_methods = methods
+};
+
+PyMODINIT_FUNC PyInit__batch(void) {
+    return PyModule_Create(&module);
+}
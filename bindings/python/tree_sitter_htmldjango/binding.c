@@ -1,16 +1,114 @@
 #include <Python.h>
 
+#include "tree-sitter-htmldjango-blocks.h"
+#include "tree-sitter-htmldjango-kinds.h"
+
 typedef struct TSLanguage TSLanguage;
 
 TSLanguage *tree_sitter_htmldjango(void);
 
+TSLanguage *tree_sitter_htmldjango_expression(void);
+
 static PyObject* _binding_language(PyObject *Py_UNUSED(self), PyObject *Py_UNUSED(args)) {
     return PyCapsule_New(tree_sitter_htmldjango(), "tree_sitter.Language", NULL);
 }
 
+static PyObject* _binding_language_expression(PyObject *Py_UNUSED(self), PyObject *Py_UNUSED(args)) {
+    return PyCapsule_New(tree_sitter_htmldjango_expression(), "tree_sitter.Language", NULL);
+}
+
+static PyObject *block_tuple(const HTMLDjangoBlock *block) {
+    PyObject *name = PyUnicode_DecodeUTF8(block->name, block->name_length, NULL);
+    if (!name) return NULL;
+    PyObject *parent = block->parent == HTMLDJANGO_NO_BLOCK ? Py_NewRef(Py_None) : PyLong_FromUnsignedLong(block->parent);
+    if (!parent) {
+        Py_DECREF(name);
+        return NULL;
+    }
+    return Py_BuildValue("(NIIIIINIO)", name, block->start_byte, block->end_byte, block->content_start_byte,
+                         block->content_end_byte, block->depth, parent, block->super_count,
+                         block->closed ? Py_True : Py_False);
+}
+
+static PyObject *build_block_map(const HTMLDjangoBlockMap *map) {
+    PyObject *blocks = PyList_New(map->block_count);
+    PyObject *supers = PyList_New(map->super_count);
+    if (!blocks || !supers) goto fail;
+    for (uint32_t i = 0; i < map->block_count; i++) {
+        PyObject *block = block_tuple(&map->blocks[i]);
+        if (!block) goto fail;
+        PyList_SetItem(blocks, i, block);
+    }
+    for (uint32_t i = 0; i < map->super_count; i++) {
+        const HTMLDjangoBlockSuper *usage = &map->supers[i];
+        PyObject *item = Py_BuildValue("(III)", usage->block, usage->start_byte, usage->end_byte);
+        if (!item) goto fail;
+        PyList_SetItem(supers, i, item);
+    }
+    return Py_BuildValue("(NN)", blocks, supers);
+
+fail:
+    Py_XDECREF(blocks);
+    Py_XDECREF(supers);
+    return NULL;
+}
+
+static PyObject* _binding_block_map(PyObject *Py_UNUSED(self), PyObject *args) {
+    Py_buffer source;
+    if (!PyArg_ParseTuple(args, "y*:block_map", &source)) return NULL;
+    if ((size_t)source.len > UINT32_MAX) {
+        PyBuffer_Release(&source);
+        return PyErr_Format(PyExc_ValueError, "source is larger than 4 GiB");
+    }
+
+    HTMLDjangoBlockMap map = {0};
+    bool ok;
+    Py_BEGIN_ALLOW_THREADS
+    ok = htmldjango_block_map_build(&map, source.buf, (uint32_t)source.len);
+    Py_END_ALLOW_THREADS
+    PyObject *result = ok ? build_block_map(&map) : PyErr_NoMemory();
+    htmldjango_block_map_delete(&map);
+    PyBuffer_Release(&source);
+    return result;
+}
+
+static PyObject *id_tuple(uint32_t (*fill)(uint16_t *, uint32_t)) {
+    uint32_t count = fill(NULL, 0);
+    uint16_t *ids = PyMem_Malloc(count * sizeof(uint16_t));
+    if (!ids) return PyErr_NoMemory();
+    fill(ids, count);
+    PyObject *result = PyTuple_New(count);
+    for (uint32_t i = 0; result && i < count; i++) {
+        PyObject *id = PyLong_FromUnsignedLong(ids[i]);
+        if (!id) {
+            Py_CLEAR(result);
+            break;
+        }
+        PyTuple_SetItem(result, i, id);
+    }
+    PyMem_Free(ids);
+    return result;
+}
+
+static PyObject* _binding_symbol_kinds(PyObject *Py_UNUSED(self), PyObject *Py_UNUSED(args)) {
+    return id_tuple(htmldjango_symbol_kinds);
+}
+
+static PyObject* _binding_field_ids(PyObject *Py_UNUSED(self), PyObject *Py_UNUSED(args)) {
+    return id_tuple(htmldjango_field_ids);
+}
+
 static PyMethodDef methods[] = {
     {"language", _binding_language, METH_NOARGS,
      "Get the tree-sitter language for this grammar."},
+    {"language_expression", _binding_language_expression, METH_NOARGS,
+     "Get the tree-sitter language for standalone Django expressions."},
+    {"block_map", _binding_block_map, METH_VARARGS,
+     "Find the {% block %} tags and {{ block.super }} usages in a template."},
+    {"symbol_kinds", _binding_symbol_kinds, METH_NOARGS,
+     "Get the stable kind ID of each parser symbol."},
+    {"field_ids", _binding_field_ids, METH_NOARGS,
+     "Get the stable field ID of each parser field ID."},
     {NULL, NULL, 0, NULL}
 };
 
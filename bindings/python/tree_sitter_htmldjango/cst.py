@@ -0,0 +1,203 @@
+"""Reader for the binary syntax trees written by htmldjango_cst_write().
+
+The layout is documented in bindings/c/tree-sitter-htmldjango-cst.h. A CST
+wraps any buffer (bytes, mmap, ...) through a memoryview and decodes a node
+only when it is looked at, so opening a large tree copies nothing but the
+short table of kind and field names.
+"""
+
+from __future__ import annotations
+
+import struct
+from collections.abc import Buffer, Iterator
+
+VERSION = 1
+NO_NODE = 0xFFFFFFFF
+
+NAMED = 1 << 0
+MISSING = 1 << 1
+EXTRA = 1 << 2
+ERROR = 1 << 3
+HAS_ERROR = 1 << 4
+
+_HEADER = struct.Struct("<4sHH6I")
+_NODE = struct.Struct("<4H4I")
+_U32 = struct.Struct("<I")
+_MAGIC = b"HDJC"
+
+
+class CST:
+    """A binary syntax tree. Opening it checks every node once, so that the
+    accessors can trust the buffer; raises ValueError for a buffer that is
+    truncated, of another format version, or whose nodes do not form a tree.
+    The buffer must stay alive and unchanged while the CST is in use."""
+
+    __slots__ = ("_nodes", "kinds", "fields")
+
+    def __init__(self, data: Buffer):
+        view = memoryview(data).cast("B")
+        if len(view) < _HEADER.size:
+            raise ValueError("not a valid binary syntax tree")
+        magic, version, header_size, node_count, kind_count, field_count, names_offset, total, _ = (
+            _HEADER.unpack_from(view))
+        if magic != _MAGIC or version != VERSION or header_size != _HEADER.size or total > len(view):
+            raise ValueError("not a valid binary syntax tree")
+        view = view[:total]
+        nodes_end = _HEADER.size + node_count * _NODE.size
+        self._nodes = view[_HEADER.size:nodes_end]
+        self.kinds = _names(view, names_offset, nodes_end, kind_count + field_count)
+        self.fields = self.kinds[kind_count:]
+        del self.kinds[kind_count:]
+        _check_nodes(self._nodes, kind_count, field_count)
+
+    def __len__(self) -> int:
+        return len(self._nodes) // _NODE.size
+
+    def __iter__(self) -> Iterator[Node]:
+        """All nodes in pre-order."""
+        return map(self.node, range(len(self)))
+
+    @property
+    def root(self) -> Node | None:
+        return self.node(0) if len(self) else None
+
+    def node(self, index: int) -> Node:
+        if not 0 <= index < len(self):
+            raise IndexError("node index out of range")
+        return Node(self, index)
+
+    def kind_name(self, kind: int) -> str:
+        """The name of a kind ID, as in node-types.json; kind 0 is ERROR."""
+        return self.kinds[kind]
+
+    def field_name(self, field: int) -> str:
+        """The name of a field ID; field 0 is the empty string."""
+        return self.fields[field]
+
+
+class Node:
+    """A node of a CST, read from the buffer on each access."""
+
+    __slots__ = ("cst", "index")
+
+    def __init__(self, cst: CST, index: int):
+        self.cst = cst
+        self.index = index
+
+    def __eq__(self, other: object) -> bool:
+        return isinstance(other, Node) and self.cst is other.cst and self.index == other.index
+
+    def __hash__(self) -> int:
+        return hash((id(self.cst), self.index))
+
+    def __repr__(self) -> str:
+        return f"<Node {self.kind} [{self.start_byte}, {self.end_byte})>"
+
+    def _record(self) -> tuple[int, ...]:
+        return _NODE.unpack_from(self.cst._nodes, self.index * _NODE.size)
+
+    @property
+    def kind_id(self) -> int:
+        return self._record()[0]
+
+    @property
+    def kind(self) -> str:
+        return self.cst.kinds[self._record()[0]]
+
+    @property
+    def field_id(self) -> int:
+        """The node's field in its parent, 0 for none."""
+        return self._record()[1]
+
+    @property
+    def field_name(self) -> str | None:
+        field = self._record()[1]
+        return self.cst.fields[field] if field else None
+
+    @property
+    def flags(self) -> int:
+        return self._record()[2]
+
+    @property
+    def is_named(self) -> bool:
+        return bool(self._record()[2] & NAMED)
+
+    @property
+    def is_missing(self) -> bool:
+        return bool(self._record()[2] & MISSING)
+
+    @property
+    def is_extra(self) -> bool:
+        return bool(self._record()[2] & EXTRA)
+
+    @property
+    def is_error(self) -> bool:
+        return bool(self._record()[2] & ERROR)
+
+    @property
+    def has_error(self) -> bool:
+        return bool(self._record()[2] & HAS_ERROR)
+
+    @property
+    def start_byte(self) -> int:
+        return self._record()[4]
+
+    @property
+    def end_byte(self) -> int:
+        return self._record()[5]
+
+    @property
+    def parent(self) -> Node | None:
+        parent = self._record()[6]
+        return None if parent == NO_NODE else Node(self.cst, parent)
+
+    @property
+    def descendant_count(self) -> int:
+        """The number of nodes in this node's subtree, itself included."""
+        return self._record()[7] - self.index
+
+    @property
+    def children(self) -> list[Node]:
+        children = []
+        index, end = self.index + 1, self._record()[7]
+        while index < end:
+            children.append(Node(self.cst, index))
+            index = _NODE.unpack_from(self.cst._nodes, index * _NODE.size)[7]
+        return children
+
+    def descendants(self) -> Iterator[Node]:
+        """This node and its descendants, in pre-order."""
+        return map(self.cst.node, range(self.index, self._record()[7]))
+
+
+def _names(view: memoryview, table: int, nodes_end: int, entries: int) -> list[str]:
+    total = len(view)
+    if table < nodes_end or table > total or (total - table) // 4 < entries:
+        raise ValueError("not a valid binary syntax tree")
+    # The table is a few kilobytes however large the tree is
+    data = bytes(view[table:])
+    names = []
+    for (offset,) in _U32.iter_unpack(data[:entries * 4]):
+        end = data.find(b"\0", offset)
+        if offset < entries * 4 or end < 0:
+            raise ValueError("not a valid binary syntax tree")
+        names.append(data[offset:end].decode())
+    return names
+
+
+# Same checks as htmldjango_cst_open(): each parent is the innermost node whose
+# range still contains the child, found by climbing from the previous node
+def _check_nodes(nodes: memoryview, kind_count: int, field_count: int) -> None:
+    parents = []
+    nexts = []
+    count = len(nodes) // _NODE.size
+    for index, (kind, field, _, _, start, end, parent, next_) in enumerate(_NODE.iter_unpack(nodes)):
+        if kind >= kind_count or field >= field_count or start > end or not index < next_ <= count:
+            raise ValueError("not a valid binary syntax tree")
+        open_ = index - 1 if index else NO_NODE
+        while open_ != NO_NODE and nexts[open_] <= index:
+            open_ = parents[open_]
+        if parent != open_ or (index and parent == NO_NODE) or (parent != NO_NODE and next_ > nexts[parent]):
+            raise ValueError("not a valid binary syntax tree")
+        parents.append(parent)
+        nexts.append(next_)
@@ -0,0 +1,454 @@
+"""Node kind and field IDs. Generated by tools/gen_kinds.py from src/node-types.json. Do not edit.
+
+KIND_* values are what node_kind() returns and what a CST stores; FIELD_*
+values are what cursor_field() returns.
+"""
+
+KIND_ERROR = 0
+KIND_COMPARISON_OPERATOR = 1
+KIND_DJANGO_STATEMENT = 2
+KIND_ELEMENT = 3
+KIND_LITERAL = 4
+KIND_AND_EXPRESSION = 5
+KIND_AS_ALIAS = 6
+KIND_ASSIGNMENT = 7
+KIND_ATTRIBUTE = 8
+KIND_ATTRIBUTE_NAME = 9
+KIND_ATTRIBUTE_VALUE = 10
+KIND_COMPARISON_EXPRESSION = 11
+KIND_CYCLE_VALUE = 12
+KIND_DJANGO_ATTRIBUTE_ELIF_BRANCH = 13
+KIND_DJANGO_ATTRIBUTE_ELSE_BRANCH = 14
+KIND_DJANGO_ATTRIBUTE_EMPTY_BRANCH = 15
+KIND_DJANGO_ATTRIBUTE_FOR_BLOCK = 16
+KIND_DJANGO_ATTRIBUTE_IF_BLOCK = 17
+KIND_DJANGO_AUTOESCAPE_BLOCK = 18
+KIND_DJANGO_BLOCK_BLOCK = 19
+KIND_DJANGO_BLOCK_COMMENT = 20
+KIND_DJANGO_BLOCK_OPEN = 21
+KIND_DJANGO_CSRF_TOKEN_TAG = 22
+KIND_DJANGO_CYCLE_TAG = 23
+KIND_DJANGO_DEBUG_TAG = 24
+KIND_DJANGO_ELIF = 25
+KIND_DJANGO_ELIF_BRANCH = 26
+KIND_DJANGO_ELSE = 27
+KIND_DJANGO_ELSE_BRANCH = 28
+KIND_DJANGO_EMPTY = 29
+KIND_DJANGO_EMPTY_BRANCH = 30
+KIND_DJANGO_ENDBLOCK = 31
+KIND_DJANGO_ENDFOR = 32
+KIND_DJANGO_ENDIF = 33
+KIND_DJANGO_ENDWITH = 34
+KIND_DJANGO_EXTENDS_TAG = 35
+KIND_DJANGO_FILTER_BLOCK = 36
+KIND_DJANGO_FIRSTOF_TAG = 37
+KIND_DJANGO_FOR_BLOCK = 38
+KIND_DJANGO_FOR_OPEN = 39
+KIND_DJANGO_GENERIC_BLOCK = 40
+KIND_DJANGO_GENERIC_TAG = 41
+KIND_DJANGO_IF_BLOCK = 42
+KIND_DJANGO_IF_OPEN = 43
+KIND_DJANGO_IFCHANGED_BLOCK = 44
+KIND_DJANGO_INCLUDE_TAG = 45
+KIND_DJANGO_INTERPOLATION = 46
+KIND_DJANGO_LOAD_TAG = 47
+KIND_DJANGO_LOREM_TAG = 48
+KIND_DJANGO_NOW_TAG = 49
+KIND_DJANGO_PARTIAL_TAG = 50
+KIND_DJANGO_PARTIALDEF_BLOCK = 51
+KIND_DJANGO_QUERYSTRING_TAG = 52
+KIND_DJANGO_REGROUP_TAG = 53
+KIND_DJANGO_RESETCYCLE_TAG = 54
+KIND_DJANGO_SPACELESS_BLOCK = 55
+KIND_DJANGO_TEMPLATETAG_TAG = 56
+KIND_DJANGO_URL_TAG = 57
+KIND_DJANGO_VERBATIM_BLOCK = 58
+KIND_DJANGO_WIDTHRATIO_TAG = 59
+KIND_DJANGO_WITH_BLOCK = 60
+KIND_DJANGO_WITH_OPEN = 61
+KIND_DOCTYPE = 62
+KIND_DOCUMENT = 63
+KIND_END_TAG = 64
+KIND_ERRONEOUS_END_TAG = 65
+KIND_FILTER_ARGUMENT = 66
+KIND_FILTER_CALL = 67
+KIND_FILTER_CHAIN = 68
+KIND_FILTER_EXPRESSION = 69
+KIND_FOREIGN_ELEMENT = 70
+KIND_LOOKUP = 71
+KIND_LOOP_VARIABLES = 72
+KIND_NAMED_ARGUMENT = 73
+KIND_NORMAL_ELEMENT = 74
+KIND_NOT_EXPRESSION = 75
+KIND_OR_EXPRESSION = 76
+KIND_PLAINTEXT_ELEMENT = 77
+KIND_QUOTED_ATTRIBUTE_VALUE = 78
+KIND_RAW_TEXT = 79
+KIND_RCDATA_ELEMENT = 80
+KIND_SCRIPT_ELEMENT = 81
+KIND_START_TAG = 82
+KIND_STRING = 83
+KIND_STYLE_ELEMENT = 84
+KIND_TAG_ARGUMENT = 85
+KIND_TEST_EXPRESSION = 86
+KIND_TEXT = 87
+KIND_UNPAIRED_END_TAG = 88
+KIND_UNPAIRED_START_TAG = 89
+KIND_VOID_ELEMENT = 90
+KIND_WITH_ASSIGNMENTS = 91
+KIND_WITH_LEGACY = 92
+KIND_ANON_DQUOTE = 93  # "
+KIND_ANON_PERCENT_RBRACE = 94  # %}
+KIND_ANON_SQUOTE = 95  # '
+KIND_ANON_COMMA = 96  # ,
+KIND_ANON_DOT = 97  # .
+KIND_ANON_SLASH_GT = 98  # />
+KIND_ANON_COLON = 99  # :
+KIND_ANON_LT = 100  # <
+KIND_ANON_LT_BANG = 101  # <!
+KIND_ANON_LT_SLASH = 102  # </
+KIND_ANON_EQ = 103  # =
+KIND_ANON_GT = 104  # >
+KIND_ANON_AND = 105  # and
+KIND_AND_KEYWORD = 106
+KIND_ARGUMENT_NAME = 107
+KIND_ANON_AS = 108  # as
+KIND_ANON_AUTOESCAPE = 109  # autoescape
+KIND_AUTOESCAPE_VALUE = 110
+KIND_ANON_BLOCK = 111  # block
+KIND_BLOCK_NAME = 112
+KIND_ANON_BY = 113  # by
+KIND_COMMENT = 114
+KIND_ANON_COMMENT = 115  # comment
+KIND_COMMENT_CONTENT = 116
+KIND_COMMENT_TEXT = 117
+KIND_ANON_CSRF_TOKEN = 118  # csrf_token
+KIND_ANON_CYCLE = 119  # cycle
+KIND_CYCLE_NAME = 120
+KIND_ANON_DEBUG = 121  # debug
+KIND_DJANGO_LINE_COMMENT = 122
+KIND_DOCTYPE_KEYWORD = 123
+KIND_ANON_ELIF = 124  # elif
+KIND_ANON_ELSE = 125  # else
+KIND_ANON_EMPTY = 126  # empty
+KIND_END_TAG_NAME = 127
+KIND_ANON_ENDAUTOESCAPE = 128  # endautoescape
+KIND_ANON_ENDBLOCK = 129  # endblock
+KIND_ANON_ENDCOMMENT = 130  # endcomment
+KIND_ANON_ENDFILTER = 131  # endfilter
+KIND_ANON_ENDFOR = 132  # endfor
+KIND_ANON_ENDIF = 133  # endif
+KIND_ANON_ENDIFCHANGED = 134  # endifchanged
+KIND_ANON_ENDPARTIALDEF = 135  # endpartialdef
+KIND_ANON_ENDSPACELESS = 136  # endspaceless
+KIND_ANON_ENDWITH = 137  # endwith
+KIND_ENTITY = 138
+KIND_ERRONEOUS_END_TAG_NAME = 139
+KIND_ANON_EXTENDS = 140  # extends
+KIND_ANON_FILTER = 141  # filter
+KIND_FILTER_NAME = 142
+KIND_ANON_FIRSTOF = 143  # firstof
+KIND_ANON_FOR = 144  # for
+KIND_ANON_FROM = 145  # from
+KIND_GENERIC_TAG_NAME = 146
+KIND_I18N_STRING = 147
+KIND_IDENTIFIER = 148
+KIND_ANON_IF = 149  # if
+KIND_ANON_IFCHANGED = 150  # ifchanged
+KIND_IMPLICIT_END_TAG = 151
+KIND_ANON_IN = 152  # in
+KIND_ANON_INCLUDE = 153  # include
+KIND_INLINE = 154
+KIND_LIBRARY_NAME = 155
+KIND_ANON_LOAD = 156  # load
+KIND_ANON_LOREM = 157  # lorem
+KIND_METHOD = 158
+KIND_NAME_SEGMENT = 159
+KIND_ANON_NOT = 160  # not
+KIND_ANON_NOW = 161  # now
+KIND_NUMBER = 162
+KIND_NUMERIC_INDEX = 163
+KIND_ONLY = 164
+KIND_OP_EQ = 165
+KIND_OP_GT = 166
+KIND_OP_GTE = 167
+KIND_OP_IN = 168
+KIND_OP_IS = 169
+KIND_OP_IS_NOT = 170
+KIND_OP_LT = 171
+KIND_OP_LTE = 172
+KIND_OP_NE = 173
+KIND_OP_NOT_IN = 174
+KIND_OR_KEYWORD = 175
+KIND_ANON_PARTIAL = 176  # partial
+KIND_PARTIAL_NAME = 177
+KIND_ANON_PARTIALDEF = 178  # partialdef
+KIND_PLAINTEXT_TEXT = 179
+KIND_ANON_QUERYSTRING = 180  # querystring
+KIND_RANDOM = 181
+KIND_RCDATA_TEXT = 182
+KIND_ANON_REGROUP = 183  # regroup
+KIND_ANON_RESETCYCLE = 184  # resetcycle
+KIND_REVERSED = 185
+KIND_SILENT = 186
+KIND_ANON_SPACELESS = 187  # spaceless
+KIND_TAG_NAME = 188
+KIND_ANON_TEMPLATETAG = 189  # templatetag
+KIND_TEMPLATETAG_ARGUMENT = 190
+KIND_ANON_URL = 191  # url
+KIND_VARIABLE_NAME = 192
+KIND_ANON_VERBATIM = 193  # verbatim
+KIND_VERBATIM_CONTENT = 194
+KIND_ANON_WIDTHRATIO = 195  # widthratio
+KIND_ANON_WITH = 196  # with
+KIND_ANON_LBRACE_PERCENT = 197  # {%
+KIND_ANON_LBRACE_LBRACE = 198  # {{
+KIND_ANON_PIPE = 199  # |
+KIND_ANON_RBRACE_RBRACE = 200  # }}
+
+FIELD_NONE = 0
+FIELD_ALIAS = 1
+FIELD_ARGUMENT = 2
+FIELD_BODY = 3
+FIELD_CONDITION = 4
+FIELD_COUNT = 5
+FIELD_END_NAME = 6
+FIELD_FILTERS = 7
+FIELD_FORMAT = 8
+FIELD_GROUPER = 9
+FIELD_ITERABLE = 10
+FIELD_MAX_VALUE = 11
+FIELD_MAX_WIDTH = 12
+FIELD_NAME = 13
+FIELD_SOURCE = 14
+FIELD_TARGET = 15
+FIELD_TEMPLATE = 16
+FIELD_URL_NAME = 17
+FIELD_VALUE = 18
+
+# (type, named) by kind ID
+KIND_NAMES = (
+    ("ERROR", True),
+    ("comparison_operator", True),
+    ("django_statement", True),
+    ("element", True),
+    ("literal", True),
+    ("and_expression", True),
+    ("as_alias", True),
+    ("assignment", True),
+    ("attribute", True),
+    ("attribute_name", True),
+    ("attribute_value", True),
+    ("comparison_expression", True),
+    ("cycle_value", True),
+    ("django_attribute_elif_branch", True),
+    ("django_attribute_else_branch", True),
+    ("django_attribute_empty_branch", True),
+    ("django_attribute_for_block", True),
+    ("django_attribute_if_block", True),
+    ("django_autoescape_block", True),
+    ("django_block_block", True),
+    ("django_block_comment", True),
+    ("django_block_open", True),
+    ("django_csrf_token_tag", True),
+    ("django_cycle_tag", True),
+    ("django_debug_tag", True),
+    ("django_elif", True),
+    ("django_elif_branch", True),
+    ("django_else", True),
+    ("django_else_branch", True),
+    ("django_empty", True),
+    ("django_empty_branch", True),
+    ("django_endblock", True),
+    ("django_endfor", True),
+    ("django_endif", True),
+    ("django_endwith", True),
+    ("django_extends_tag", True),
+    ("django_filter_block", True),
+    ("django_firstof_tag", True),
+    ("django_for_block", True),
+    ("django_for_open", True),
+    ("django_generic_block", True),
+    ("django_generic_tag", True),
+    ("django_if_block", True),
+    ("django_if_open", True),
+    ("django_ifchanged_block", True),
+    ("django_include_tag", True),
+    ("django_interpolation", True),
+    ("django_load_tag", True),
+    ("django_lorem_tag", True),
+    ("django_now_tag", True),
+    ("django_partial_tag", True),
+    ("django_partialdef_block", True),
+    ("django_querystring_tag", True),
+    ("django_regroup_tag", True),
+    ("django_resetcycle_tag", True),
+    ("django_spaceless_block", True),
+    ("django_templatetag_tag", True),
+    ("django_url_tag", True),
+    ("django_verbatim_block", True),
+    ("django_widthratio_tag", True),
+    ("django_with_block", True),
+    ("django_with_open", True),
+    ("doctype", True),
+    ("document", True),
+    ("end_tag", True),
+    ("erroneous_end_tag", True),
+    ("filter_argument", True),
+    ("filter_call", True),
+    ("filter_chain", True),
+    ("filter_expression", True),
+    ("foreign_element", True),
+    ("lookup", True),
+    ("loop_variables", True),
+    ("named_argument", True),
+    ("normal_element", True),
+    ("not_expression", True),
+    ("or_expression", True),
+    ("plaintext_element", True),
+    ("quoted_attribute_value", True),
+    ("raw_text", True),
+    ("rcdata_element", True),
+    ("script_element", True),
+    ("start_tag", True),
+    ("string", True),
+    ("style_element", True),
+    ("tag_argument", True),
+    ("test_expression", True),
+    ("text", True),
+    ("unpaired_end_tag", True),
+    ("unpaired_start_tag", True),
+    ("void_element", True),
+    ("with_assignments", True),
+    ("with_legacy", True),
+    ("\"", False),
+    ("%}", False),
+    ("'", False),
+    (",", False),
+    (".", False),
+    ("/>", False),
+    (":", False),
+    ("<", False),
+    ("<!", False),
+    ("</", False),
+    ("=", False),
+    (">", False),
+    ("and", False),
+    ("and_keyword", True),
+    ("argument_name", True),
+    ("as", False),
+    ("autoescape", False),
+    ("autoescape_value", True),
+    ("block", False),
+    ("block_name", True),
+    ("by", False),
+    ("comment", True),
+    ("comment", False),
+    ("comment_content", True),
+    ("comment_text", True),
+    ("csrf_token", False),
+    ("cycle", False),
+    ("cycle_name", True),
+    ("debug", False),
+    ("django_line_comment", True),
+    ("doctype_keyword", True),
+    ("elif", False),
+    ("else", False),
+    ("empty", False),
+    ("end_tag_name", True),
+    ("endautoescape", False),
+    ("endblock", False),
+    ("endcomment", False),
+    ("endfilter", False),
+    ("endfor", False),
+    ("endif", False),
+    ("endifchanged", False),
+    ("endpartialdef", False),
+    ("endspaceless", False),
+    ("endwith", False),
+    ("entity", True),
+    ("erroneous_end_tag_name", True),
+    ("extends", False),
+    ("filter", False),
+    ("filter_name", True),
+    ("firstof", False),
+    ("for", False),
+    ("from", False),
+    ("generic_tag_name", True),
+    ("i18n_string", True),
+    ("identifier", True),
+    ("if", False),
+    ("ifchanged", False),
+    ("implicit_end_tag", True),
+    ("in", False),
+    ("include", False),
+    ("inline", True),
+    ("library_name", True),
+    ("load", False),
+    ("lorem", False),
+    ("method", True),
+    ("name_segment", True),
+    ("not", False),
+    ("now", False),
+    ("number", True),
+    ("numeric_index", True),
+    ("only", True),
+    ("op_eq", True),
+    ("op_gt", True),
+    ("op_gte", True),
+    ("op_in", True),
+    ("op_is", True),
+    ("op_is_not", True),
+    ("op_lt", True),
+    ("op_lte", True),
+    ("op_ne", True),
+    ("op_not_in", True),
+    ("or_keyword", True),
+    ("partial", False),
+    ("partial_name", True),
+    ("partialdef", False),
+    ("plaintext_text", True),
+    ("querystring", False),
+    ("random", True),
+    ("rcdata_text", True),
+    ("regroup", False),
+    ("resetcycle", False),
+    ("reversed", True),
+    ("silent", True),
+    ("spaceless", False),
+    ("tag_name", True),
+    ("templatetag", False),
+    ("templatetag_argument", True),
+    ("url", False),
+    ("variable_name", True),
+    ("verbatim", False),
+    ("verbatim_content", True),
+    ("widthratio", False),
+    ("with", False),
+    ("{%", False),
+    ("{{", False),
+    ("|", False),
+    ("}}", False),
+)
+
+FIELD_NAMES = (
+    "",
+    "alias",
+    "argument",
+    "body",
+    "condition",
+    "count",
+    "end_name",
+    "filters",
+    "format",
+    "grouper",
+    "iterable",
+    "max_value",
+    "max_width",
+    "name",
+    "source",
+    "target",
+    "template",
+    "url_name",
+    "value",
+)
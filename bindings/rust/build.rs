@@ -19,5 +19,28 @@ fn main() {
     c_config.file(&scanner_path);
     println!("cargo:rerun-if-changed={}", scanner_path.to_str().unwrap());
 
+    let expression_dir = std::path::Path::new("expression").join("src");
+    for file in ["parser.c", "scanner.c"] {
+        let path = expression_dir.join(file);
+        c_config.file(&path);
+        println!("cargo:rerun-if-changed={}", path.to_str().unwrap());
+    }
+    println!("cargo:rerun-if-changed=common/scanner.h");
+
+    c_config.include("bindings/c");
+    for path in [
+        "tools/blocks.c",
+        "tools/kinds.c",
+        "tools/kind_names.h",
+        "tools/lexer.h",
+        "bindings/c/tree-sitter-htmldjango-blocks.h",
+        "bindings/c/tree-sitter-htmldjango-kinds.h",
+    ] {
+        if path.ends_with(".c") {
+            c_config.file(path);
+        }
+        println!("cargo:rerun-if-changed={path}");
+    }
+
     c_config.compile("tree-sitter-html");
 }
@@ -0,0 +1,476 @@
+//! A zero-copy reader for the binary syntax tree format written by `htmldjango_cst_write()`
+//! in the tools library. The layout is documented in `bindings/c/tree-sitter-htmldjango-cst.h`.
+//!
+//! ```
+//! # fn read(buffer: &[u8]) -> Result<(), tree_sitter_htmldjango::cst::InvalidCst> {
+//! use tree_sitter_htmldjango::cst::Cst;
+//!
+//! let cst = Cst::new(buffer)?;
+//! for node in cst.nodes().filter(|node| node.kind() == "django_block_block") {
+//!     println!("{:?}", node.byte_range());
+//! }
+//! # Ok(())
+//! # }
+//! ```
+
+use std::ops::Range;
+
+/// The format version this reader understands.
+pub const VERSION: u16 = 1;
+
+const MAGIC: &[u8; 4] = b"HDJC";
+const HEADER_SIZE: usize = 32;
+const NODE_SIZE: usize = 24;
+const NO_NODE: u32 = u32::MAX;
+
+/// Bits of [`Node::flags`].
+pub mod flags {
+    pub const NAMED: u16 = 1 << 0;
+    pub const MISSING: u16 = 1 << 1;
+    pub const EXTRA: u16 = 1 << 2;
+    pub const ERROR: u16 = 1 << 3;
+    pub const HAS_ERROR: u16 = 1 << 4;
+}
+
+/// Returned by [`Cst::new`] for a buffer that is truncated, of another format version, or
+/// whose nodes do not form a tree.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub struct InvalidCst;
+
+impl std::fmt::Display for InvalidCst {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.write_str("not a valid binary syntax tree")
+    }
+}
+
+impl std::error::Error for InvalidCst {}
+
+fn read_u16(data: &[u8], offset: usize) -> u16 {
+    u16::from_le_bytes([data[offset], data[offset + 1]])
+}
+
+fn read_u32(data: &[u8], offset: usize) -> u32 {
+    u32::from_le_bytes(data[offset..offset + 4].try_into().unwrap())
+}
+
+/// A binary syntax tree borrowed from a buffer. Opening it checks every node once, so that
+/// the accessors can trust the buffer; nothing is copied.
+#[derive(Clone, Copy, Debug)]
+pub struct Cst<'a> {
+    data: &'a [u8],
+    node_count: u32,
+    kind_count: u32,
+    field_count: u32,
+    names_offset: usize,
+}
+
+impl<'a> Cst<'a> {
+    pub fn new(data: &'a [u8]) -> Result<Self, InvalidCst> {
+        if data.len() < HEADER_SIZE
+            || &data[..4] != MAGIC
+            || read_u16(data, 4) != VERSION
+            || read_u16(data, 6) as usize != HEADER_SIZE
+        {
+            return Err(InvalidCst);
+        }
+        let total = read_u32(data, 24) as usize;
+        if total > data.len() {
+            return Err(InvalidCst);
+        }
+        let cst = Self {
+            data: &data[..total],
+            node_count: read_u32(data, 8),
+            kind_count: read_u32(data, 12),
+            field_count: read_u32(data, 16),
+            names_offset: read_u32(data, 20) as usize,
+        };
+        if cst.kind_count > 1 << 16
+            || cst.field_count > 1 << 16
+            || !cst.names_valid()
+            || !cst.nodes_valid()
+        {
+            return Err(InvalidCst);
+        }
+        Ok(cst)
+    }
+
+    fn names_valid(&self) -> bool {
+        let entries = self.kind_count as usize + self.field_count as usize;
+        let table = self.names_offset;
+        let total = self.data.len();
+        if table < HEADER_SIZE + self.node_count as usize * NODE_SIZE
+            || table > total
+            || (total - table) / 4 < entries
+        {
+            return false;
+        }
+        (0..entries).all(|entry| {
+            let offset = table + read_u32(self.data, table + entry * 4) as usize;
+            if offset < table + entries * 4 || offset >= total {
+                return false;
+            }
+            let rest = &self.data[offset..];
+            rest.iter()
+                .position(|&byte| byte == 0)
+                .is_some_and(|end| std::str::from_utf8(&rest[..end]).is_ok())
+        })
+    }
+
+    // Same checks as htmldjango_cst_open(): each parent is the innermost node whose range
+    // still contains the child, found by climbing from the previous node.
+    fn nodes_valid(&self) -> bool {
+        for index in 0..self.node_count {
+            let offset = self.node_offset(index);
+            let parent = read_u32(self.data, offset + 16);
+            let next = read_u32(self.data, offset + 20);
+            if read_u16(self.data, offset) as u32 >= self.kind_count
+                || read_u16(self.data, offset + 2) as u32 >= self.field_count
+                || read_u32(self.data, offset + 8) > read_u32(self.data, offset + 12)
+                || next <= index
+                || next > self.node_count
+            {
+                return false;
+            }
+            let mut open = if index == 0 { NO_NODE } else { index - 1 };
+            while open != NO_NODE && self.next(open) <= index {
+                open = self.parent_index(open);
+            }
+            if parent != open || (index > 0 && parent == NO_NODE) {
+                return false;
+            }
+            if parent != NO_NODE && next > self.next(parent) {
+                return false;
+            }
+        }
+        true
+    }
+
+    fn node_offset(&self, index: u32) -> usize {
+        HEADER_SIZE + index as usize * NODE_SIZE
+    }
+
+    fn parent_index(&self, index: u32) -> u32 {
+        read_u32(self.data, self.node_offset(index) + 16)
+    }
+
+    fn next(&self, index: u32) -> u32 {
+        read_u32(self.data, self.node_offset(index) + 20)
+    }
+
+    fn name(&self, entry: usize) -> &'a str {
+        let data: &'a [u8] = self.data;
+        let start = self.names_offset + read_u32(data, self.names_offset + entry * 4) as usize;
+        let length = data[start..].iter().position(|&byte| byte == 0).unwrap();
+        // Checked in `new`
+        std::str::from_utf8(&data[start..start + length]).unwrap()
+    }
+
+    /// The number of nodes, including the root.
+    pub fn len(&self) -> usize {
+        self.node_count as usize
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.node_count == 0
+    }
+
+    pub fn root(&self) -> Option<Node<'a>> {
+        (self.node_count > 0).then(|| self.node(0))
+    }
+
+    /// The node at `index` in pre-order.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `index` is not below [`Cst::len`].
+    pub fn node(&self, index: u32) -> Node<'a> {
+        assert!(index < self.node_count, "node index out of range");
+        Node { cst: *self, index }
+    }
+
+    /// All nodes in pre-order, without following any links.
+    pub fn nodes(&self) -> impl Iterator<Item = Node<'a>> + 'a {
+        let cst = *self;
+        (0..cst.node_count).map(move |index| Node { cst, index })
+    }
+
+    /// The name of a kind ID, as in `node-types.json`; kind 0 is `ERROR`.
+    pub fn kind_name(&self, kind: u16) -> Option<&'a str> {
+        ((kind as u32) < self.kind_count).then(|| self.name(kind as usize))
+    }
+
+    /// The name of a field ID; field 0 is the empty string.
+    pub fn field_name(&self, field: u16) -> Option<&'a str> {
+        ((field as u32) < self.field_count)
+            .then(|| self.name(self.kind_count as usize + field as usize))
+    }
+}
+
+/// A node of a [`Cst`]: its index and a copy of the (small) [`Cst`] handle.
+#[derive(Clone, Copy, Debug)]
+pub struct Node<'a> {
+    cst: Cst<'a>,
+    index: u32,
+}
+
+impl PartialEq for Node<'_> {
+    fn eq(&self, other: &Self) -> bool {
+        std::ptr::eq(self.cst.data, other.cst.data) && self.index == other.index
+    }
+}
+
+impl Eq for Node<'_> {}
+
+impl<'a> Node<'a> {
+    fn offset(&self) -> usize {
+        self.cst.node_offset(self.index)
+    }
+
+    /// The node's position in pre-order.
+    pub fn index(&self) -> u32 {
+        self.index
+    }
+
+    /// One of the [`kind`](crate::kinds::kind) constants.
+    pub fn kind_id(&self) -> u16 {
+        read_u16(self.cst.data, self.offset())
+    }
+
+    pub fn kind(&self) -> &'a str {
+        self.cst.name(self.kind_id() as usize)
+    }
+
+    /// The node's field in its parent, one of the [`field`](crate::kinds::field) constants.
+    pub fn field_id(&self) -> u16 {
+        read_u16(self.cst.data, self.offset() + 2)
+    }
+
+    pub fn field_name(&self) -> Option<&'a str> {
+        match self.field_id() {
+            0 => None,
+            field => self.cst.field_name(field),
+        }
+    }
+
+    /// A combination of the [`flags`] bits.
+    pub fn flags(&self) -> u16 {
+        read_u16(self.cst.data, self.offset() + 4)
+    }
+
+    pub fn is_named(&self) -> bool {
+        self.flags() & flags::NAMED != 0
+    }
+
+    pub fn is_missing(&self) -> bool {
+        self.flags() & flags::MISSING != 0
+    }
+
+    pub fn is_extra(&self) -> bool {
+        self.flags() & flags::EXTRA != 0
+    }
+
+    pub fn is_error(&self) -> bool {
+        self.flags() & flags::ERROR != 0
+    }
+
+    pub fn has_error(&self) -> bool {
+        self.flags() & flags::HAS_ERROR != 0
+    }
+
+    pub fn start_byte(&self) -> usize {
+        read_u32(self.cst.data, self.offset() + 8) as usize
+    }
+
+    pub fn end_byte(&self) -> usize {
+        read_u32(self.cst.data, self.offset() + 12) as usize
+    }
+
+    pub fn byte_range(&self) -> Range<usize> {
+        self.start_byte()..self.end_byte()
+    }
+
+    pub fn parent(&self) -> Option<Node<'a>> {
+        match self.cst.parent_index(self.index) {
+            NO_NODE => None,
+            index => Some(Node {
+                cst: self.cst,
+                index,
+            }),
+        }
+    }
+
+    /// The number of nodes in this node's subtree, itself included.
+    pub fn descendant_count(&self) -> usize {
+        (self.cst.next(self.index) - self.index) as usize
+    }
+
+    pub fn child_count(&self) -> usize {
+        self.children().count()
+    }
+
+    pub fn children(&self) -> Children<'a> {
+        Children {
+            cst: self.cst,
+            next: self.index + 1,
+            end: self.cst.next(self.index),
+        }
+    }
+
+    /// This node and its descendants, in pre-order.
+    pub fn descendants(&self) -> impl Iterator<Item = Node<'a>> + 'a {
+        let cst = self.cst;
+        (self.index..cst.next(self.index)).map(move |index| Node { cst, index })
+    }
+}
+
+/// The children of a [`Node`], from [`Node::children`].
+#[derive(Clone, Debug)]
+pub struct Children<'a> {
+    cst: Cst<'a>,
+    next: u32,
+    end: u32,
+}
+
+impl<'a> Iterator for Children<'a> {
+    type Item = Node<'a>;
+
+    fn next(&mut self) -> Option<Node<'a>> {
+        if self.next >= self.end {
+            return None;
+        }
+        let index = self.next;
+        self.next = self.cst.next(index);
+        Some(Node {
+            cst: self.cst,
+            index,
+        })
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    // (kind, field, flags, start, end, parent, next)
+    type Record = (u16, u16, u16, u32, u32, u32, u32);
+
+    fn buffer(nodes: &[Record], kinds: &[&str], fields: &[&str]) -> Vec<u8> {
+        let names_offset = HEADER_SIZE + nodes.len() * NODE_SIZE;
+        let mut table = Vec::new();
+        let mut strings = Vec::new();
+        let entries = kinds.len() + fields.len();
+        for name in kinds.iter().chain(fields) {
+            table.extend_from_slice(&((entries * 4 + strings.len()) as u32).to_le_bytes());
+            strings.extend_from_slice(name.as_bytes());
+            strings.push(0);
+        }
+        let total = names_offset + table.len() + strings.len();
+
+        let mut data = Vec::with_capacity(total);
+        data.extend_from_slice(MAGIC);
+        data.extend_from_slice(&VERSION.to_le_bytes());
+        data.extend_from_slice(&(HEADER_SIZE as u16).to_le_bytes());
+        for value in [
+            nodes.len(),
+            kinds.len(),
+            fields.len(),
+            names_offset,
+            total,
+            0,
+        ] {
+            data.extend_from_slice(&(value as u32).to_le_bytes());
+        }
+        for &(kind, field, flags, start, end, parent, next) in nodes {
+            for value in [kind, field, flags, 0] {
+                data.extend_from_slice(&value.to_le_bytes());
+            }
+            for value in [start, end, parent, next] {
+                data.extend_from_slice(&value.to_le_bytes());
+            }
+        }
+        data.extend_from_slice(&table);
+        data.extend_from_slice(&strings);
+        data
+    }
+
+    const KINDS: &[&str] = &["ERROR", "template", "django_if_block", "content", "{%"];
+    const FIELDS: &[&str] = &["", "condition"];
+
+    fn sample() -> Vec<u8> {
+        buffer(
+            &[
+                (1, 0, flags::NAMED | flags::HAS_ERROR, 0, 12, NO_NODE, 5),
+                (2, 1, flags::NAMED | flags::HAS_ERROR, 0, 10, 0, 4),
+                (3, 0, flags::NAMED, 5, 6, 1, 3),
+                (
+                    0,
+                    0,
+                    flags::NAMED | flags::ERROR | flags::HAS_ERROR,
+                    6,
+                    7,
+                    1,
+                    4,
+                ),
+                (4, 0, 0, 10, 12, 0, 5),
+            ],
+            KINDS,
+            FIELDS,
+        )
+    }
+
+    #[test]
+    fn test_read() {
+        let data = sample();
+        let cst = Cst::new(&data).unwrap();
+        assert_eq!(cst.len(), 5);
+        let root = cst.root().unwrap();
+        assert_eq!(root.kind(), "template");
+        assert!(root.parent().is_none());
+        assert_eq!(root.descendant_count(), 5);
+
+        let children: Vec<_> = root.children().map(|node| node.kind()).collect();
+        assert_eq!(children, ["django_if_block", "{%"]);
+        let block = root.children().next().unwrap();
+        assert_eq!(block.field_name(), Some("condition"));
+        assert_eq!(block.byte_range(), 0..10);
+        assert_eq!(block.child_count(), 2);
+        assert!(block.children().nth(1).unwrap().is_error());
+        assert_eq!(block.children().next().unwrap().parent(), Some(block));
+        assert!(!cst.node(4).is_named());
+        assert_eq!(cst.nodes().filter(|node| node.has_error()).count(), 3);
+        assert_eq!(cst.kind_name(0), Some("ERROR"));
+        assert_eq!(cst.field_name(2), None);
+    }
+
+    #[test]
+    fn test_reject_invalid() {
+        let data = sample();
+        for length in 0..data.len() {
+            assert_eq!(Cst::new(&data[..length]).err(), Some(InvalidCst));
+        }
+        // A node outside its parent's range
+        let broken = buffer(
+            &[
+                (1, 0, 0, 0, 1, NO_NODE, 2),
+                (3, 0, 0, 0, 1, 0, 3),
+                (3, 0, 0, 0, 1, 0, 3),
+            ],
+            KINDS,
+            FIELDS,
+        );
+        assert!(Cst::new(&broken).is_err());
+        // A parent that is not the innermost open node
+        let broken = buffer(
+            &[
+                (1, 0, 0, 0, 1, NO_NODE, 3),
+                (3, 0, 0, 0, 1, 0, 3),
+                (3, 0, 0, 0, 1, 0, 3),
+            ],
+            KINDS,
+            FIELDS,
+        );
+        assert!(Cst::new(&broken).is_err());
+        let broken = buffer(&[(5, 0, 0, 0, 1, NO_NODE, 1)], KINDS, FIELDS);
+        assert!(Cst::new(&broken).is_err());
+    }
+}
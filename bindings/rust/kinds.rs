@@ -0,0 +1,662 @@
+// Generated by tools/gen_kinds.py from src/node-types.json. Do not edit.
+
+/// Node kind IDs, as returned by [`KindMap::kind`](crate::KindMap::kind) and stored in a
+/// [`Cst`](crate::cst::Cst).
+pub mod kind {
+    /// `ERROR`
+    pub const ERROR: u16 = 0;
+    /// `comparison_operator`
+    pub const COMPARISON_OPERATOR: u16 = 1;
+    /// `django_statement`
+    pub const DJANGO_STATEMENT: u16 = 2;
+    /// `element`
+    pub const ELEMENT: u16 = 3;
+    /// `literal`
+    pub const LITERAL: u16 = 4;
+    /// `and_expression`
+    pub const AND_EXPRESSION: u16 = 5;
+    /// `as_alias`
+    pub const AS_ALIAS: u16 = 6;
+    /// `assignment`
+    pub const ASSIGNMENT: u16 = 7;
+    /// `attribute`
+    pub const ATTRIBUTE: u16 = 8;
+    /// `attribute_name`
+    pub const ATTRIBUTE_NAME: u16 = 9;
+    /// `attribute_value`
+    pub const ATTRIBUTE_VALUE: u16 = 10;
+    /// `comparison_expression`
+    pub const COMPARISON_EXPRESSION: u16 = 11;
+    /// `cycle_value`
+    pub const CYCLE_VALUE: u16 = 12;
+    /// `django_attribute_elif_branch`
+    pub const DJANGO_ATTRIBUTE_ELIF_BRANCH: u16 = 13;
+    /// `django_attribute_else_branch`
+    pub const DJANGO_ATTRIBUTE_ELSE_BRANCH: u16 = 14;
+    /// `django_attribute_empty_branch`
+    pub const DJANGO_ATTRIBUTE_EMPTY_BRANCH: u16 = 15;
+    /// `django_attribute_for_block`
+    pub const DJANGO_ATTRIBUTE_FOR_BLOCK: u16 = 16;
+    /// `django_attribute_if_block`
+    pub const DJANGO_ATTRIBUTE_IF_BLOCK: u16 = 17;
+    /// `django_autoescape_block`
+    pub const DJANGO_AUTOESCAPE_BLOCK: u16 = 18;
+    /// `django_block_block`
+    pub const DJANGO_BLOCK_BLOCK: u16 = 19;
+    /// `django_block_comment`
+    pub const DJANGO_BLOCK_COMMENT: u16 = 20;
+    /// `django_block_open`
+    pub const DJANGO_BLOCK_OPEN: u16 = 21;
+    /// `django_csrf_token_tag`
+    pub const DJANGO_CSRF_TOKEN_TAG: u16 = 22;
+    /// `django_cycle_tag`
+    pub const DJANGO_CYCLE_TAG: u16 = 23;
+    /// `django_debug_tag`
+    pub const DJANGO_DEBUG_TAG: u16 = 24;
+    /// `django_elif`
+    pub const DJANGO_ELIF: u16 = 25;
+    /// `django_elif_branch`
+    pub const DJANGO_ELIF_BRANCH: u16 = 26;
+    /// `django_else`
+    pub const DJANGO_ELSE: u16 = 27;
+    /// `django_else_branch`
+    pub const DJANGO_ELSE_BRANCH: u16 = 28;
+    /// `django_empty`
+    pub const DJANGO_EMPTY: u16 = 29;
+    /// `django_empty_branch`
+    pub const DJANGO_EMPTY_BRANCH: u16 = 30;
+    /// `django_endblock`
+    pub const DJANGO_ENDBLOCK: u16 = 31;
+    /// `django_endfor`
+    pub const DJANGO_ENDFOR: u16 = 32;
+    /// `django_endif`
+    pub const DJANGO_ENDIF: u16 = 33;
+    /// `django_endwith`
+    pub const DJANGO_ENDWITH: u16 = 34;
+    /// `django_extends_tag`
+    pub const DJANGO_EXTENDS_TAG: u16 = 35;
+    /// `django_filter_block`
+    pub const DJANGO_FILTER_BLOCK: u16 = 36;
+    /// `django_firstof_tag`
+    pub const DJANGO_FIRSTOF_TAG: u16 = 37;
+    /// `django_for_block`
+    pub const DJANGO_FOR_BLOCK: u16 = 38;
+    /// `django_for_open`
+    pub const DJANGO_FOR_OPEN: u16 = 39;
+    /// `django_generic_block`
+    pub const DJANGO_GENERIC_BLOCK: u16 = 40;
+    /// `django_generic_tag`
+    pub const DJANGO_GENERIC_TAG: u16 = 41;
+    /// `django_if_block`
+    pub const DJANGO_IF_BLOCK: u16 = 42;
+    /// `django_if_open`
+    pub const DJANGO_IF_OPEN: u16 = 43;
+    /// `django_ifchanged_block`
+    pub const DJANGO_IFCHANGED_BLOCK: u16 = 44;
+    /// `django_include_tag`
+    pub const DJANGO_INCLUDE_TAG: u16 = 45;
+    /// `django_interpolation`
+    pub const DJANGO_INTERPOLATION: u16 = 46;
+    /// `django_load_tag`
+    pub const DJANGO_LOAD_TAG: u16 = 47;
+    /// `django_lorem_tag`
+    pub const DJANGO_LOREM_TAG: u16 = 48;
+    /// `django_now_tag`
+    pub const DJANGO_NOW_TAG: u16 = 49;
+    /// `django_partial_tag`
+    pub const DJANGO_PARTIAL_TAG: u16 = 50;
+    /// `django_partialdef_block`
+    pub const DJANGO_PARTIALDEF_BLOCK: u16 = 51;
+    /// `django_querystring_tag`
+    pub const DJANGO_QUERYSTRING_TAG: u16 = 52;
+    /// `django_regroup_tag`
+    pub const DJANGO_REGROUP_TAG: u16 = 53;
+    /// `django_resetcycle_tag`
+    pub const DJANGO_RESETCYCLE_TAG: u16 = 54;
+    /// `django_spaceless_block`
+    pub const DJANGO_SPACELESS_BLOCK: u16 = 55;
+    /// `django_templatetag_tag`
+    pub const DJANGO_TEMPLATETAG_TAG: u16 = 56;
+    /// `django_url_tag`
+    pub const DJANGO_URL_TAG: u16 = 57;
+    /// `django_verbatim_block`
+    pub const DJANGO_VERBATIM_BLOCK: u16 = 58;
+    /// `django_widthratio_tag`
+    pub const DJANGO_WIDTHRATIO_TAG: u16 = 59;
+    /// `django_with_block`
+    pub const DJANGO_WITH_BLOCK: u16 = 60;
+    /// `django_with_open`
+    pub const DJANGO_WITH_OPEN: u16 = 61;
+    /// `doctype`
+    pub const DOCTYPE: u16 = 62;
+    /// `document`
+    pub const DOCUMENT: u16 = 63;
+    /// `end_tag`
+    pub const END_TAG: u16 = 64;
+    /// `erroneous_end_tag`
+    pub const ERRONEOUS_END_TAG: u16 = 65;
+    /// `filter_argument`
+    pub const FILTER_ARGUMENT: u16 = 66;
+    /// `filter_call`
+    pub const FILTER_CALL: u16 = 67;
+    /// `filter_chain`
+    pub const FILTER_CHAIN: u16 = 68;
+    /// `filter_expression`
+    pub const FILTER_EXPRESSION: u16 = 69;
+    /// `foreign_element`
+    pub const FOREIGN_ELEMENT: u16 = 70;
+    /// `lookup`
+    pub const LOOKUP: u16 = 71;
+    /// `loop_variables`
+    pub const LOOP_VARIABLES: u16 = 72;
+    /// `named_argument`
+    pub const NAMED_ARGUMENT: u16 = 73;
+    /// `normal_element`
+    pub const NORMAL_ELEMENT: u16 = 74;
+    /// `not_expression`
+    pub const NOT_EXPRESSION: u16 = 75;
+    /// `or_expression`
+    pub const OR_EXPRESSION: u16 = 76;
+    /// `plaintext_element`
+    pub const PLAINTEXT_ELEMENT: u16 = 77;
+    /// `quoted_attribute_value`
+    pub const QUOTED_ATTRIBUTE_VALUE: u16 = 78;
+    /// `raw_text`
+    pub const RAW_TEXT: u16 = 79;
+    /// `rcdata_element`
+    pub const RCDATA_ELEMENT: u16 = 80;
+    /// `script_element`
+    pub const SCRIPT_ELEMENT: u16 = 81;
+    /// `start_tag`
+    pub const START_TAG: u16 = 82;
+    /// `string`
+    pub const STRING: u16 = 83;
+    /// `style_element`
+    pub const STYLE_ELEMENT: u16 = 84;
+    /// `tag_argument`
+    pub const TAG_ARGUMENT: u16 = 85;
+    /// `test_expression`
+    pub const TEST_EXPRESSION: u16 = 86;
+    /// `text`
+    pub const TEXT: u16 = 87;
+    /// `unpaired_end_tag`
+    pub const UNPAIRED_END_TAG: u16 = 88;
+    /// `unpaired_start_tag`
+    pub const UNPAIRED_START_TAG: u16 = 89;
+    /// `void_element`
+    pub const VOID_ELEMENT: u16 = 90;
+    /// `with_assignments`
+    pub const WITH_ASSIGNMENTS: u16 = 91;
+    /// `with_legacy`
+    pub const WITH_LEGACY: u16 = 92;
+    /// Anonymous `"`
+    pub const ANON_DQUOTE: u16 = 93;
+    /// Anonymous `%}`
+    pub const ANON_PERCENT_RBRACE: u16 = 94;
+    /// Anonymous `'`
+    pub const ANON_SQUOTE: u16 = 95;
+    /// Anonymous `,`
+    pub const ANON_COMMA: u16 = 96;
+    /// Anonymous `.`
+    pub const ANON_DOT: u16 = 97;
+    /// Anonymous `/>`
+    pub const ANON_SLASH_GT: u16 = 98;
+    /// Anonymous `:`
+    pub const ANON_COLON: u16 = 99;
+    /// Anonymous `<`
+    pub const ANON_LT: u16 = 100;
+    /// Anonymous `<!`
+    pub const ANON_LT_BANG: u16 = 101;
+    /// Anonymous `</`
+    pub const ANON_LT_SLASH: u16 = 102;
+    /// Anonymous `=`
+    pub const ANON_EQ: u16 = 103;
+    /// Anonymous `>`
+    pub const ANON_GT: u16 = 104;
+    /// Anonymous `and`
+    pub const ANON_AND: u16 = 105;
+    /// `and_keyword`
+    pub const AND_KEYWORD: u16 = 106;
+    /// `argument_name`
+    pub const ARGUMENT_NAME: u16 = 107;
+    /// Anonymous `as`
+    pub const ANON_AS: u16 = 108;
+    /// Anonymous `autoescape`
+    pub const ANON_AUTOESCAPE: u16 = 109;
+    /// `autoescape_value`
+    pub const AUTOESCAPE_VALUE: u16 = 110;
+    /// Anonymous `block`
+    pub const ANON_BLOCK: u16 = 111;
+    /// `block_name`
+    pub const BLOCK_NAME: u16 = 112;
+    /// Anonymous `by`
+    pub const ANON_BY: u16 = 113;
+    /// `comment`
+    pub const COMMENT: u16 = 114;
+    /// Anonymous `comment`
+    pub const ANON_COMMENT: u16 = 115;
+    /// `comment_content`
+    pub const COMMENT_CONTENT: u16 = 116;
+    /// `comment_text`
+    pub const COMMENT_TEXT: u16 = 117;
+    /// Anonymous `csrf_token`
+    pub const ANON_CSRF_TOKEN: u16 = 118;
+    /// Anonymous `cycle`
+    pub const ANON_CYCLE: u16 = 119;
+    /// `cycle_name`
+    pub const CYCLE_NAME: u16 = 120;
+    /// Anonymous `debug`
+    pub const ANON_DEBUG: u16 = 121;
+    /// `django_line_comment`
+    pub const DJANGO_LINE_COMMENT: u16 = 122;
+    /// `doctype_keyword`
+    pub const DOCTYPE_KEYWORD: u16 = 123;
+    /// Anonymous `elif`
+    pub const ANON_ELIF: u16 = 124;
+    /// Anonymous `else`
+    pub const ANON_ELSE: u16 = 125;
+    /// Anonymous `empty`
+    pub const ANON_EMPTY: u16 = 126;
+    /// `end_tag_name`
+    pub const END_TAG_NAME: u16 = 127;
+    /// Anonymous `endautoescape`
+    pub const ANON_ENDAUTOESCAPE: u16 = 128;
+    /// Anonymous `endblock`
+    pub const ANON_ENDBLOCK: u16 = 129;
+    /// Anonymous `endcomment`
+    pub const ANON_ENDCOMMENT: u16 = 130;
+    /// Anonymous `endfilter`
+    pub const ANON_ENDFILTER: u16 = 131;
+    /// Anonymous `endfor`
+    pub const ANON_ENDFOR: u16 = 132;
+    /// Anonymous `endif`
+    pub const ANON_ENDIF: u16 = 133;
+    /// Anonymous `endifchanged`
+    pub const ANON_ENDIFCHANGED: u16 = 134;
+    /// Anonymous `endpartialdef`
+    pub const ANON_ENDPARTIALDEF: u16 = 135;
+    /// Anonymous `endspaceless`
+    pub const ANON_ENDSPACELESS: u16 = 136;
+    /// Anonymous `endwith`
+    pub const ANON_ENDWITH: u16 = 137;
+    /// `entity`
+    pub const ENTITY: u16 = 138;
+    /// `erroneous_end_tag_name`
+    pub const ERRONEOUS_END_TAG_NAME: u16 = 139;
+    /// Anonymous `extends`
+    pub const ANON_EXTENDS: u16 = 140;
+    /// Anonymous `filter`
+    pub const ANON_FILTER: u16 = 141;
+    /// `filter_name`
+    pub const FILTER_NAME: u16 = 142;
+    /// Anonymous `firstof`
+    pub const ANON_FIRSTOF: u16 = 143;
+    /// Anonymous `for`
+    pub const ANON_FOR: u16 = 144;
+    /// Anonymous `from`
+    pub const ANON_FROM: u16 = 145;
+    /// `generic_tag_name`
+    pub const GENERIC_TAG_NAME: u16 = 146;
+    /// `i18n_string`
+    pub const I18N_STRING: u16 = 147;
+    /// `identifier`
+    pub const IDENTIFIER: u16 = 148;
+    /// Anonymous `if`
+    pub const ANON_IF: u16 = 149;
+    /// Anonymous `ifchanged`
+    pub const ANON_IFCHANGED: u16 = 150;
+    /// `implicit_end_tag`
+    pub const IMPLICIT_END_TAG: u16 = 151;
+    /// Anonymous `in`
+    pub const ANON_IN: u16 = 152;
+    /// Anonymous `include`
+    pub const ANON_INCLUDE: u16 = 153;
+    /// `inline`
+    pub const INLINE: u16 = 154;
+    /// `library_name`
+    pub const LIBRARY_NAME: u16 = 155;
+    /// Anonymous `load`
+    pub const ANON_LOAD: u16 = 156;
+    /// Anonymous `lorem`
+    pub const ANON_LOREM: u16 = 157;
+    /// `method`
+    pub const METHOD: u16 = 158;
+    /// `name_segment`
+    pub const NAME_SEGMENT: u16 = 159;
+    /// Anonymous `not`
+    pub const ANON_NOT: u16 = 160;
+    /// Anonymous `now`
+    pub const ANON_NOW: u16 = 161;
+    /// `number`
+    pub const NUMBER: u16 = 162;
+    /// `numeric_index`
+    pub const NUMERIC_INDEX: u16 = 163;
+    /// `only`
+    pub const ONLY: u16 = 164;
+    /// `op_eq`
+    pub const OP_EQ: u16 = 165;
+    /// `op_gt`
+    pub const OP_GT: u16 = 166;
+    /// `op_gte`
+    pub const OP_GTE: u16 = 167;
+    /// `op_in`
+    pub const OP_IN: u16 = 168;
+    /// `op_is`
+    pub const OP_IS: u16 = 169;
+    /// `op_is_not`
+    pub const OP_IS_NOT: u16 = 170;
+    /// `op_lt`
+    pub const OP_LT: u16 = 171;
+    /// `op_lte`
+    pub const OP_LTE: u16 = 172;
+    /// `op_ne`
+    pub const OP_NE: u16 = 173;
+    /// `op_not_in`
+    pub const OP_NOT_IN: u16 = 174;
+    /// `or_keyword`
+    pub const OR_KEYWORD: u16 = 175;
+    /// Anonymous `partial`
+    pub const ANON_PARTIAL: u16 = 176;
+    /// `partial_name`
+    pub const PARTIAL_NAME: u16 = 177;
+    /// Anonymous `partialdef`
+    pub const ANON_PARTIALDEF: u16 = 178;
+    /// `plaintext_text`
+    pub const PLAINTEXT_TEXT: u16 = 179;
+    /// Anonymous `querystring`
+    pub const ANON_QUERYSTRING: u16 = 180;
+    /// `random`
+    pub const RANDOM: u16 = 181;
+    /// `rcdata_text`
+    pub const RCDATA_TEXT: u16 = 182;
+    /// Anonymous `regroup`
+    pub const ANON_REGROUP: u16 = 183;
+    /// Anonymous `resetcycle`
+    pub const ANON_RESETCYCLE: u16 = 184;
+    /// `reversed`
+    pub const REVERSED: u16 = 185;
+    /// `silent`
+    pub const SILENT: u16 = 186;
+    /// Anonymous `spaceless`
+    pub const ANON_SPACELESS: u16 = 187;
+    /// `tag_name`
+    pub const TAG_NAME: u16 = 188;
+    /// Anonymous `templatetag`
+    pub const ANON_TEMPLATETAG: u16 = 189;
+    /// `templatetag_argument`
+    pub const TEMPLATETAG_ARGUMENT: u16 = 190;
+    /// Anonymous `url`
+    pub const ANON_URL: u16 = 191;
+    /// `variable_name`
+    pub const VARIABLE_NAME: u16 = 192;
+    /// Anonymous `verbatim`
+    pub const ANON_VERBATIM: u16 = 193;
+    /// `verbatim_content`
+    pub const VERBATIM_CONTENT: u16 = 194;
+    /// Anonymous `widthratio`
+    pub const ANON_WIDTHRATIO: u16 = 195;
+    /// Anonymous `with`
+    pub const ANON_WITH: u16 = 196;
+    /// Anonymous `{%`
+    pub const ANON_LBRACE_PERCENT: u16 = 197;
+    /// Anonymous `{{`
+    pub const ANON_LBRACE_LBRACE: u16 = 198;
+    /// Anonymous `|`
+    pub const ANON_PIPE: u16 = 199;
+    /// Anonymous `}}`
+    pub const ANON_RBRACE_RBRACE: u16 = 200;
+}
+
+/// Field IDs, as returned by [`KindMap::field`](crate::KindMap::field). 0 is no field.
+pub mod field {
+    pub const NONE: u16 = 0;
+    pub const ALIAS: u16 = 1;
+    pub const ARGUMENT: u16 = 2;
+    pub const BODY: u16 = 3;
+    pub const CONDITION: u16 = 4;
+    pub const COUNT: u16 = 5;
+    pub const END_NAME: u16 = 6;
+    pub const FILTERS: u16 = 7;
+    pub const FORMAT: u16 = 8;
+    pub const GROUPER: u16 = 9;
+    pub const ITERABLE: u16 = 10;
+    pub const MAX_VALUE: u16 = 11;
+    pub const MAX_WIDTH: u16 = 12;
+    pub const NAME: u16 = 13;
+    pub const SOURCE: u16 = 14;
+    pub const TARGET: u16 = 15;
+    pub const TEMPLATE: u16 = 16;
+    pub const URL_NAME: u16 = 17;
+    pub const VALUE: u16 = 18;
+}
+
+pub const KIND_COUNT: usize = 201;
+
+/// The node type name and whether it is named, by kind ID
+pub const KIND_NAMES: [(&str, bool); KIND_COUNT] = [
+    ("ERROR", true),
+    ("comparison_operator", true),
+    ("django_statement", true),
+    ("element", true),
+    ("literal", true),
+    ("and_expression", true),
+    ("as_alias", true),
+    ("assignment", true),
+    ("attribute", true),
+    ("attribute_name", true),
+    ("attribute_value", true),
+    ("comparison_expression", true),
+    ("cycle_value", true),
+    ("django_attribute_elif_branch", true),
+    ("django_attribute_else_branch", true),
+    ("django_attribute_empty_branch", true),
+    ("django_attribute_for_block", true),
+    ("django_attribute_if_block", true),
+    ("django_autoescape_block", true),
+    ("django_block_block", true),
+    ("django_block_comment", true),
+    ("django_block_open", true),
+    ("django_csrf_token_tag", true),
+    ("django_cycle_tag", true),
+    ("django_debug_tag", true),
+    ("django_elif", true),
+    ("django_elif_branch", true),
+    ("django_else", true),
+    ("django_else_branch", true),
+    ("django_empty", true),
+    ("django_empty_branch", true),
+    ("django_endblock", true),
+    ("django_endfor", true),
+    ("django_endif", true),
+    ("django_endwith", true),
+    ("django_extends_tag", true),
+    ("django_filter_block", true),
+    ("django_firstof_tag", true),
+    ("django_for_block", true),
+    ("django_for_open", true),
+    ("django_generic_block", true),
+    ("django_generic_tag", true),
+    ("django_if_block", true),
+    ("django_if_open", true),
+    ("django_ifchanged_block", true),
+    ("django_include_tag", true),
+    ("django_interpolation", true),
+    ("django_load_tag", true),
+    ("django_lorem_tag", true),
+    ("django_now_tag", true),
+    ("django_partial_tag", true),
+    ("django_partialdef_block", true),
+    ("django_querystring_tag", true),
+    ("django_regroup_tag", true),
+    ("django_resetcycle_tag", true),
+    ("django_spaceless_block", true),
+    ("django_templatetag_tag", true),
+    ("django_url_tag", true),
+    ("django_verbatim_block", true),
+    ("django_widthratio_tag", true),
+    ("django_with_block", true),
+    ("django_with_open", true),
+    ("doctype", true),
+    ("document", true),
+    ("end_tag", true),
+    ("erroneous_end_tag", true),
+    ("filter_argument", true),
+    ("filter_call", true),
+    ("filter_chain", true),
+    ("filter_expression", true),
+    ("foreign_element", true),
+    ("lookup", true),
+    ("loop_variables", true),
+    ("named_argument", true),
+    ("normal_element", true),
+    ("not_expression", true),
+    ("or_expression", true),
+    ("plaintext_element", true),
+    ("quoted_attribute_value", true),
+    ("raw_text", true),
+    ("rcdata_element", true),
+    ("script_element", true),
+    ("start_tag", true),
+    ("string", true),
+    ("style_element", true),
+    ("tag_argument", true),
+    ("test_expression", true),
+    ("text", true),
+    ("unpaired_end_tag", true),
+    ("unpaired_start_tag", true),
+    ("void_element", true),
+    ("with_assignments", true),
+    ("with_legacy", true),
+    ("\"", false),
+    ("%}", false),
+    ("'", false),
+    (",", false),
+    (".", false),
+    ("/>", false),
+    (":", false),
+    ("<", false),
+    ("<!", false),
+    ("</", false),
+    ("=", false),
+    (">", false),
+    ("and", false),
+    ("and_keyword", true),
+    ("argument_name", true),
+    ("as", false),
+    ("autoescape", false),
+    ("autoescape_value", true),
+    ("block", false),
+    ("block_name", true),
+    ("by", false),
+    ("comment", true),
+    ("comment", false),
+    ("comment_content", true),
+    ("comment_text", true),
+    ("csrf_token", false),
+    ("cycle", false),
+    ("cycle_name", true),
+    ("debug", false),
+    ("django_line_comment", true),
+    ("doctype_keyword", true),
+    ("elif", false),
+    ("else", false),
+    ("empty", false),
+    ("end_tag_name", true),
+    ("endautoescape", false),
+    ("endblock", false),
+    ("endcomment", false),
+    ("endfilter", false),
+    ("endfor", false),
+    ("endif", false),
+    ("endifchanged", false),
+    ("endpartialdef", false),
+    ("endspaceless", false),
+    ("endwith", false),
+    ("entity", true),
+    ("erroneous_end_tag_name", true),
+    ("extends", false),
+    ("filter", false),
+    ("filter_name", true),
+    ("firstof", false),
+    ("for", false),
+    ("from", false),
+    ("generic_tag_name", true),
+    ("i18n_string", true),
+    ("identifier", true),
+    ("if", false),
+    ("ifchanged", false),
+    ("implicit_end_tag", true),
+    ("in", false),
+    ("include", false),
+    ("inline", true),
+    ("library_name", true),
+    ("load", false),
+    ("lorem", false),
+    ("method", true),
+    ("name_segment", true),
+    ("not", false),
+    ("now", false),
+    ("number", true),
+    ("numeric_index", true),
+    ("only", true),
+    ("op_eq", true),
+    ("op_gt", true),
+    ("op_gte", true),
+    ("op_in", true),
+    ("op_is", true),
+    ("op_is_not", true),
+    ("op_lt", true),
+    ("op_lte", true),
+    ("op_ne", true),
+    ("op_not_in", true),
+    ("or_keyword", true),
+    ("partial", false),
+    ("partial_name", true),
+    ("partialdef", false),
+    ("plaintext_text", true),
+    ("querystring", false),
+    ("random", true),
+    ("rcdata_text", true),
+    ("regroup", false),
+    ("resetcycle", false),
+    ("reversed", true),
+    ("silent", true),
+    ("spaceless", false),
+    ("tag_name", true),
+    ("templatetag", false),
+    ("templatetag_argument", true),
+    ("url", false),
+    ("variable_name", true),
+    ("verbatim", false),
+    ("verbatim_content", true),
+    ("widthratio", false),
+    ("with", false),
+    ("{%", false),
+    ("{{", false),
+    ("|", false),
+    ("}}", false),
+];
+
+pub const FIELD_COUNT: usize = 19;
+
+pub const FIELD_NAMES: [&str; FIELD_COUNT] = [
+    "",
+    "alias",
+    "argument",
+    "body",
+    "condition",
+    "count",
+    "end_name",
+    "filters",
+    "format",
+    "grouper",
+    "iterable",
+    "max_value",
+    "max_width",
+    "name",
+    "source",
+    "target",
+    "template",
+    "url_name",
+    "value",
+];
@@ -23,8 +23,12 @@
 
 use tree_sitter_language::LanguageFn;
 
+pub mod cst;
+pub mod kinds;
+
 extern "C" {
     fn tree_sitter_htmldjango() -> *const ();
+    fn tree_sitter_htmldjango_expression() -> *const ();
 }
 
 /// The tree-sitter [`LanguageFn`][LanguageFn] for this grammar.
@@ -32,17 +36,261 @@ extern "C" {
 /// [LanguageFn]: https://docs.rs/tree-sitter-language/*/tree_sitter_language/struct.LanguageFn.html
 pub const LANGUAGE: LanguageFn = unsafe { LanguageFn::from_raw(tree_sitter_htmldjango) };
 
+/// The tree-sitter [`LanguageFn`][LanguageFn] for standalone Django expressions: the
+/// inside of `{{ ... }}` or `{% if ... %}`, without the surrounding template.
+///
+/// [LanguageFn]: https://docs.rs/tree-sitter-language/*/tree_sitter_language/struct.LanguageFn.html
+pub const LANGUAGE_EXPRESSION: LanguageFn =
+    unsafe { LanguageFn::from_raw(tree_sitter_htmldjango_expression) };
+
 /// The content of the [`node-types.json`][] file for this grammar.
 ///
 /// [`node-types.json`]: https://tree-sitter.github.io/tree-sitter/using-parsers#static-node-types
 pub const NODE_TYPES: &str = include_str!("../../src/node-types.json");
 
+/// The content of the [`node-types.json`][] file for the expression grammar.
+///
+/// [`node-types.json`]: https://tree-sitter.github.io/tree-sitter/using-parsers#static-node-types
+pub const EXPRESSION_NODE_TYPES: &str = include_str!("../../expression/src/node-types.json");
+
 /// The syntax highlighting query for this language.
 pub const HIGHLIGHTS_QUERY: &str = include_str!("../../queries/highlights.scm");
 
 /// The injection query for this language.
 pub const INJECTIONS_QUERY: &str = include_str!("../../queries/injections.scm");
 
+/// The symbol tagging query for this language: block and partial definitions, and
+/// references to templates, partials, URL names and tag libraries.
+pub const TAGS_QUERY: &str = include_str!("../../queries/tags.scm");
+
+/// The local variable query for this language: for, with and block scopes, the names
+/// they bind, and variable lookups.
+pub const LOCALS_QUERY: &str = include_str!("../../queries/locals.scm");
+
+/// Parses the template at `path` straight from a read-only memory map of the file.
+///
+/// The parser reads the mapped pages in place, so a large template is never copied into a
+/// `String` or `Vec<u8>` first. The map is dropped before this returns; read the file again
+/// if node text is needed afterwards. Requires the `mmap` feature.
+#[cfg(feature = "mmap")]
+pub fn parse_file(
+    parser: &mut tree_sitter::Parser,
+    path: impl AsRef<std::path::Path>,
+    old_tree: Option<&tree_sitter::Tree>,
+) -> std::io::Result<Option<tree_sitter::Tree>> {
+    let file = std::fs::File::open(path)?;
+    if file.metadata()?.len() == 0 {
+        return Ok(parser.parse(b"", old_tree));
+    }
+    // SAFETY: the map is only read while it is alive. As with any memory map, another
+    // process truncating the file during the parse would fault.
+    let map = unsafe { memmap2::Mmap::map(&file)? };
+    #[cfg(unix)]
+    let _ = map.advise(memmap2::Advice::Sequential);
+    Ok(parser.parse(&map[..], old_tree))
+}
+
+/// A `{% block %}` tag pair found by [`block_map`]. Offsets are in bytes.
+#[derive(Clone, Debug, PartialEq, Eq)]
+pub struct Block<'a> {
+    pub name: &'a str,
+    /// From the start of `{% block %}` to the end of `{% endblock %}`
+    pub range: std::ops::Range<usize>,
+    /// Between the two tags
+    pub content_range: std::ops::Range<usize>,
+    /// 0 for a top-level block
+    pub depth: usize,
+    /// Index of the enclosing block in [`BlockMap::blocks`]
+    pub parent: Option<usize>,
+    /// `{{ block.super }}` usages directly in this block, not in nested ones
+    pub super_count: usize,
+    /// False if the source ends first; the block then runs to the end
+    pub closed: bool,
+}
+
+/// A `{{ block.super }}` usage in the block at index `block`.
+#[derive(Clone, Debug, PartialEq, Eq)]
+pub struct BlockSuper {
+    pub block: usize,
+    pub range: std::ops::Range<usize>,
+}
+
+/// The blocks of a template, in the order their opening tags appear (so a block's parent
+/// always comes before it), and the `{{ block.super }}` usages in source order.
+#[derive(Clone, Debug, Default, PartialEq, Eq)]
+pub struct BlockMap<'a> {
+    pub blocks: Vec<Block<'a>>,
+    pub supers: Vec<BlockSuper>,
+}
+
+mod ffi {
+    #[repr(C)]
+    pub struct Block {
+        pub name: *const u8,
+        pub name_length: u32,
+        pub start_byte: u32,
+        pub end_byte: u32,
+        pub content_start_byte: u32,
+        pub content_end_byte: u32,
+        pub depth: u32,
+        pub parent: u32,
+        pub super_count: u32,
+        pub closed: bool,
+    }
+
+    #[repr(C)]
+    pub struct BlockSuper {
+        pub block: u32,
+        pub start_byte: u32,
+        pub end_byte: u32,
+    }
+
+    #[repr(C)]
+    pub struct BlockMap {
+        pub blocks: *mut Block,
+        pub block_count: u32,
+        pub supers: *mut BlockSuper,
+        pub super_count: u32,
+        pub block_capacity: u32,
+        pub super_capacity: u32,
+    }
+
+    extern "C" {
+        pub fn htmldjango_block_map_build(
+            map: *mut BlockMap,
+            source: *const u8,
+            length: u32,
+        ) -> bool;
+        pub fn htmldjango_block_map_delete(map: *mut BlockMap);
+        pub fn htmldjango_symbol_kinds(kinds: *mut u16, count: u32) -> u32;
+        pub fn htmldjango_field_ids(fields: *mut u16, count: u32) -> u32;
+    }
+}
+
+/// Finds the `{% block %}` tags and `{{ block.super }}` usages in a template, for resolving
+/// `{% extends %}` chains.
+///
+/// This is a native scan of the source rather than a tree walk, so it needs no parser. Tags
+/// inside comment and verbatim blocks are skipped, and an `{% endblock %}` closes the innermost
+/// open block whatever its name.
+///
+/// # Panics
+///
+/// Panics if `source` is 4 GiB or larger, or if memory runs out.
+pub fn block_map(source: &[u8]) -> BlockMap<'_> {
+    let length = u32::try_from(source.len()).expect("source is larger than 4 GiB");
+    let mut map = ffi::BlockMap {
+        blocks: std::ptr::null_mut(),
+        block_count: 0,
+        supers: std::ptr::null_mut(),
+        super_count: 0,
+        block_capacity: 0,
+        super_capacity: 0,
+    };
+    // SAFETY: the C side only reads `length` bytes of `source` and owns the arrays in `map`
+    // until they are freed below.
+    let ok = unsafe { ffi::htmldjango_block_map_build(&mut map, source.as_ptr(), length) };
+    let raw_blocks: &[ffi::Block] = if map.block_count == 0 {
+        &[]
+    } else {
+        unsafe { std::slice::from_raw_parts(map.blocks, map.block_count as usize) }
+    };
+    let raw_supers: &[ffi::BlockSuper] = if map.super_count == 0 {
+        &[]
+    } else {
+        unsafe { std::slice::from_raw_parts(map.supers, map.super_count as usize) }
+    };
+
+    let blocks = raw_blocks
+        .iter()
+        .map(|block| {
+            let start = block.name as usize - source.as_ptr() as usize;
+            let name = &source[start..start + block.name_length as usize];
+            Block {
+                // Block names match [a-zA-Z_][a-zA-Z0-9_]*, so they are always ASCII
+                name: std::str::from_utf8(name).unwrap(),
+                range: block.start_byte as usize..block.end_byte as usize,
+                content_range: block.content_start_byte as usize..block.content_end_byte as usize,
+                depth: block.depth as usize,
+                parent: (block.parent != u32::MAX).then_some(block.parent as usize),
+                super_count: block.super_count as usize,
+                closed: block.closed,
+            }
+        })
+        .collect();
+    let supers = raw_supers
+        .iter()
+        .map(|usage| BlockSuper {
+            block: usage.block as usize,
+            range: usage.start_byte as usize..usage.end_byte as usize,
+        })
+        .collect();
+    unsafe { ffi::htmldjango_block_map_delete(&mut map) };
+    assert!(ok, "out of memory");
+    BlockMap { blocks, supers }
+}
+
+/// Maps the parser's symbol and field IDs to the stable IDs of [`kinds`], so that a tree walk
+/// can match on integers instead of comparing [`Node::kind`] strings:
+///
+/// ```
+/// use tree_sitter_htmldjango::kinds::kind;
+///
+/// let mut parser = tree_sitter::Parser::new();
+/// parser.set_language(&tree_sitter_htmldjango::LANGUAGE.into()).unwrap();
+/// let tree = parser.parse("{% if a %}{% endif %}", None).unwrap();
+/// let kinds = tree_sitter_htmldjango::KindMap::new();
+/// let node = tree.root_node().child(0).unwrap();
+/// assert_eq!(kinds.kind(node.kind_id()), kind::DJANGO_IF_BLOCK);
+/// ```
+///
+/// The parser's IDs change whenever the grammar is regenerated; these only change when
+/// `node-types.json` does. Build the map once and keep it.
+///
+/// [`Node::kind`]: https://docs.rs/tree-sitter/*/tree_sitter/struct.Node.html#method.kind
+#[derive(Clone, Debug)]
+pub struct KindMap {
+    kinds: Vec<u16>,
+    fields: Vec<u16>,
+}
+
+impl KindMap {
+    pub fn new() -> Self {
+        // SAFETY: both functions write at most `count` entries
+        unsafe {
+            let mut kinds = vec![0; ffi::htmldjango_symbol_kinds(std::ptr::null_mut(), 0) as usize];
+            ffi::htmldjango_symbol_kinds(kinds.as_mut_ptr(), kinds.len() as u32);
+            let mut fields = vec![0; ffi::htmldjango_field_ids(std::ptr::null_mut(), 0) as usize];
+            ffi::htmldjango_field_ids(fields.as_mut_ptr(), fields.len() as u32);
+            Self { kinds, fields }
+        }
+    }
+
+    /// The [`kind`](kinds::kind) of a parser symbol, such as `Node::kind_id()` returns.
+    /// ERROR nodes, whose symbol is `u16::MAX`, are [`kind::ERROR`](kinds::kind::ERROR).
+    pub fn kind(&self, symbol: u16) -> u16 {
+        self.kinds
+            .get(symbol as usize)
+            .copied()
+            .unwrap_or(kinds::kind::ERROR)
+    }
+
+    /// The [`field`](kinds::field) of a parser field ID, such as `TreeCursor::field_id()`
+    /// returns.
+    pub fn field(&self, field_id: u16) -> u16 {
+        self.fields
+            .get(field_id as usize)
+            .copied()
+            .unwrap_or(kinds::field::NONE)
+    }
+}
+
+impl Default for KindMap {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
 #[cfg(test)]
 mod tests {
     #[test]
@@ -52,4 +300,67 @@ mod tests {
             .set_language(&super::LANGUAGE.into())
             .expect("Error loading HTMLDjango parser");
     }
+
+    #[test]
+    fn test_can_load_expression_grammar() {
+        let mut parser = tree_sitter::Parser::new();
+        parser
+            .set_language(&super::LANGUAGE_EXPRESSION.into())
+            .expect("Error loading HTMLDjango expression parser");
+        let tree = parser.parse("user.name|default:\"n/a\"", None).unwrap();
+        assert!(!tree.root_node().has_error());
+    }
+
+    #[test]
+    fn test_block_map() {
+        let source = b"{% block content %}{{ block.super }}{% block inner %}x{% endblock inner %}{% endblock %}";
+        let map = super::block_map(source);
+        let names: Vec<_> = map.blocks.iter().map(|block| block.name).collect();
+        assert_eq!(names, ["content", "inner"]);
+        assert_eq!(map.blocks[1].parent, Some(0));
+        assert_eq!(&source[map.blocks[1].content_range.clone()], b"x");
+        assert_eq!(map.blocks[0].range, 0..source.len());
+        assert_eq!(&source[map.supers[0].range.clone()], b"{{ block.super }}");
+    }
+
+    #[test]
+    fn test_kind_map() {
+        use super::kinds::{field, kind};
+
+        let mut parser = tree_sitter::Parser::new();
+        parser.set_language(&super::LANGUAGE.into()).unwrap();
+        let tree = parser
+            .parse("{% block content %}<p>{{ x }}</p>{% endblock %}", None)
+            .unwrap();
+        let map = super::KindMap::new();
+        let block = tree.root_node().child(0).unwrap();
+        assert_eq!(map.kind(block.kind_id()), kind::DJANGO_BLOCK_BLOCK);
+        let mut cursor = block.walk();
+        cursor.goto_first_child();
+        assert_eq!(map.kind(cursor.node().kind_id()), kind::DJANGO_BLOCK_OPEN);
+        assert_eq!(map.kind(u16::MAX), kind::ERROR);
+        for (symbol, name) in (0..tree.language().node_kind_count() as u16)
+            .filter_map(|id| Some((id, tree.language().node_kind_for_id(id)?)))
+        {
+            let stable = map.kind(symbol);
+            if stable != kind::ERROR {
+                assert_eq!(super::kinds::KIND_NAMES[stable as usize].0, name);
+            }
+        }
+        assert_eq!(map.field(0), field::NONE);
+    }
+
+    #[cfg(feature = "mmap")]
+    #[test]
+    fn test_parse_file() {
+        let path = std::env::temp_dir().join(format!("htmldjango-{}.html", std::process::id()));
+        std::fs::write(&path, "{% if user %}<p>{{ user.name }}</p>{% endif %}").unwrap();
+        let mut parser = tree_sitter::Parser::new();
+        parser.set_language(&super::LANGUAGE.into()).unwrap();
+        let tree = super::parse_file(&mut parser, &path, None)
+            .unwrap()
+            .unwrap();
+        std::fs::remove_file(&path).unwrap();
+        assert!(!tree.root_node().has_error());
+    }
 }
@@ -1,6 +1,9 @@
 #ifndef TREE_SITTER_HTMLDJANGO_H_
 #define TREE_SITTER_HTMLDJANGO_H_
 
+#include "../../c/tree-sitter-htmldjango-blocks.h"
+#include "../../c/tree-sitter-htmldjango-kinds.h"
+
 typedef struct TSLanguage TSLanguage;
 
 #ifdef __cplusplus
@@ -8,6 +11,7 @@ extern "C" {
 #endif
 
 const TSLanguage *tree_sitter_htmldjango(void);
+const TSLanguage *tree_sitter_htmldjango_expression(void);
 
 #ifdef __cplusplus
 }
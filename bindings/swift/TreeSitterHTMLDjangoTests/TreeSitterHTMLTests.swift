@@ -9,4 +9,11 @@ final class TreeSitterHTMLTests: XCTestCase {
         XCTAssertNoThrow(try parser.setLanguage(language),
                          "Error loading HTML grammar")
     }
+
+    func testCanLoadExpressionGrammar() throws {
+        let parser = Parser()
+        let language = Language(language: tree_sitter_htmldjango_expression())
+        XCTAssertNoThrow(try parser.setLanguage(language),
+                         "Error loading Django expression grammar")
+    }
 }
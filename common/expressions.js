@@ -0,0 +1,167 @@
+/**
+ * @file Django expression rules shared by the template and expression grammars
+ * @author Based on tree-sitter-html by Max Brunsfeld and tree-sitter-django
+ * @license MIT
+ */
+
+/// <reference types="tree-sitter-cli/dsl" />
+// @ts-check
+
+// Both grammars must declare `_filter_colon` as an external and `identifier`
+// as their word token.
+module.exports = {
+  // ==========================================================================
+  // Django: Expressions
+  // ==========================================================================
+
+  // Expressions only produce a node where they carry something: a plain
+  // `{{ user.name }}` is just a lookup, and filter_expression appears only
+  // when there is at least one filter.
+  _expression: $ => choice(
+    $._primary_expression,
+    $.filter_expression,
+  ),
+
+  filter_expression: $ => seq(
+    $._primary_expression,
+    repeat1(seq(alias($._filter_pipe, '|'), $.filter_call)),
+  ),
+
+  _filter_pipe: _ => token(prec(1, /[ \t]*\|/)),
+
+  _primary_expression: $ => choice(
+    $.literal,
+    $.lookup,
+  ),
+
+  literal: $ => choice(
+    $.string,
+    $.number,
+    $.i18n_string,
+  ),
+
+  lookup: $ => seq(
+    $.identifier,
+    repeat(seq('.', choice($.identifier, $.numeric_index))),
+  ),
+
+  numeric_index: _ => /\d+/,
+
+  filter_call: $ => prec.left(seq(
+    field('name', alias($.identifier, $.filter_name)),
+    optional(seq(
+      alias($._filter_colon, ':'),
+      field('argument', $.filter_argument),
+    )),
+  )),
+
+  filter_argument: $ => choice(
+    $.literal,
+    $.lookup,
+  ),
+
+  // ==========================================================================
+  // Django: Test Expressions (for {% if %})
+  // ==========================================================================
+
+  // As with _expression, each level is only wrapped in a node when its operator is
+  // present, so `{% if a %}` is (test_expression (lookup ...)). _or_operand is
+  // wrapped by test_expression in grammar.js and by the root expression node in
+  // expression/grammar.js.
+  _or_operand: $ => choice(
+    $.or_expression,
+    $._and_operand,
+  ),
+
+  or_expression: $ => prec.left(1, seq(
+    $._and_operand,
+    repeat1(seq($.or_keyword, $._and_operand)),
+  )),
+
+  or_keyword: _ => token(prec(10, 'or')),
+
+  _and_operand: $ => choice(
+    $.and_expression,
+    $._not_operand,
+  ),
+
+  and_expression: $ => prec.left(2, seq(
+    $._not_operand,
+    repeat1(seq($.and_keyword, $._not_operand)),
+  )),
+
+  and_keyword: _ => token(prec(10, 'and')),
+
+  _not_operand: $ => choice(
+    $.not_expression,
+    $.comparison_expression,
+    $._expression,
+  ),
+
+  not_expression: $ => prec(3, seq(token(prec(10, 'not')), $._not_operand)),
+
+  comparison_expression: $ => prec.left(4, seq(
+    $._expression,
+    repeat1(seq(
+      $.comparison_operator,
+      $._expression,
+    )),
+  )),
+
+  // Supertype for comparison operators - allows queries like (comparison_operator)
+  comparison_operator: $ => choice(
+    $.op_not_in,
+    $.op_is_not,
+    $.op_in,
+    $.op_is,
+    $.op_eq,
+    $.op_ne,
+    $.op_gte,
+    $.op_gt,
+    $.op_lte,
+    $.op_lt,
+  ),
+
+  // Individual comparison operators as named nodes
+  op_not_in: _ => token(prec(10, seq('not', /[ \t]+/, 'in'))),
+  op_is_not: _ => token(prec(10, seq('is', /[ \t]+/, 'not'))),
+  op_in: _ => token(prec(10, 'in')),
+  op_is: _ => token(prec(10, 'is')),
+  op_eq: _ => token(prec(10, '==')),
+  op_ne: _ => token(prec(10, '!=')),
+  op_gte: _ => token(prec(10, '>=')),
+  op_gt: _ => token(prec(10, '>')),
+  op_lte: _ => token(prec(10, '<=')),
+  op_lt: _ => token(prec(10, '<')),
+
+  // ==========================================================================
+  // Django: Tokens
+  // ==========================================================================
+
+  // Identifier that excludes Django keywords (and, or, not, in, is, as)
+  identifier: _ => token(prec(-1, /[a-zA-Z_][a-zA-Z0-9_]*/)),
+
+  number: _ => token(prec(1, seq(
+    optional(choice('+', '-')),
+    choice(
+      seq(/\d+\.\d+/, optional(seq(/[eE]/, optional(choice('+', '-')), /\d+/))),
+      seq(/\d+\./, /[eE]/, optional(choice('+', '-')), /\d+/),
+      seq(/\.\d+/, optional(seq(/[eE]/, optional(choice('+', '-')), /\d+/))),
+      seq(/\d+/, optional(seq(/[eE]/, optional(choice('+', '-')), /\d+/))),
+    ),
+  ))),
+
+  string: _ => choice(
+    seq("'", repeat(choice(/[^'\\]/, /\\./)), "'"),
+    seq('"', repeat(choice(/[^"\\]/, /\\./)), '"'),
+  ),
+
+  i18n_string: _ => token(seq(
+    '_(',
+    choice(
+      seq("'", repeat(choice(/[^'\\]/, /\\./)), "'"),
+      seq('"', repeat(choice(/[^"\\]/, /\\./)), '"'),
+    ),
+    ')',
+  )),
+};
@@ -0,0 +1,28 @@
+// Included after tree_sitter/parser.h by each grammar's scanner.c.
+
+// Filter colon - only match ':' if immediately followed by a valid argument char.
+// Django does not allow whitespace after the colon in filter arguments, so
+// `{{ value|default: "x" }}` is an error rather than an argument.
+//
+// The caller has already checked that the lookahead is ':'. Valid starts are:
+// - Quote chars for strings: " '
+// - Digits for numbers: 0-9
+// - Sign for numbers: + -
+// - Decimal point for numbers: .
+// - Letters/underscore for identifiers and i18n strings: a-z A-Z _
+static inline bool scan_filter_colon(TSLexer *lexer, TSSymbol symbol) {
+    lexer->mark_end(lexer);
+    lexer->advance(lexer, false);
+    int32_t next = lexer->lookahead;
+    if (next == '"' || next == '\'' ||
+        (next >= '0' && next <= '9') ||
+        next == '+' || next == '-' || next == '.' ||
+        (next >= 'a' && next <= 'z') ||
+        (next >= 'A' && next <= 'Z') ||
+        next == '_') {
+        lexer->mark_end(lexer);
+        lexer->result_symbol = symbol;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,39 @@
+/**
+ * @file Django template expressions for tree-sitter
+ * @author Based on tree-sitter-html by Max Brunsfeld and tree-sitter-django
+ * @license MIT
+ */
+
+/// <reference types="tree-sitter-cli/dsl" />
+// @ts-check
+
+const expressions = require('../common/expressions');
+
+// Parses the inside of `{{ ... }}` or `{% if ... %}` on its own, for tools that
+// pull expressions out of Python code or format_html() strings. The nodes are
+// the same as under django_interpolation and test_expression in the template
+// grammar, without the HTML and tag rules in the parse table.
+module.exports = grammar({
+  name: 'htmldjango_expression',
+
+  word: $ => $.identifier,
+
+  extras: _ => [
+    /\s+/,
+  ],
+
+  externals: $ => [
+    $._filter_colon,
+  ],
+
+  supertypes: $ => [
+    $.comparison_operator,
+    $.literal,
+  ],
+
+  rules: {
+    expression: $ => $._or_operand,
+
+    ...expressions,
+  },
+});
@@ -0,0 +1,38 @@
+#include "tree_sitter/parser.h"
+
+#include "../../common/scanner.h"
+
+enum TokenType {
+    FILTER_COLON,
+};
+
+// The expression grammar has no HTML or verbatim state, so the scanner is
+// stateless and only decides whether a ':' starts a filter argument.
+
+void *tree_sitter_htmldjango_expression_external_scanner_create() { return NULL; }
+
+bool tree_sitter_htmldjango_expression_external_scanner_scan(void *payload, TSLexer *lexer,
+                                                             const bool *valid_symbols) {
+    (void)payload;
+    if (valid_symbols[FILTER_COLON] && lexer->lookahead == ':') {
+        return scan_filter_colon(lexer, FILTER_COLON);
+    }
+    return false;
+}
+
+unsigned tree_sitter_htmldjango_expression_external_scanner_serialize(void *payload, char *buffer) {
+    (void)payload;
+    (void)buffer;
+    return 0;
+}
+
+void tree_sitter_htmldjango_expression_external_scanner_deserialize(void *payload, const char *buffer,
+                                                                    unsigned length) {
+    (void)payload;
+    (void)buffer;
+    (void)length;
+}
+
+void tree_sitter_htmldjango_expression_external_scanner_destroy(void *payload) {
+    (void)payload;
+}
@@ -7,6 +7,8 @@
 /// <reference types="tree-sitter-cli/dsl" />
 // @ts-check
 
+const expressions = require('./common/expressions');
+
 module.exports = grammar({
   name: 'htmldjango',
 
@@ -42,6 +44,10 @@ module.exports = grammar({
     $._validate_generic_block,
     $._validate_generic_simple,
     $._filter_colon,
+    $._attribute_block_end,
+    $._text_fragment,
+    $._single_quoted_attribute_value,
+    $._double_quoted_attribute_value,
   ],
 
   conflicts: $ => [
@@ -49,10 +55,6 @@ module.exports = grammar({
     [$.django_elif_branch],
     [$.django_else_branch],
     [$.django_empty_branch],
-    // Attribute-context Django block conflicts
-    [$.django_attribute_elif_branch],
-    [$.django_attribute_else_branch],
-    [$.django_attribute_empty_branch],
     // With legacy syntax: could continue with 'and' or end
     [$.with_legacy],
     // With assignments: ambiguity in repeat with optional whitespace
@@ -63,7 +65,7 @@ module.exports = grammar({
     [$.cycle_value, $.literal],
     // Unpaired tags vs normal elements
     [$.normal_element, $._start_tag_only],
-    // Tag argument can be filter_expression standalone or as part of as_alias
+    // Tag argument can be an expression standalone or as part of as_alias
     [$.tag_argument, $.as_alias],
   ],
 
@@ -138,7 +140,9 @@ module.exports = grammar({
       repeat($._attribute_node),
       choice('>', '/>'),
       repeat($._node),
-      choice($.end_tag, $._implicit_end_tag),
+      // An element closed by a parent's end tag, an implied close or EOF ends
+      // in a zero-width implicit_end_tag, so queries can find it structurally
+      choice($.end_tag, alias($._implicit_end_tag, $.implicit_end_tag)),
     ),
 
     // For unbalanced HTML tags inside Django conditionals
@@ -198,7 +202,7 @@ module.exports = grammar({
       field('name', alias($._foreign_start_tag_name, $.tag_name)),
       repeat($._attribute_node),
       choice(
-        seq('>', repeat($._node), choice($.end_tag, $._implicit_end_tag)),
+        seq('>', repeat($._node), choice($.end_tag, alias($._implicit_end_tag, $.implicit_end_tag))),
         '/>',
       ),
     ),
@@ -342,17 +346,17 @@ module.exports = grammar({
       alias($._unquoted_attr_value, $.attribute_value),  // Expose as named node
     ),
 
+    // Value runs are scanned externally and stop only at the closing quote, an entity or
+    // a Django opener, so long values such as data URIs stay a single attribute_value
     quoted_attribute_value: $ => choice(
       seq(
         "'",
         repeat(choice(
           $.entity,
-          alias(/[^'&\{]+/, $.attribute_value),
-          // { not starting Django: optionally followed by non-Django, non-quote char and more text
-          // The optional group allows lone { at end of attribute (before closing quote)
-          alias(token(prec(-1, /\{([^{%#'][^'&\{]*)?/)), $.attribute_value),
+          alias($._single_quoted_attribute_value, $.attribute_value),
           $.django_interpolation,
           $.django_statement,
+          $.django_line_comment,
         )),
         "'",
       ),
@@ -360,12 +364,10 @@ module.exports = grammar({
         '"',
         repeat(choice(
           $.entity,
-          alias(/[^"&\{]+/, $.attribute_value),
-          // { not starting Django: optionally followed by non-Django, non-quote char and more text
-          // The optional group allows lone { at end of attribute (before closing quote)
-          alias(token(prec(-1, /\{([^{%#"][^"&\{]*)?/)), $.attribute_value),
+          alias($._double_quoted_attribute_value, $.attribute_value),
           $.django_interpolation,
           $.django_statement,
+          $.django_line_comment,
         )),
         '"',
       ),
@@ -377,25 +379,22 @@ module.exports = grammar({
 
     entity: _ => /&(#x[0-9A-Fa-f]{1,6}|#[0-9]{1,7}|[A-Za-z][A-Za-z0-9]{1,31});/,
 
+    // Runs of text are scanned externally: a run ends only at <, a Django opener or an
+    // entity, so stray { > and & characters do not split it into separate leaves
     text: $ => prec.right(repeat1(choice(
       $.entity,
-      // Single brace that's not start of Django (lookahead simulation)
-      token(prec(-1, /\{/)),
-      // Greater-than sign can appear in text (after comments, etc.)
-      token(prec(-1, />/)),
-      // Regular text excluding HTML special chars and braces
-      token(/[^<>&\s\{][^<>&\{]*/),
+      $._text_fragment,
     ))),
 
     // ==========================================================================
     // Django: Interpolation ({{ expression }})
     // ==========================================================================
 
-    // filter_expression is required - Django rejects empty {{ }} with "Empty variable tag"
+    // An expression is required - Django rejects empty {{ }} with "Empty variable tag"
     django_interpolation: $ => seq(
       '{{',
       optional($._django_inner_ws),
-      $.filter_expression,
+      $._expression,
       optional($._django_inner_ws),
       '}}',
     ),
@@ -522,14 +521,17 @@ module.exports = grammar({
     // ==========================================================================
 
     // If block for attribute context - parses content as attribute_fragment instead of text
-    // Higher dynamic precedence to prefer this over regular django_if_block in attribute context
-    django_attribute_if_block: $ => prec.dynamic(10, seq(
+    // Branch ends are marked by the zero-width _attribute_block_end token, which the
+    // scanner only emits before {% elif/else/endif/empty/endfor %}. A {% after a branch
+    // body therefore always opens a nested block and the parser never has to fork.
+    django_attribute_if_block: $ => seq(
       $.django_if_open,
       field('body', repeat($._attribute_body_content)),
       repeat($.django_attribute_elif_branch),
       optional($.django_attribute_else_branch),
+      $._attribute_block_end,
       $.django_endif,
-    )),
+    ),
 
     _attribute_body_content: $ => choice(
       $.attribute,                     // UNIFIED - same as main context!
@@ -547,11 +549,13 @@ module.exports = grammar({
     ))),
 
     django_attribute_elif_branch: $ => seq(
+      $._attribute_block_end,
       $.django_elif,
       field('body', repeat($._attribute_body_content)),
     ),
 
     django_attribute_else_branch: $ => seq(
+      $._attribute_block_end,
       $.django_else,
       field('body', repeat($._attribute_body_content)),
     ),
@@ -560,14 +564,16 @@ module.exports = grammar({
     // Django: Attribute-Context For Block
     // ==========================================================================
 
-    django_attribute_for_block: $ => prec.dynamic(10, seq(
+    django_attribute_for_block: $ => seq(
       $.django_for_open,
       field('body', repeat($._attribute_body_content)),
       optional($.django_attribute_empty_branch),
+      $._attribute_block_end,
       $.django_endfor,
-    )),
+    ),
 
     django_attribute_empty_branch: $ => seq(
+      $._attribute_block_end,
       $.django_empty,
       field('body', repeat($._attribute_body_content)),
     ),
@@ -592,7 +598,7 @@ module.exports = grammar({
       $._django_inner_ws,
       'in',
       $._django_inner_ws,
-      field('iterable', $.filter_expression),
+      field('iterable', $._expression),
       optional(seq($._django_inner_ws, alias('reversed', $.reversed))),
       optional($._django_inner_ws),
       $._django_tag_close,
@@ -655,7 +661,7 @@ module.exports = grammar({
     ),
 
     with_legacy: $ => seq(
-      $.filter_expression,
+      $._expression,
       optional($._django_inner_ws),
       'as',
       optional($._django_inner_ws),
@@ -664,7 +670,7 @@ module.exports = grammar({
         optional($._django_inner_ws),
         'and',
         optional($._django_inner_ws),
-        $.filter_expression,
+        $._expression,
         optional($._django_inner_ws),
         'as',
         optional($._django_inner_ws),
@@ -717,7 +723,7 @@ module.exports = grammar({
       optional($._django_inner_ws),
       'extends',
       $._django_inner_ws,
-      field('template', $.filter_expression),
+      field('template', $._expression),
       optional($._django_inner_ws),
       $._django_tag_close,
     ),
@@ -727,7 +733,7 @@ module.exports = grammar({
       optional($._django_inner_ws),
       'include',
       $._django_inner_ws,
-      field('template', $.filter_expression),
+      field('template', $._expression),
       optional(choice(
         // with ... only
         seq(
@@ -779,10 +785,10 @@ module.exports = grammar({
       optional($._django_inner_ws),
       'url',
       $._django_inner_ws,
-      field('url_name', $.filter_expression),
+      field('url_name', $._expression),
       repeat(seq(
         $._django_inner_ws,
-        choice($.named_argument, $.filter_expression),
+        choice($.named_argument, $._expression),
       )),
       optional(seq($._django_inner_ws, 'as', $._django_inner_ws, field('alias', alias($.identifier, $.variable_name)))),
       optional($._django_inner_ws),
@@ -792,7 +798,7 @@ module.exports = grammar({
     named_argument: $ => prec.dynamic(1, seq(
       field('name', alias($.identifier, $.argument_name)),
       '=',
-      field('value', $.filter_expression),
+      field('value', $._expression),
     )),
 
     // ==========================================================================
@@ -909,7 +915,7 @@ module.exports = grammar({
       $._django_tag_close,
     ),
 
-    cycle_value: $ => choice($.string, $.filter_expression),
+    cycle_value: $ => choice($.string, $._expression),
 
     // ==========================================================================
     // Django: Firstof Tag
@@ -919,7 +925,7 @@ module.exports = grammar({
       $._django_tag_open,
       optional($._django_inner_ws),
       'firstof',
-      repeat1(seq($._django_inner_ws, $.filter_expression)),
+      repeat1(seq($._django_inner_ws, $._expression)),
       optional(seq($._django_inner_ws, 'as', $._django_inner_ws, field('alias', alias($.identifier, $.variable_name)))),
       optional($._django_inner_ws),
       $._django_tag_close,
@@ -949,7 +955,7 @@ module.exports = grammar({
       optional($._django_inner_ws),
       'regroup',
       $._django_inner_ws,
-      field('source', $.filter_expression),
+      field('source', $._expression),
       $._django_inner_ws,
       'by',
       $._django_inner_ws,
@@ -970,7 +976,7 @@ module.exports = grammar({
       $._django_tag_open,
       optional($._django_inner_ws),
       'ifchanged',
-      optional(repeat1(seq($._django_inner_ws, $.filter_expression))),
+      optional(repeat1(seq($._django_inner_ws, $._expression))),
       optional($._django_inner_ws),
       $._django_tag_close,
       repeat($._node),
@@ -998,11 +1004,11 @@ module.exports = grammar({
       optional($._django_inner_ws),
       'widthratio',
       $._django_inner_ws,
-      field('value', $.filter_expression),
+      field('value', $._expression),
       $._django_inner_ws,
-      field('max_value', $.filter_expression),
+      field('max_value', $._expression),
       $._django_inner_ws,
-      field('max_width', $.filter_expression),
+      field('max_width', $._expression),
       optional(seq($._django_inner_ws, 'as', $._django_inner_ws, field('alias', alias($.identifier, $.variable_name)))),
       optional($._django_inner_ws),
       $._django_tag_close,
@@ -1051,7 +1057,7 @@ module.exports = grammar({
       $._django_tag_open,
       optional($._django_inner_ws),
       'lorem',
-      optional(seq($._django_inner_ws, field('count', $.filter_expression))),
+      optional(seq($._django_inner_ws, field('count', $._expression))),
       optional(seq($._django_inner_ws, alias(choice('w', 'p', 'b'), $.method))),
       optional(seq($._django_inner_ws, alias('random', $.random))),
       optional($._django_inner_ws),
@@ -1079,7 +1085,7 @@ module.exports = grammar({
       $._django_tag_open,
       optional($._django_inner_ws),
       'querystring',
-      repeat(seq($._django_inner_ws, choice($.named_argument, $.filter_expression))),
+      repeat(seq($._django_inner_ws, choice($.named_argument, $._expression))),
       optional($._django_inner_ws),
       $._django_tag_close,
     ),
@@ -1153,11 +1159,11 @@ module.exports = grammar({
     tag_argument: $ => choice(
       $.assignment,
       $.as_alias,
-      $.filter_expression,
+      $._expression,
     ),
 
     as_alias: $ => seq(
-      field('value', $.filter_expression),
+      field('value', $._expression),
       $._django_inner_ws,
       'as',
       $._django_inner_ws,
@@ -1165,143 +1171,19 @@ module.exports = grammar({
     ),
 
     // ==========================================================================
-    // Django: Expressions
+    // Django: Expressions (shared with expression/grammar.js)
     // ==========================================================================
 
-    filter_expression: $ => seq(
-      $.primary_expression,
-      repeat(seq(alias($._filter_pipe, '|'), $.filter_call)),
-    ),
-
-    _filter_pipe: _ => token(prec(1, /[ \t]*\|/)),
-
-    primary_expression: $ => choice(
-      $.literal,
-      $.lookup,
-    ),
+    ...expressions,
 
-    literal: $ => choice(
-      $.string,
-      $.number,
-      $.i18n_string,
-    ),
-
-    lookup: $ => seq(
-      $.identifier,
-      repeat(seq('.', choice($.identifier, $.numeric_index))),
-    ),
-
-    numeric_index: _ => /\d+/,
-
-    filter_call: $ => prec.left(seq(
-      field('name', alias($.identifier, $.filter_name)),
-      optional(seq(
-        alias($._filter_colon, ':'),
-        field('argument', $.filter_argument),
-      )),
-    )),
-
-    filter_argument: $ => choice(
-      $.literal,
-      $.lookup,
-    ),
+    test_expression: $ => $._or_operand,
 
     assignment: $ => seq(
       field('name', alias($.identifier, $.variable_name)),
       '=',
-      field('value', $.filter_expression),
-    ),
-
-    // ==========================================================================
-    // Django: Test Expressions (for {% if %})
-    // ==========================================================================
-
-    test_expression: $ => $.or_expression,
-
-    or_expression: $ => prec.left(1, seq(
-      $.and_expression,
-      repeat(seq($.or_keyword, $.and_expression)),
-    )),
-
-    or_keyword: _ => token(prec(10, 'or')),
-
-    and_expression: $ => prec.left(2, seq(
-      $.not_expression,
-      repeat(seq($.and_keyword, $.not_expression)),
-    )),
-
-    and_keyword: _ => token(prec(10, 'and')),
-
-    not_expression: $ => choice(
-      prec(3, seq(token(prec(10, 'not')), $.not_expression)),
-      $.comparison_expression,
+      field('value', $._expression),
     ),
 
-    comparison_expression: $ => prec.left(4, seq(
-      $.filter_expression,
-      repeat(seq(
-        $.comparison_operator,
-        $.filter_expression,
-      )),
-    )),
-
-    // Supertype for comparison operators - allows queries like (comparison_operator)
-    comparison_operator: $ => choice(
-      $.op_not_in,
-      $.op_is_not,
-      $.op_in,
-      $.op_is,
-      $.op_eq,
-      $.op_ne,
-      $.op_gte,
-      $.op_gt,
-      $.op_lte,
-      $.op_lt,
-    ),
-
-    // Individual comparison operators as named nodes
-    op_not_in: _ => token(prec(10, seq('not', /[ \t]+/, 'in'))),
-    op_is_not: _ => token(prec(10, seq('is', /[ \t]+/, 'not'))),
-    op_in: _ => token(prec(10, 'in')),
-    op_is: _ => token(prec(10, 'is')),
-    op_eq: _ => token(prec(10, '==')),
-    op_ne: _ => token(prec(10, '!=')),
-    op_gte: _ => token(prec(10, '>=')),
-    op_gt: _ => token(prec(10, '>')),
-    op_lte: _ => token(prec(10, '<=')),
-    op_lt: _ => token(prec(10, '<')),
-
-    // ==========================================================================
-    // Django: Tokens
-    // ==========================================================================
-
-    // Identifier that excludes Django keywords (and, or, not, in, is, as)
-    identifier: _ => token(prec(-1, /[a-zA-Z_][a-zA-Z0-9_]*/)),
-
-    number: _ => token(prec(1, seq(
-      optional(choice('+', '-')),
-      choice(
-        seq(/\d+\.\d+/, optional(seq(/[eE]/, optional(choice('+', '-')), /\d+/))),
-        seq(/\d+\./, /[eE]/, optional(choice('+', '-')), /\d+/),
-        seq(/\.\d+/, optional(seq(/[eE]/, optional(choice('+', '-')), /\d+/))),
-        seq(/\d+/, optional(seq(/[eE]/, optional(choice('+', '-')), /\d+/))),
-      ),
-    ))),
-
-    string: _ => choice(
-      seq("'", repeat(choice(/[^'\\]/, /\\./)), "'"),
-      seq('"', repeat(choice(/[^"\\]/, /\\./)), '"'),
-    ),
-
-    i18n_string: _ => token(seq(
-      '_(',
-      choice(
-        seq("'", repeat(choice(/[^'\\]/, /\\./)), "'"),
-        seq('"', repeat(choice(/[^"\\]/, /\\./)), '"'),
-      ),
-      ')',
-    )),
-
     // ==========================================================================
     // Django: Tag delimiters (with optional whitespace trimming)
     // ==========================================================================
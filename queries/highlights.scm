@@ -1,14 +1,15 @@
+; Patterns that share a capture are grouped into one alternation, and nodes
+; are matched by type alone wherever their parent adds nothing, so the query
+; cursor has one pattern per capture name to try at each node.
+
 ; =============================================================================
-; HTML Highlighting
+; HTML
 ; =============================================================================
 
 (tag_name) @tag
 (erroneous_end_tag_name) @tag.error
 (doctype) @constant
-(doctype_keyword) @keyword
 (attribute_name) @attribute
-(attribute_value) @string
-(comment) @comment
 
 [
   "<"
@@ -17,9 +18,16 @@
   "/>"
 ] @punctuation.bracket
 
-"=" @punctuation.delimiter
+; =============================================================================
+; Comments
+; =============================================================================
 
-(entity) @string.special
+; The text inside a block comment is covered by the comment node itself
+[
+  (comment)
+  (django_line_comment)
+  (django_block_comment)
+] @comment
 
 ; =============================================================================
 ; Django Delimiters
@@ -36,16 +44,7 @@
 ] @tag.delimiter
 
 ; =============================================================================
-; Django Comments
-; =============================================================================
-
-(django_line_comment) @comment
-(django_block_comment) @comment
-(comment_content) @comment
-(comment_text) @comment
-
-; =============================================================================
-; Django Keywords - Control Flow
+; Django Keywords
 ; =============================================================================
 
 [
@@ -59,23 +58,21 @@
 ] @keyword.conditional
 
 [
+  ; HTML
+  (doctype_keyword)
+  ; Control flow and modifiers
   "in"
-] @keyword
-
-; Named optional keyword nodes
-[
+  "as"
+  "from"
+  "by"
+  "and"
   (reversed)
   (only)
   (silent)
   (random)
   (inline)
-] @keyword
-
-; =============================================================================
-; Django Keywords - Block Tags
-; =============================================================================
-
-[
+  (autoescape_value)
+  ; Block tags
   "block"
   "endblock"
   "extends"
@@ -95,13 +92,7 @@
   "endifchanged"
   "partialdef"
   "endpartialdef"
-] @keyword
-
-; =============================================================================
-; Django Keywords - Simple Tags
-; =============================================================================
-
-[
+  ; Simple tags
   "load"
   "url"
   "csrf_token"
@@ -118,112 +109,69 @@
   "partial"
 ] @keyword
 
-; =============================================================================
-; Django Keywords - Modifiers
-; =============================================================================
-
-[
-  "as"
-  "from"
-  "by"
-  "and"
-] @keyword
-
-(autoescape_value) @keyword
-
-; =============================================================================
-; Django Keywords - Templatetag Arguments
-; =============================================================================
-
-(templatetag_argument) @string.special
-
-; =============================================================================
-; Django Keywords - Lorem Methods
-; =============================================================================
-
-(method) @string.special
-
-; =============================================================================
-; Django Boolean Operators
-; =============================================================================
-
-(and_keyword) @keyword.operator
-(or_keyword) @keyword.operator
-
 [
+  (and_keyword)
+  (or_keyword)
   "not"
 ] @keyword.operator
 
-; =============================================================================
-; Django Comparison Operators
-; =============================================================================
-
 (comparison_operator) @operator
 
 ; =============================================================================
-; Django Identifiers and Variables
+; Django Identifiers and Names
 ; =============================================================================
 
-; Block names
-(block_name) @variable.parameter
-
-; Loop variables
-(variable_name) @variable.parameter
+[
+  (block_name)
+  (variable_name)
+  (argument_name)
+  (cycle_name)
+  (partial_name)
+] @variable.parameter
 
-; Generic identifiers (variables)
 (lookup
   (identifier) @variable)
 
-(lookup
-  (numeric_index) @number)
-
-; Named arguments
-(argument_name) @variable.parameter
-
-; Cycle names
-(cycle_name) @variable.parameter
-
-; Partial names
-(partial_name) @variable.parameter
-
-; =============================================================================
-; Django Filters
-; =============================================================================
-
-(filter_call
-  (filter_name) @function)
-
-(filter_chain
-  (filter_call
-    (filter_name) @function))
-
-; =============================================================================
-; Django Library Names (load tag)
-; =============================================================================
+; filter_name only occurs in filter_call, including inside filter_chain
+(filter_name) @function
 
 (library_name) @module
 
+[
+  (generic_tag_name)
+  (end_tag_name)
+] @function.macro
+
 ; =============================================================================
-; Django Generic Tag Names
+; Literals
 ; =============================================================================
 
-(generic_tag_name) @function.macro
-
-(end_tag_name) @function.macro
+[
+  (attribute_value)
+  (string)
+] @string
 
-; =============================================================================
-; Django Literals
-; =============================================================================
+[
+  (entity)
+  (templatetag_argument)
+  (method)
+  (i18n_string)
+] @string.special
 
-(string) @string
-(number) @number
-(i18n_string) @string.special
+; numeric_index only occurs in lookup
+[
+  (number)
+  (numeric_index)
+] @number
 
 ; =============================================================================
-; Django Punctuation
+; Punctuation
 ; =============================================================================
 
-"|" @punctuation.delimiter
-":" @punctuation.delimiter
-"." @punctuation.delimiter
-"," @punctuation.delimiter
+[
+  "="
+  "|"
+  ":"
+  "."
+  ","
+] @punctuation.delimiter
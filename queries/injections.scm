@@ -1,7 +1,77 @@
+; Script and style bodies are split into raw_text fragments around Django
+; tags. The fragments are combined on purpose: the Django tags are left out
+; and each pattern below yields one injected document per file, so a variable
+; declared in one <script> is known in the next, as it is in the browser.
+;
+; A script's type picks the language. JavaScript types, including module, get
+; javascript; JSON types get json, where splicing out the tags usually leaves
+; valid JSON and the parser accepts one value per script; markup templates
+; get html. Any other type (text/plain, a custom type, ...) gets no injection.
+
+; Classic scripts without a type attribute
+((script_element
+  (start_tag) @_start
+  (raw_text
+    (raw_text) @injection.content))
+ (#not-match? @_start "(?i)\\stype\\s*=")
+ (#set! injection.language "javascript")
+ (#set! injection.combined))
+
+; Scripts with an explicit JavaScript type, including modules
+((script_element
+  (start_tag
+    (attribute
+      (attribute_name) @_attribute
+      [
+        (attribute_value) @_type
+        (quoted_attribute_value
+          (attribute_value) @_type)
+      ]))
+  (raw_text
+    (raw_text) @injection.content))
+ (#eq? @_attribute "type")
+ (#match? @_type "(?i)^\\s*((text|application)/(x-)?(java|ecma)script|module)\\s*$")
+ (#set! injection.language "javascript")
+ (#set! injection.combined))
+
+; JSON data: application/json, +json types such as ld+json, import maps and
+; speculation rules
+((script_element
+  (start_tag
+    (attribute
+      (attribute_name) @_attribute
+      [
+        (attribute_value) @_type
+        (quoted_attribute_value
+          (attribute_value) @_type)
+      ]))
+  (raw_text
+    (raw_text) @injection.content))
+ (#eq? @_attribute "type")
+ (#match? @_type "(?i)^\\s*(application/([a-z0-9.-]+\\+)?json|importmap|speculationrules)\\s*$")
+ (#set! injection.language "json")
+ (#set! injection.combined))
+
+; Client-side markup templates: text/template, text/x-template,
+; text/x-handlebars-template, text/html, ...
 ((script_element
-  (raw_text) @injection.content)
- (#set! injection.language "javascript"))
+  (start_tag
+    (attribute
+      (attribute_name) @_attribute
+      [
+        (attribute_value) @_type
+        (quoted_attribute_value
+          (attribute_value) @_type)
+      ]))
+  (raw_text
+    (raw_text) @injection.content))
+ (#eq? @_attribute "type")
+ (#match? @_type "(?i)^\\s*text/(html|(x-)?[a-z-]*template)\\s*$")
+ (#set! injection.language "html")
+ (#set! injection.combined))
 
 ((style_element
-  (raw_text) @injection.content)
- (#set! injection.language "css"))
+  (raw_text
+    (raw_text) @injection.content))
+ (#set! injection.language "css")
+ (#set! injection.combined))
@@ -0,0 +1,39 @@
+; Django pushes a new context for the body of for, with and block tags, so a
+; name defined inside one of them is gone after its end tag. A for loop inside
+; a start tag is a scope of its own, ending at the tag's endfor. The iterable
+; of a for loop is read before the loop variables are bound, but it sits
+; inside the loop's node all the same.
+[
+  (document)
+  (django_for_block)
+  (django_attribute_for_block)
+  (django_with_block)
+  (django_block_block)
+] @local.scope
+
+; Definitions: loop variables, with assignments (including the legacy
+; "value as name" form) and every "as name" alias, which url, cycle, firstof,
+; now, regroup, widthratio and generic tags all expose as an alias field.
+; Loop variables sit in django_for_open, which both kinds of for loop share.
+; Assignments inside include and generic tags are passed on, not bound here.
+(loop_variables
+  (variable_name) @local.definition)
+
+(with_assignments
+  (assignment
+    name: (variable_name) @local.definition))
+
+(with_legacy
+  (variable_name) @local.definition)
+
+(_
+  alias: (variable_name) @local.definition)
+
+; References: the first segment of a lookup is the only one that names a
+; variable; the rest are attributes or keys. A named cycle refers back to the
+; alias of an earlier cycle tag.
+(lookup
+  .
+  (identifier) @local.reference)
+
+(cycle_name) @local.reference
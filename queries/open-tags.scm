@@ -1,6 +1,10 @@
-; Capture HTML normal elements that lack an explicit end tag.
-; We check that the last child of the element is not an end_tag node;
-; elements closed implicitly (including at EOF) will match.
-((normal_element
-  (tag_name) @open) @unclosed
- (#not-match? @unclosed "</[^<]*>$"))
+; Capture HTML elements that lack an explicit end tag.
+; Elements closed implicitly (by a parent's end tag, an implied close or EOF)
+; end in a zero-width implicit_end_tag node.
+(normal_element
+  (tag_name) @open
+  (implicit_end_tag)) @unclosed
+
+(foreign_element
+  (tag_name) @open
+  (implicit_end_tag)) @unclosed
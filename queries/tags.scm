@@ -0,0 +1,33 @@
+; Definitions: blocks that child templates override, and partials
+(django_block_block
+  (django_block_open
+    name: (block_name) @name)) @definition.block
+
+(django_partialdef_block
+  name: (partial_name) @name) @definition.partial
+
+; References: templates, partials, URL names and tag libraries. Template and
+; URL names are captured as string literals, quotes included; a name held in
+; a variable cannot be resolved statically and is skipped.
+(django_extends_tag
+  template: (string) @name) @reference.template
+
+(django_include_tag
+  template: (string) @name) @reference.template
+
+(django_partial_tag
+  name: (partial_name) @name) @reference.partial
+
+(django_url_tag
+  url_name: (string) @name) @reference.url
+
+; {% load a b %} loads whole libraries. In {% load a b from lib %} only lib
+; is a library; a and b are tags and filters from it.
+((django_load_tag
+  (library_name) @name) @reference.library
+ (#not-match? @reference.library "\\sfrom\\s"))
+
+(django_load_tag
+  "from"
+  .
+  (library_name) @name) @reference.library
@@ -1,8 +1,12 @@
+from os import environ
 from os.path import isdir, join
 from platform import system
+from subprocess import CalledProcessError, check_output
 
 from setuptools import Extension, find_packages, setup
 from setuptools.command.build import build
+from setuptools.command.build_ext import build_ext
+from setuptools.errors import SetupError
 from wheel.bdist_wheel import bdist_wheel
 
 
@@ -14,6 +18,31 @@ class Build(build):
         super().run()
 
 
+class BuildExt(build_ext):
+    """_batch parses on native threads, so unlike _binding it links the
+    tree-sitter runtime, found through pkg-config. Without it the build
+    fails rather than ship a parse_batch() that only raises;
+    TREE_SITTER_HTMLDJANGO_BATCH=0 leaves _batch out on purpose."""
+
+    def run(self):
+        batch = [ext for ext in self.extensions if ext.name == "_batch"]
+        if batch and environ.get("TREE_SITTER_HTMLDJANGO_BATCH") == "0":
+            self.extensions = [ext for ext in self.extensions if ext.name != "_batch"]
+        elif batch:
+            try:
+                include_flags = check_output(["pkg-config", "--cflags-only-I", "tree-sitter"], text=True).split()
+                library_flags = check_output(["pkg-config", "--libs", "tree-sitter"], text=True).split()
+            except (OSError, CalledProcessError) as error:
+                raise SetupError(
+                    "the _batch extension needs the tree-sitter library, and pkg-config could not find it. "
+                    "Install it (e.g. make install in a tree-sitter checkout) or set PKG_CONFIG_PATH, or set "
+                    "TREE_SITTER_HTMLDJANGO_BATCH=0 to build without parse_batch()."
+                ) from error
+            batch[0].include_dirs += [flag[2:] for flag in include_flags]
+            batch[0].extra_link_args = library_flags + batch[0].extra_link_args
+        super().run()
+
+
 class BdistWheel(bdist_wheel):
     def get_tag(self):
         python, abi, platform = super().get_tag()
@@ -22,6 +51,40 @@ class BdistWheel(bdist_wheel):
         return python, abi, platform
 
 
+def batch_extensions():
+    """_batch is not built on Windows, where the tools library does not
+    build. BuildExt adds the tree-sitter runtime flags."""
+    if system() == "Windows":
+        return []
+    return [
+        Extension(
+            name="_batch",
+            sources=[
+                "bindings/python/tree_sitter_htmldjango/batch.c",
+                "src/parser.c",
+                "src/scanner.c",
+                "expression/src/parser.c",
+                "expression/src/scanner.c",
+                "tools/batch.c",
+                "tools/cst_writer.c",
+                "tools/dependencies.c",
+                "tools/kinds.c",
+                "tools/node_kinds.c",
+            ],
+            extra_compile_args=["-std=c11", "-fvisibility=hidden"],
+            extra_link_args=["-pthread"],
+            define_macros=[
+                ("Py_LIMITED_API", "0x030D0000"),
+                ("PY_SSIZE_T_CLEAN", None),
+                ("TREE_SITTER_HIDE_SYMBOLS", None),
+                ("_POSIX_C_SOURCE", "200809L"),
+            ],
+            include_dirs=["src", "bindings/c", "tools"],
+            py_limited_api=True,
+        )
+    ]
+
+
 setup(
     packages=find_packages("bindings/python"),
     package_dir={"": "bindings/python"},
@@ -37,6 +100,10 @@ setup(
                 "bindings/python/tree_sitter_htmldjango/binding.c",
                 "src/parser.c",
                 "src/scanner.c",
+                "expression/src/parser.c",
+                "expression/src/scanner.c",
+                "tools/blocks.c",
+                "tools/kinds.c",
             ],
             extra_compile_args=[
                 "-std=c11",
@@ -50,12 +117,13 @@ setup(
                 ("PY_SSIZE_T_CLEAN", None),
                 ("TREE_SITTER_HIDE_SYMBOLS", None),
             ],
-            include_dirs=["src"],
+            include_dirs=["src", "bindings/c"],
             py_limited_api=True,
         )
-    ],
+    ] + batch_extensions(),
     cmdclass={
         "build": Build,
+        "build_ext": BuildExt,
         "bdist_wheel": BdistWheel
     },
     zip_safe=False
@@ -1,6 +1,8 @@
 #include "tag.h"
 #include "tree_sitter/parser.h"
 
+#include "../common/scanner.h"
+
 #include <wctype.h>
 
 enum TokenType {
@@ -28,6 +30,10 @@ enum TokenType {
     VALIDATE_GENERIC_BLOCK,
     VALIDATE_GENERIC_SIMPLE,
     FILTER_COLON,
+    ATTRIBUTE_BLOCK_END,
+    TEXT_FRAGMENT,
+    SINGLE_QUOTED_ATTRIBUTE_VALUE,
+    DOUBLE_QUOTED_ATTRIBUTE_VALUE,
 };
 
 typedef enum {
@@ -353,6 +359,179 @@ static bool scan_validate_generic_tag(TSLexer *lexer, const bool *valid_symbols)
     return false;
 }
 
+// Tags that close a branch of an attribute-context if/for block
+static const char *ATTRIBUTE_BLOCK_END_TAGS[] = {"elif", "else", "endif", "empty", "endfor", NULL};
+
+// Zero-width token emitted in front of {% elif/else/endif/empty/endfor %} inside
+// an attribute-context block. Without it the parser cannot tell at {% whether a
+// branch body ends or a nested block begins, and has to fork.
+static bool scan_attribute_block_end(TSLexer *lexer) {
+    lexer->mark_end(lexer);
+    advance(lexer);
+    if (lexer->lookahead != '%') {
+        return false;
+    }
+    advance(lexer);
+    skip_horizontal_space(lexer);
+
+    char tag_name[8];
+    int tag_len = 0;
+    while ((iswalnum(lexer->lookahead) || lexer->lookahead == '_') && tag_len < 7) {
+        tag_name[tag_len++] = (char)lexer->lookahead;
+        advance(lexer);
+    }
+    tag_name[tag_len] = '\0';
+    if (iswalnum(lexer->lookahead) || lexer->lookahead == '_') {
+        return false;
+    }
+
+    for (const char **p = ATTRIBUTE_BLOCK_END_TAGS; *p != NULL; p++) {
+        if (strcmp(tag_name, *p) == 0) {
+            lexer->result_symbol = ATTRIBUTE_BLOCK_END;
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline bool is_ascii_alpha(int32_t c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+// Checks for a character reference matching the grammar's entity rule:
+// &#x1F; &#123; or &name; The lexer is left wherever the match stopped,
+// which is always on a character that may continue a text run.
+static bool scan_entity_ahead(TSLexer *lexer) {
+    advance(lexer);
+    unsigned length = 0;
+    if (lexer->lookahead == '#') {
+        advance(lexer);
+        if (lexer->lookahead == 'x') {
+            advance(lexer);
+            while (iswxdigit(lexer->lookahead) && length < 7) {
+                advance(lexer);
+                length++;
+            }
+            return length >= 1 && length <= 6 && lexer->lookahead == ';';
+        }
+        while (iswdigit(lexer->lookahead) && length < 8) {
+            advance(lexer);
+            length++;
+        }
+        return length >= 1 && length <= 7 && lexer->lookahead == ';';
+    }
+    if (!is_ascii_alpha(lexer->lookahead)) {
+        return false;
+    }
+    while ((is_ascii_alpha(lexer->lookahead) || iswdigit(lexer->lookahead)) && length < 33) {
+        advance(lexer);
+        length++;
+    }
+    return length >= 2 && length <= 32 && lexer->lookahead == ';';
+}
+
+// Whether a {# just consumed starts a line comment, i.e. is closed by #}
+// before the end of the line
+static bool scan_line_comment_ahead(TSLexer *lexer) {
+    advance(lexer);
+    while (lexer->lookahead != '\n' && lexer->lookahead != '\r' && !lexer->eof(lexer)) {
+        if (lexer->lookahead == '#') {
+            advance(lexer);
+            if (lexer->lookahead == '}') return true;
+        } else {
+            advance(lexer);
+        }
+    }
+    return false;
+}
+
+// One maximal run of text content. The run stops only at <, at {{, {% and
+// {#, and at a valid entity, so stray braces, > and bare & stay inside a
+// single leaf. Whether a {# closes on its line is only known after reading
+// past it, when the run can no longer end before the brace, so every {#
+// ends the run. A run that starts at a {# that does not close is the brace
+// alone, and the next run continues from the #.
+static bool scan_text_fragment(TSLexer *lexer) {
+    bool has_text = false;
+    while (!lexer->eof(lexer)) {
+        switch (lexer->lookahead) {
+            case '<':
+                lexer->mark_end(lexer);
+                lexer->result_symbol = TEXT_FRAGMENT;
+                return has_text;
+
+            case '&':
+                lexer->mark_end(lexer);
+                if (scan_entity_ahead(lexer)) {
+                    lexer->result_symbol = TEXT_FRAGMENT;
+                    return has_text;
+                }
+                has_text = true;
+                break;
+
+            case '{':
+                lexer->mark_end(lexer);
+                advance(lexer);
+                if (lexer->lookahead == '{' || lexer->lookahead == '%') {
+                    lexer->result_symbol = TEXT_FRAGMENT;
+                    return has_text;
+                }
+                if (lexer->lookahead == '#') {
+                    lexer->result_symbol = TEXT_FRAGMENT;
+                    if (has_text) return true;
+                    lexer->mark_end(lexer);
+                    return !scan_line_comment_ahead(lexer);
+                }
+                has_text = true;
+                break;
+
+            default:
+                advance(lexer);
+                has_text = true;
+                break;
+        }
+    }
+    lexer->mark_end(lexer);
+    lexer->result_symbol = TEXT_FRAGMENT;
+    return has_text;
+}
+
+// One run of a quoted attribute value. Like a text fragment, the run stops
+// only at the closing quote, a valid entity or a Django opener, so data URIs,
+// SVG paths and long Alpine/HTMX expressions stay a single leaf.
+static bool scan_quoted_attribute_value(TSLexer *lexer, int32_t quote, enum TokenType symbol) {
+    bool has_text = false;
+    lexer->result_symbol = symbol;
+    while (!lexer->eof(lexer) && lexer->lookahead != quote) {
+        switch (lexer->lookahead) {
+            case '&':
+                lexer->mark_end(lexer);
+                if (scan_entity_ahead(lexer)) return has_text;
+                has_text = true;
+                break;
+
+            case '{':
+                lexer->mark_end(lexer);
+                advance(lexer);
+                if (lexer->lookahead == '{' || lexer->lookahead == '%') return has_text;
+                if (lexer->lookahead == '#') {
+                    if (has_text) return true;
+                    lexer->mark_end(lexer);
+                    return !scan_line_comment_ahead(lexer);
+                }
+                has_text = true;
+                break;
+
+            default:
+                advance(lexer);
+                has_text = true;
+                break;
+        }
+    }
+    lexer->mark_end(lexer);
+    return has_text;
+}
+
 static unsigned serialize(Scanner *scanner, char *buffer) {
     uint16_t tag_count = scanner->tags.size > UINT16_MAX ? UINT16_MAX : scanner->tags.size;
     uint16_t serialized_tag_count = 0;
@@ -673,10 +852,10 @@ static bool scan_raw_text(Scanner *scanner, TSLexer *lexer) {
                 // Stop here, let grammar handle Django
                 break;
             }
-            // Single brace, continue as content
+            // Single brace, continue as content. The next character is
+            // left for the loop, since it may start </script or another {
             delimiter_index = 0;
             has_content = true;
-            advance(lexer);
             lexer->mark_end(lexer);
         }
         else {
@@ -1050,30 +1229,9 @@ static bool scan(Scanner *scanner, TSLexer *lexer, const bool *valid_symbols) {
         return scan_validate_generic_tag(lexer, valid_symbols);
     }
 
-    // Handle filter colon - only match ':' if immediately followed by valid argument char
-    // Django does not allow whitespace after the colon in filter arguments
+    // Handle filter colon (shared with the expression grammar)
     if (valid_symbols[FILTER_COLON] && lexer->lookahead == ':') {
-        lexer->mark_end(lexer);
-        advance(lexer);
-        // Check if next char is valid start of filter argument:
-        // - Quote chars for strings: " '
-        // - Digits for numbers: 0-9
-        // - Sign for numbers: + -
-        // - Decimal point for numbers: .
-        // - Letters/underscore for identifiers and i18n strings: a-z A-Z _
-        int32_t next = lexer->lookahead;
-        if (next == '"' || next == '\'' ||
-            (next >= '0' && next <= '9') ||
-            next == '+' || next == '-' || next == '.' ||
-            (next >= 'a' && next <= 'z') ||
-            (next >= 'A' && next <= 'Z') ||
-            next == '_') {
-            lexer->mark_end(lexer);
-            lexer->result_symbol = FILTER_COLON;
-            return true;
-        }
-        // Not followed by valid argument char - don't match
-        return false;
+        return scan_filter_colon(lexer, FILTER_COLON);
     }
 
     bool valid_start_tag =
@@ -1100,10 +1258,22 @@ static bool scan(Scanner *scanner, TSLexer *lexer, const bool *valid_symbols) {
         return scan_plaintext_text(scanner, lexer);
     }
 
+    // Before the whitespace skip: spaces inside quotes belong to the value
+    if (valid_symbols[SINGLE_QUOTED_ATTRIBUTE_VALUE] != valid_symbols[DOUBLE_QUOTED_ATTRIBUTE_VALUE]) {
+        return valid_symbols[SINGLE_QUOTED_ATTRIBUTE_VALUE]
+                   ? scan_quoted_attribute_value(lexer, '\'', SINGLE_QUOTED_ATTRIBUTE_VALUE)
+                   : scan_quoted_attribute_value(lexer, '"', DOUBLE_QUOTED_ATTRIBUTE_VALUE);
+    }
+
     while (iswspace(lexer->lookahead)) {
         skip(lexer);
     }
 
+    if (valid_symbols[TEXT_FRAGMENT] && !valid_start_tag && !valid_end_tag &&
+        lexer->lookahead != '<' && !lexer->eof(lexer)) {
+        return scan_text_fragment(lexer);
+    }
+
     switch (lexer->lookahead) {
         case '<':
             lexer->mark_end(lexer);
@@ -1131,6 +1301,16 @@ static bool scan(Scanner *scanner, TSLexer *lexer, const bool *valid_symbols) {
             }
             break;
 
+        case '{':
+            // A branch end is only valid inside an attribute, where no tag name
+            // is. When it does not match, {{, {% and {# are left to the
+            // internal lexer.
+            if (valid_symbols[ATTRIBUTE_BLOCK_END] && !valid_start_tag && !valid_end_tag &&
+                scan_attribute_block_end(lexer)) {
+                return true;
+            }
+            // fall through
+
         default:
             if ((valid_start_tag || valid_end_tag) && !valid_symbols[RAW_TEXT]) {
                 return valid_end_tag ? scan_end_tag_name(scanner, lexer)
@@ -0,0 +1,196 @@
+#include "tree-sitter-htmldjango-tools.h"
+#include "tree-sitter-htmldjango.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+// Each worker owns a parser for the whole batch, so the language is set and
+// the external scanner allocated once per thread rather than once per file,
+// and a read buffer that only grows.
+
+typedef struct Batch Batch;
+
+typedef struct {
+    pthread_mutex_t lock;
+    size_t next;
+    size_t end;
+    unsigned index;
+    Batch *batch;
+    TSParser *parser;
+    char *buffer;
+    size_t capacity;
+    long read_errors;
+} Worker;
+
+struct Batch {
+    const HTMLDjangoInput *inputs;
+    const HTMLDjangoBatchOptions *options;
+    Worker *workers;
+    unsigned worker_count;
+};
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+unsigned htmldjango_batch_threads(const HTMLDjangoBatchOptions *options) {
+    if (options && options->threads) return options->threads;
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    return online > 0 ? (unsigned)online : 1;
+}
+
+static int read_file(Worker *worker, const char *path, uint32_t *length) {
+    FILE *file = fopen(path, "rb");
+    if (!file) return errno;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (size < 0 || (unsigned long)size > UINT32_MAX) {
+        fclose(file);
+        return EFBIG;
+    }
+    if ((size_t)size > worker->capacity) {
+        char *buffer = realloc(worker->buffer, (size_t)size);
+        if (!buffer) {
+            fclose(file);
+            return ENOMEM;
+        }
+        worker->buffer = buffer;
+        worker->capacity = (size_t)size;
+    }
+    *length = (uint32_t)fread(worker->buffer, 1, (size_t)size, file);
+    int error = ferror(file) ? EIO : 0;
+    fclose(file);
+    return error;
+}
+
+static void parse_input(Worker *worker, size_t index) {
+    const HTMLDjangoInput *input = &worker->batch->inputs[index];
+    const HTMLDjangoBatchOptions *options = worker->batch->options;
+    HTMLDjangoSummary summary = {0};
+    const char *source = input->source;
+    uint32_t length = input->length;
+    TSTree *tree = NULL;
+
+    if (!source) {
+        summary.read_error = input->path ? read_file(worker, input->path, &length) : EINVAL;
+        source = worker->buffer ? worker->buffer : "";
+    }
+    if (summary.read_error) {
+        worker->read_errors++;
+    } else {
+        double start = now();
+        tree = ts_parser_parse_string(worker->parser, NULL, source, length);
+        summary.parse_seconds = now() - start;
+        TSNode root = ts_tree_root_node(tree);
+        summary.bytes = length;
+        summary.source = source;
+        summary.node_count = ts_node_descendant_count(root);
+        summary.has_error = ts_node_has_error(root);
+    }
+
+    bool kept = options->callback &&
+                options->callback(options->payload, worker->index, index, tree, &summary);
+    if (!kept && tree) ts_tree_delete(tree);
+}
+
+static bool take_own(Worker *worker, size_t *index) {
+    pthread_mutex_lock(&worker->lock);
+    bool found = worker->next < worker->end;
+    if (found) *index = worker->next++;
+    pthread_mutex_unlock(&worker->lock);
+    return found;
+}
+
+// Moves the back half of another worker's remaining range to this worker.
+// Work only ever moves between workers, so when every range is found empty
+// anything still unparsed belongs to a worker that is still running.
+static bool steal(Worker *worker) {
+    Batch *batch = worker->batch;
+    for (unsigned i = 1; i < batch->worker_count; i++) {
+        Worker *victim = &batch->workers[(worker->index + i) % batch->worker_count];
+        pthread_mutex_lock(&victim->lock);
+        size_t remaining = victim->end - victim->next;
+        size_t taken = (remaining + 1) / 2;
+        victim->end -= taken;
+        size_t start = victim->end;
+        pthread_mutex_unlock(&victim->lock);
+        if (!taken) continue;
+
+        pthread_mutex_lock(&worker->lock);
+        worker->next = start;
+        worker->end = start + taken;
+        pthread_mutex_unlock(&worker->lock);
+        return true;
+    }
+    return false;
+}
+
+static void *run_worker(void *argument) {
+    Worker *worker = argument;
+    size_t index;
+    do {
+        while (take_own(worker, &index)) parse_input(worker, index);
+    } while (steal(worker));
+    return NULL;
+}
+
+long htmldjango_parse_batch(const HTMLDjangoInput *inputs, size_t count,
+                            const HTMLDjangoBatchOptions *options) {
+    HTMLDjangoBatchOptions defaults = {0};
+    if (!options) options = &defaults;
+    unsigned worker_count = htmldjango_batch_threads(options);
+    if (worker_count > count) worker_count = count ? (unsigned)count : 1;
+
+    Batch batch = {.inputs = inputs, .options = options, .worker_count = worker_count};
+    batch.workers = calloc(worker_count, sizeof(Worker));
+    pthread_t *threads = calloc(worker_count, sizeof(pthread_t));
+    if (!batch.workers || !threads) {
+        free(batch.workers);
+        free(threads);
+        return -1;
+    }
+
+    const TSLanguage *language = tree_sitter_htmldjango();
+    for (unsigned i = 0; i < worker_count; i++) {
+        Worker *worker = &batch.workers[i];
+        pthread_mutex_init(&worker->lock, NULL);
+        worker->next = count * i / worker_count;
+        worker->end = count * (i + 1) / worker_count;
+        worker->index = i;
+        worker->batch = &batch;
+        worker->parser = ts_parser_new();
+        ts_parser_set_language(worker->parser, language);
+    }
+
+    // Worker 0 runs on the calling thread. A worker whose thread cannot be
+    // started keeps its range, which the others then steal.
+    unsigned started = 1;
+    for (unsigned i = 1; i < worker_count; i++) {
+        if (pthread_create(&threads[i], NULL, run_worker, &batch.workers[i]) == 0) {
+            started = i + 1;
+        } else {
+            break;
+        }
+    }
+    run_worker(&batch.workers[0]);
+    for (unsigned i = 1; i < started; i++) pthread_join(threads[i], NULL);
+
+    long read_errors = 0;
+    for (unsigned i = 0; i < worker_count; i++) {
+        Worker *worker = &batch.workers[i];
+        read_errors += worker->read_errors;
+        ts_parser_delete(worker->parser);
+        free(worker->buffer);
+        pthread_mutex_destroy(&worker->lock);
+    }
+    free(batch.workers);
+    free(threads);
+    return read_errors;
+}
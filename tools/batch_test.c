@@ -0,0 +1,172 @@
+// Tests for batch parsing. Exits non-zero if any check fails.
+
+#include "tree-sitter-htmldjango-tools.h"
+
+#include <errno.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                                                               \
+    do {                                                                                                               \
+        if (!(condition)) {                                                                                            \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);                              \
+            failures++;                                                                                                \
+        }                                                                                                              \
+    } while (0)
+
+#define INPUT_COUNT 64
+
+// What the callbacks saw. Calls run concurrently, so every field is either
+// atomic or only written for the callback's own index.
+typedef struct {
+    const HTMLDjangoInput *inputs;
+    unsigned threads;
+    atomic_uint calls[INPUT_COUNT];
+    atomic_uint total;
+    atomic_uint bad_worker;
+    atomic_uint mismatched;
+    atomic_size_t order[INPUT_COUNT];
+    int read_errors[INPUT_COUNT];
+    bool had_tree[INPUT_COUNT];
+    bool keep;
+    TSTree *kept[INPUT_COUNT];
+} Record;
+
+static bool on_tree(void *payload, unsigned worker, size_t index, TSTree *tree, const HTMLDjangoSummary *summary) {
+    Record *record = payload;
+    const HTMLDjangoInput *input = &record->inputs[index];
+    unsigned call = atomic_fetch_add(&record->total, 1);
+    if (call < INPUT_COUNT) atomic_store(&record->order[call], index);
+    atomic_fetch_add(&record->calls[index], 1);
+    if (worker >= record->threads) atomic_fetch_add(&record->bad_worker, 1);
+
+    record->read_errors[index] = summary->read_error;
+    record->had_tree[index] = tree != NULL;
+    if (input->source && (summary->source != input->source || summary->bytes != input->length ||
+                          summary->node_count == 0 || tree == NULL)) {
+        atomic_fetch_add(&record->mismatched, 1);
+    }
+    if (record->keep && tree) {
+        record->kept[index] = tree;
+        return true;
+    }
+    return false;
+}
+
+// Sources of different lengths, so a summary handed to the wrong index shows
+static char sources[INPUT_COUNT][64];
+
+static void make_inputs(HTMLDjangoInput *inputs, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        int length = snprintf(sources[i], sizeof(sources[i]), "<p>{{ item_%zu }}%.*s</p>", i, (int)(i % 16),
+                              "................");
+        inputs[i] = (HTMLDjangoInput){.source = sources[i], .length = (uint32_t)length};
+    }
+}
+
+static long run(Record *record, const HTMLDjangoInput *inputs, size_t count, unsigned threads) {
+    memset(record, 0, sizeof(*record));
+    record->inputs = inputs;
+    HTMLDjangoBatchOptions options = {.threads = threads, .callback = on_tree, .payload = record};
+    record->threads = htmldjango_batch_threads(&options);
+    if (record->threads > count) record->threads = count ? (unsigned)count : 1;
+    return htmldjango_parse_batch(inputs, count, &options);
+}
+
+// Each input reaches the callback exactly once, with its own index and summary
+static void test_one_callback_per_input(void) {
+    HTMLDjangoInput inputs[INPUT_COUNT];
+    make_inputs(inputs, INPUT_COUNT);
+    Record record;
+    CHECK(run(&record, inputs, INPUT_COUNT, 4) == 0);
+    CHECK(atomic_load(&record.total) == INPUT_COUNT);
+    for (size_t i = 0; i < INPUT_COUNT; i++) CHECK(atomic_load(&record.calls[i]) == 1);
+    CHECK(atomic_load(&record.bad_worker) == 0);
+    CHECK(atomic_load(&record.mismatched) == 0);
+}
+
+// A single worker has nothing to steal from, so it parses in input order
+static void test_ordering(void) {
+    HTMLDjangoInput inputs[INPUT_COUNT];
+    make_inputs(inputs, INPUT_COUNT);
+    Record record;
+    CHECK(run(&record, inputs, INPUT_COUNT, 1) == 0);
+    CHECK(atomic_load(&record.total) == INPUT_COUNT);
+    for (size_t i = 0; i < INPUT_COUNT; i++) CHECK(atomic_load(&record.order[i]) == i);
+}
+
+// Workers beyond the input count are never started, so every worker index
+// passed to the callback is below the input count
+static void test_more_threads_than_inputs(void) {
+    HTMLDjangoInput inputs[3];
+    make_inputs(inputs, 3);
+    Record record;
+    CHECK(run(&record, inputs, 3, 16) == 0);
+    CHECK(record.threads == 3);
+    CHECK(atomic_load(&record.total) == 3);
+    for (size_t i = 0; i < 3; i++) CHECK(atomic_load(&record.calls[i]) == 1);
+    CHECK(atomic_load(&record.bad_worker) == 0);
+}
+
+static void test_no_inputs(void) {
+    Record record;
+    CHECK(run(&record, NULL, 0, 0) == 0);
+    CHECK(run(&record, NULL, 0, 8) == 0);
+    CHECK(atomic_load(&record.total) == 0);
+}
+
+// An unreadable path and an input with neither source nor path are counted
+// and reported without a tree; the inputs around them still parse
+static void test_read_errors(void) {
+    HTMLDjangoInput inputs[4];
+    make_inputs(inputs, 4);
+    inputs[1] = (HTMLDjangoInput){.path = "/nonexistent/htmldjango-batch-test.html"};
+    inputs[2] = (HTMLDjangoInput){0};
+    Record record;
+    CHECK(run(&record, inputs, 4, 2) == 2);
+    CHECK(atomic_load(&record.total) == 4);
+    CHECK(record.read_errors[0] == 0 && record.had_tree[0]);
+    CHECK(record.read_errors[1] == ENOENT && !record.had_tree[1]);
+    CHECK(record.read_errors[2] == EINVAL && !record.had_tree[2]);
+    CHECK(record.read_errors[3] == 0 && record.had_tree[3]);
+    CHECK(atomic_load(&record.mismatched) == 0);
+}
+
+// A callback that returns true owns the tree, which stays usable after the
+// batch has deleted its parsers
+static void test_kept_trees(void) {
+    HTMLDjangoInput inputs[8];
+    make_inputs(inputs, 8);
+    Record record;
+    memset(&record, 0, sizeof(record));
+    record.inputs = inputs;
+    record.threads = 2;
+    record.keep = true;
+    HTMLDjangoBatchOptions options = {.threads = 2, .callback = on_tree, .payload = &record};
+    CHECK(htmldjango_parse_batch(inputs, 8, &options) == 0);
+    for (size_t i = 0; i < 8; i++) {
+        CHECK(record.kept[i] != NULL);
+        if (!record.kept[i]) continue;
+        CHECK(ts_node_end_byte(ts_tree_root_node(record.kept[i])) <= inputs[i].length);
+        ts_tree_delete(record.kept[i]);
+    }
+}
+
+int main(void) {
+    test_one_callback_per_input();
+    test_ordering();
+    test_more_threads_than_inputs();
+    test_no_inputs();
+    test_read_errors();
+    test_kept_trees();
+    if (failures) {
+        fprintf(stderr, "%d checks failed\n", failures);
+        return 1;
+    }
+    puts("all checks passed");
+    return 0;
+}
@@ -0,0 +1,93 @@
+#include "tree-sitter-htmldjango-blocks.h"
+#include "lexer.h"
+
+#include <stdlib.h>
+
+// Matches django_block_open, django_endblock and a {{ block.super }} lookup
+// from grammar.js against the tags from lexer.h. The open blocks form a chain
+// through their parent indices, so no separate stack is kept.
+
+static bool is_identifier(Span span) {
+    if (span.start == span.end || !lexer_is_word_start(*span.start)) return false;
+    for (const char *cursor = span.start; cursor < span.end; cursor++) {
+        if (!lexer_is_word(*cursor)) return false;
+    }
+    return true;
+}
+
+// block.super, optionally through filters
+static bool is_block_super(Span body) {
+    static const char KEYWORD[] = "block.super";
+    size_t length = sizeof(KEYWORD) - 1;
+    if ((size_t)(body.end - body.start) < length || memcmp(body.start, KEYWORD, length) != 0) return false;
+    const char *next = body.start + length;
+    return next == body.end || lexer_is_space(*next) || *next == '|';
+}
+
+static bool grow(void **items, uint32_t *capacity, uint32_t count, size_t size) {
+    if (count < *capacity) return true;
+    uint32_t new_capacity = *capacity ? *capacity * 2 : 16;
+    void *grown = realloc(*items, new_capacity * size);
+    if (!grown) return false;
+    *items = grown;
+    *capacity = new_capacity;
+    return true;
+}
+
+bool htmldjango_block_map_build(HTMLDjangoBlockMap *map, const char *source, uint32_t length) {
+    map->block_count = 0;
+    map->super_count = 0;
+    uint32_t open = HTMLDJANGO_NO_BLOCK;
+    uint32_t depth = 0;
+
+    Lexer lexer = lexer_new(source, length);
+    LexerTag tag;
+    while (lexer_next(&lexer, &tag)) {
+        uint32_t start = (uint32_t)(tag.tag.start - source);
+        uint32_t end = (uint32_t)(tag.tag.end - source);
+        if (tag.kind == '{') {
+            if (open == HTMLDJANGO_NO_BLOCK || !is_block_super(tag.body)) continue;
+            if (!grow((void **)&map->supers, &map->super_capacity, map->super_count, sizeof(HTMLDjangoBlockSuper))) {
+                return false;
+            }
+            map->supers[map->super_count++] = (HTMLDjangoBlockSuper){open, start, end};
+            map->blocks[open].super_count++;
+            continue;
+        }
+
+        Span name, rest;
+        if (!span_split_name(tag.body, &name, &rest)) continue;
+        rest = span_trim(rest);
+        if (span_equals(name, "block") && is_identifier(rest)) {
+            if (!grow((void **)&map->blocks, &map->block_capacity, map->block_count, sizeof(HTMLDjangoBlock))) {
+                return false;
+            }
+            map->blocks[map->block_count] = (HTMLDjangoBlock){
+                .name = rest.start,
+                .name_length = (uint32_t)(rest.end - rest.start),
+                .start_byte = start,
+                .end_byte = length,
+                .content_start_byte = end,
+                .content_end_byte = length,
+                .depth = depth++,
+                .parent = open,
+            };
+            open = map->block_count++;
+        } else if (span_equals(name, "endblock") && open != HTMLDJANGO_NO_BLOCK &&
+                   (rest.start == rest.end || is_identifier(rest))) {
+            HTMLDjangoBlock *block = &map->blocks[open];
+            block->end_byte = end;
+            block->content_end_byte = start;
+            block->closed = true;
+            open = block->parent;
+            depth--;
+        }
+    }
+    return true;
+}
+
+void htmldjango_block_map_delete(HTMLDjangoBlockMap *map) {
+    free(map->blocks);
+    free(map->supers);
+    *map = (HTMLDjangoBlockMap){0};
+}
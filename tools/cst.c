@@ -0,0 +1,120 @@
+#include "tree-sitter-htmldjango-cst.h"
+
+#include <string.h>
+
+static const char CST_MAGIC[4] = {'H', 'D', 'J', 'C'};
+
+// Byte by byte, so that the reader works on any host and alignment; on a
+// little-endian host this compiles to a plain load
+static inline uint16_t read_u16(const uint8_t *p) { return (uint16_t)(p[0] | p[1] << 8); }
+
+static inline uint32_t read_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline const uint8_t *node_at(const HTMLDjangoCST *cst, uint32_t index) {
+    return cst->data + HTMLDJANGO_CST_HEADER_SIZE + (size_t)index * HTMLDJANGO_CST_NODE_SIZE;
+}
+
+static inline uint32_t node_parent(const HTMLDjangoCST *cst, uint32_t index) {
+    return read_u32(node_at(cst, index) + 16);
+}
+
+static inline uint32_t node_next(const HTMLDjangoCST *cst, uint32_t index) {
+    return read_u32(node_at(cst, index) + 20);
+}
+
+static bool names_valid(const HTMLDjangoCST *cst, size_t total) {
+    size_t entries = (size_t)cst->kind_count + cst->field_count;
+    size_t table = cst->names_offset;
+    if (table < HTMLDJANGO_CST_HEADER_SIZE + (size_t)cst->node_count * HTMLDJANGO_CST_NODE_SIZE ||
+        table > total || (total - table) / 4 < entries) {
+        return false;
+    }
+    for (size_t i = 0; i < entries; i++) {
+        size_t offset = table + read_u32(cst->data + table + i * 4);
+        if (offset < table + entries * 4 || offset >= total) return false;
+        if (!memchr(cst->data + offset, '\0', total - offset)) return false;
+    }
+    return true;
+}
+
+// Each node's parent must be the innermost node whose range [index, next)
+// still contains it; walking up from the previous node finds that node in
+// amortized constant time, the way a stack of open nodes would
+static bool nodes_valid(const HTMLDjangoCST *cst) {
+    for (uint32_t i = 0; i < cst->node_count; i++) {
+        const uint8_t *node = node_at(cst, i);
+        uint32_t parent = read_u32(node + 16);
+        uint32_t next = read_u32(node + 20);
+        if (read_u16(node) >= cst->kind_count || read_u16(node + 2) >= cst->field_count) return false;
+        if (read_u32(node + 8) > read_u32(node + 12)) return false;
+        if (next <= i || next > cst->node_count) return false;
+
+        uint32_t open = i == 0 ? HTMLDJANGO_CST_NO_NODE : i - 1;
+        while (open != HTMLDJANGO_CST_NO_NODE && node_next(cst, open) <= i) open = node_parent(cst, open);
+        if (parent != open || (i > 0 && parent == HTMLDJANGO_CST_NO_NODE)) return false;
+        if (parent != HTMLDJANGO_CST_NO_NODE && next > node_next(cst, parent)) return false;
+    }
+    return true;
+}
+
+bool htmldjango_cst_open(HTMLDjangoCST *cst, const void *data, size_t length) {
+    const uint8_t *bytes = data;
+    if (!bytes || length < HTMLDJANGO_CST_HEADER_SIZE || memcmp(bytes, CST_MAGIC, sizeof(CST_MAGIC)) != 0 ||
+        read_u16(bytes + 4) != HTMLDJANGO_CST_VERSION || read_u16(bytes + 6) != HTMLDJANGO_CST_HEADER_SIZE) {
+        return false;
+    }
+    uint32_t total = read_u32(bytes + 24);
+    HTMLDjangoCST candidate = {
+        .data = bytes,
+        .length = total,
+        .node_count = read_u32(bytes + 8),
+        .kind_count = read_u32(bytes + 12),
+        .field_count = read_u32(bytes + 16),
+        .names_offset = read_u32(bytes + 20),
+    };
+    if (total > length || candidate.kind_count > UINT16_MAX + 1u || candidate.field_count > UINT16_MAX + 1u ||
+        !names_valid(&candidate, total) || !nodes_valid(&candidate)) {
+        return false;
+    }
+    *cst = candidate;
+    return true;
+}
+
+HTMLDjangoCSTNode htmldjango_cst_node(const HTMLDjangoCST *cst, uint32_t index) {
+    const uint8_t *node = node_at(cst, index);
+    return (HTMLDjangoCSTNode){
+        .kind = read_u16(node),
+        .field = read_u16(node + 2),
+        .flags = read_u16(node + 4),
+        .start_byte = read_u32(node + 8),
+        .end_byte = read_u32(node + 12),
+        .parent = read_u32(node + 16),
+        .next = read_u32(node + 20),
+    };
+}
+
+uint32_t htmldjango_cst_first_child(const HTMLDjangoCST *cst, uint32_t index) {
+    return index + 1 < node_next(cst, index) ? index + 1 : HTMLDJANGO_CST_NO_NODE;
+}
+
+uint32_t htmldjango_cst_next_sibling(const HTMLDjangoCST *cst, uint32_t index) {
+    uint32_t parent = node_parent(cst, index);
+    if (parent == HTMLDJANGO_CST_NO_NODE) return HTMLDJANGO_CST_NO_NODE;
+    uint32_t next = node_next(cst, index);
+    return next < node_next(cst, parent) ? next : HTMLDJANGO_CST_NO_NODE;
+}
+
+static const char *name_at(const HTMLDjangoCST *cst, uint32_t entry) {
+    const uint8_t *table = cst->data + cst->names_offset;
+    return (const char *)table + read_u32(table + (size_t)entry * 4);
+}
+
+const char *htmldjango_cst_kind_name(const HTMLDjangoCST *cst, uint16_t kind) {
+    return kind < cst->kind_count ? name_at(cst, kind) : NULL;
+}
+
+const char *htmldjango_cst_field_name(const HTMLDjangoCST *cst, uint16_t field) {
+    return field < cst->field_count ? name_at(cst, cst->kind_count + field) : NULL;
+}
@@ -0,0 +1,133 @@
+#include "tree-sitter-htmldjango-tools.h"
+#include "tree-sitter-htmldjango.h"
+#include "kind_names.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The records hold the stable kind and field IDs of
+// tree-sitter-htmldjango-kinds.h, not the parser's, and every buffer ends
+// with the same name table, built once.
+
+static struct {
+    uint8_t *data;
+    size_t size;
+} names;
+
+static pthread_once_t names_once = PTHREAD_ONCE_INIT;
+
+static void build_names(void) {
+    size_t size = (HTMLDJANGO_NUM_KINDS + HTMLDJANGO_NUM_FIELDS) * 4;
+    for (size_t i = 0; i < HTMLDJANGO_NUM_KINDS; i++) size += strlen(KIND_NAMES[i].name) + 1;
+    for (size_t i = 0; i < HTMLDJANGO_NUM_FIELDS; i++) size += strlen(FIELD_NAMES[i]) + 1;
+    uint8_t *data = malloc(size);
+    if (!data) return;
+
+    size_t offset = (HTMLDJANGO_NUM_KINDS + HTMLDJANGO_NUM_FIELDS) * 4;
+    for (size_t i = 0; i < HTMLDJANGO_NUM_KINDS + HTMLDJANGO_NUM_FIELDS; i++) {
+        const char *name = i < HTMLDJANGO_NUM_KINDS ? KIND_NAMES[i].name : FIELD_NAMES[i - HTMLDJANGO_NUM_KINDS];
+        size_t length = strlen(name) + 1;
+        uint8_t *entry = data + i * 4;
+        entry[0] = (uint8_t)offset;
+        entry[1] = (uint8_t)(offset >> 8);
+        entry[2] = (uint8_t)(offset >> 16);
+        entry[3] = (uint8_t)(offset >> 24);
+        memcpy(data + offset, name, length);
+        offset += length;
+    }
+    names.data = data;
+    names.size = size;
+}
+
+static inline void write_u16(uint8_t *p, uint16_t value) {
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+}
+
+static inline void write_u32(uint8_t *p, uint32_t value) {
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+}
+
+static inline uint32_t read_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+int htmldjango_cst_write(const TSTree *tree, HTMLDjangoCSTBuffer *buffer) {
+    pthread_once(&names_once, build_names);
+    if (!names.data) return ENOMEM;
+    if (ts_tree_language(tree) != tree_sitter_htmldjango()) return EINVAL;
+
+    TSNode root = ts_tree_root_node(tree);
+    uint32_t node_count = ts_node_descendant_count(root);
+    size_t names_offset = HTMLDJANGO_CST_HEADER_SIZE + (size_t)node_count * HTMLDJANGO_CST_NODE_SIZE;
+    size_t total = names_offset + names.size;
+    if (total > UINT32_MAX) return EFBIG;
+    if (total > buffer->capacity) {
+        uint8_t *data = realloc(buffer->data, total);
+        if (!data) return ENOMEM;
+        buffer->data = data;
+        buffer->capacity = total;
+    }
+    uint8_t *data = buffer->data;
+
+    memcpy(data, "HDJC", 4);
+    write_u16(data + 4, HTMLDJANGO_CST_VERSION);
+    write_u16(data + 6, HTMLDJANGO_CST_HEADER_SIZE);
+    write_u32(data + 8, node_count);
+    write_u32(data + 12, HTMLDJANGO_NUM_KINDS);
+    write_u32(data + 16, HTMLDJANGO_NUM_FIELDS);
+    write_u32(data + 20, (uint32_t)names_offset);
+    write_u32(data + 24, (uint32_t)total);
+    write_u32(data + 28, 0);
+    memcpy(data + names_offset, names.data, names.size);
+
+    // Pre-order, so each node's next is known once the cursor leaves it; the
+    // parent chain is read back from the records already written
+    TSTreeCursor cursor = ts_tree_cursor_new(root);
+    uint32_t count = 0;
+    uint32_t parent = HTMLDJANGO_CST_NO_NODE;
+    uint8_t *nodes = data + HTMLDJANGO_CST_HEADER_SIZE;
+    for (;;) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        uint16_t flags = (ts_node_is_named(node) ? HTMLDjangoCSTNamed : 0) |
+                         (ts_node_is_missing(node) ? HTMLDjangoCSTMissing : 0) |
+                         (ts_node_is_extra(node) ? HTMLDjangoCSTExtra : 0) |
+                         (ts_node_is_error(node) ? HTMLDjangoCSTError : 0) |
+                         (ts_node_has_error(node) ? HTMLDjangoCSTHasError : 0);
+        uint8_t *record = nodes + (size_t)count * HTMLDJANGO_CST_NODE_SIZE;
+        write_u16(record, htmldjango_node_kind(node));
+        write_u16(record + 2, htmldjango_field_for_id(ts_tree_cursor_current_field_id(&cursor)));
+        write_u16(record + 4, flags);
+        write_u16(record + 6, 0);
+        write_u32(record + 8, ts_node_start_byte(node));
+        write_u32(record + 12, ts_node_end_byte(node));
+        write_u32(record + 16, parent);
+        uint32_t index = count++;
+
+        if (ts_tree_cursor_goto_first_child(&cursor)) {
+            parent = index;
+            continue;
+        }
+        write_u32(record + 20, count);
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) goto done;
+            uint8_t *finished = nodes + (size_t)parent * HTMLDJANGO_CST_NODE_SIZE;
+            write_u32(finished + 20, count);
+            parent = read_u32(finished + 16);
+        }
+    }
+done:
+    ts_tree_cursor_delete(&cursor);
+    buffer->length = total;
+    return 0;
+}
+
+void htmldjango_cst_buffer_delete(HTMLDjangoCSTBuffer *buffer) {
+    free(buffer->data);
+    *buffer = (HTMLDjangoCSTBuffer){0};
+}
@@ -0,0 +1,115 @@
+#include "tree-sitter-htmldjango-tools.h"
+#include "lexer.h"
+
+// A single forward pass over the tags from lexer.h that matches the four
+// dependency tags against the same shapes as django_extends_tag,
+// django_include_tag, django_load_tag and django_partial_tag in grammar.js.
+// Nothing is allocated and no tree is built.
+
+// Matches the string rule from common/expressions.js at the start of span
+static const char *scan_string(Span span) {
+    if (span.start == span.end) return NULL;
+    char quote = *span.start;
+    if (quote != '"' && quote != '\'') return NULL;
+    for (const char *cursor = span.start + 1; cursor < span.end; cursor++) {
+        if (*cursor == '\\') {
+            cursor++;
+        } else if (*cursor == quote) {
+            return cursor + 1;
+        }
+    }
+    return NULL;
+}
+
+typedef struct {
+    const char *source;
+    HTMLDjangoDependencyCallback callback;
+    void *payload;
+    size_t count;
+    bool stopped;
+} Extraction;
+
+static void emit(Extraction *extraction, HTMLDjangoDependencyKind kind, Span target, Span tag) {
+    HTMLDjangoDependency dependency = {
+        .kind = kind,
+        .target = target.start,
+        .target_length = (uint32_t)(target.end - target.start),
+        .start_byte = (uint32_t)(tag.start - extraction->source),
+        .end_byte = (uint32_t)(tag.end - extraction->source),
+    };
+    extraction->count++;
+    if (extraction->callback && !extraction->callback(extraction->payload, &dependency)) {
+        extraction->stopped = true;
+    }
+}
+
+// extends and include take a template name; only a literal one is a static
+// dependency. include may be followed by "with ..." or "only".
+static void match_template(Extraction *extraction, HTMLDjangoDependencyKind kind, Span rest, Span tag,
+                           bool allow_more) {
+    rest = span_trim(rest);
+    const char *end = scan_string(rest);
+    if (!end || (end < rest.end && (!allow_more || !lexer_is_space(*end)))) return;
+    emit(extraction, kind, (Span){rest.start + 1, end - 1}, tag);
+}
+
+// load lib [lib ...] or load name [name ...] from lib
+static void match_load(Extraction *extraction, Span rest, Span tag) {
+    Span words[2] = {{NULL, NULL}, {NULL, NULL}};
+    size_t word_count = 0;
+    const char *cursor = rest.start;
+    while (cursor < rest.end) {
+        while (cursor < rest.end && lexer_is_space(*cursor)) cursor++;
+        if (cursor == rest.end) break;
+        const char *start = cursor;
+        if (!lexer_is_word_start(*cursor)) return;
+        while (cursor < rest.end && (lexer_is_word(*cursor) || *cursor == '.')) cursor++;
+        if (cursor < rest.end && !lexer_is_space(*cursor)) return;
+        words[0] = words[1];
+        words[1] = (Span){start, cursor};
+        word_count++;
+    }
+    if (word_count >= 3 && span_equals(words[0], "from")) {
+        emit(extraction, HTMLDjangoDependencyLoad, words[1], tag);
+        return;
+    }
+
+    for (cursor = rest.start; cursor < rest.end && !extraction->stopped;) {
+        while (cursor < rest.end && lexer_is_space(*cursor)) cursor++;
+        if (cursor == rest.end) break;
+        const char *start = cursor;
+        while (cursor < rest.end && !lexer_is_space(*cursor)) cursor++;
+        emit(extraction, HTMLDjangoDependencyLoad, (Span){start, cursor}, tag);
+    }
+}
+
+static void match_partial(Extraction *extraction, Span rest, Span tag) {
+    rest = span_trim(rest);
+    if (rest.start == rest.end || !lexer_is_word_start(*rest.start)) return;
+    for (const char *cursor = rest.start; cursor < rest.end; cursor++) {
+        if (!lexer_is_word(*cursor)) return;
+    }
+    emit(extraction, HTMLDjangoDependencyPartial, rest, tag);
+}
+
+size_t htmldjango_extract_dependencies(const char *source, uint32_t length,
+                                       HTMLDjangoDependencyCallback callback, void *payload) {
+    Extraction extraction = {.source = source, .callback = callback, .payload = payload};
+    Lexer lexer = lexer_new(source, length);
+    LexerTag tag;
+    while (!extraction.stopped && lexer_next(&lexer, &tag)) {
+        Span name, rest;
+        if (tag.kind != '%' || !span_split_name(tag.body, &name, &rest)) continue;
+
+        if (span_equals(name, "extends")) {
+            match_template(&extraction, HTMLDjangoDependencyExtends, rest, tag.tag, false);
+        } else if (span_equals(name, "include")) {
+            match_template(&extraction, HTMLDjangoDependencyInclude, rest, tag.tag, true);
+        } else if (span_equals(name, "load")) {
+            match_load(&extraction, rest, tag.tag);
+        } else if (span_equals(name, "partial")) {
+            match_partial(&extraction, rest, tag.tag);
+        }
+    }
+    return extraction.count;
+}
@@ -0,0 +1,146 @@
+// Tests for dependency extraction. Exits non-zero if any check fails.
+
+#include "tree-sitter-htmldjango-tools.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                                                               \
+    do {                                                                                                               \
+        if (!(condition)) {                                                                                            \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);                              \
+            failures++;                                                                                                \
+        }                                                                                                              \
+    } while (0)
+
+#define MAX_FOUND 16
+
+typedef struct {
+    HTMLDjangoDependency found[MAX_FOUND];
+    size_t count;
+    size_t stop_after;
+} Found;
+
+static bool on_dependency(void *payload, const HTMLDjangoDependency *dependency) {
+    Found *found = payload;
+    if (found->count < MAX_FOUND) found->found[found->count] = *dependency;
+    found->count++;
+    return !found->stop_after || found->count < found->stop_after;
+}
+
+static size_t extract(const char *source, Found *found) {
+    memset(found, 0, sizeof(*found));
+    size_t count = htmldjango_extract_dependencies(source, (uint32_t)strlen(source), on_dependency, found);
+    CHECK(count == found->count);
+    return count;
+}
+
+static bool is(const HTMLDjangoDependency *dependency, HTMLDjangoDependencyKind kind, const char *target) {
+    return dependency->kind == kind && dependency->target_length == strlen(target) &&
+           memcmp(dependency->target, target, dependency->target_length) == 0;
+}
+
+static void test_template_names(void) {
+    const char *source = "{% extends \"base.html\" %}\n"
+                         "{% include 'nav.html' with active=\"home\" only %}\n"
+                         "{% include template_name %}\n";
+    Found found;
+    CHECK(extract(source, &found) == 2);
+    CHECK(is(&found.found[0], HTMLDjangoDependencyExtends, "base.html"));
+    CHECK(found.found[0].start_byte == 0 && found.found[0].end_byte == 25);
+    CHECK(is(&found.found[1], HTMLDjangoDependencyInclude, "nav.html"));
+    CHECK(found.found[1].start_byte == 26);
+}
+
+// Escapes are left as written, and an escaped quote does not end the name
+static void test_escaped_quotes(void) {
+    Found found;
+    CHECK(extract("{% include \"say \\\"hi\\\".html\" %}{% extends 'it\\'s.html' %}", &found) == 2);
+    CHECK(is(&found.found[0], HTMLDjangoDependencyInclude, "say \\\"hi\\\".html"));
+    CHECK(is(&found.found[1], HTMLDjangoDependencyExtends, "it\\'s.html"));
+    CHECK(extract("{% include \"a.html\\\" %}", &found) == 0);
+}
+
+// {% load a b %} loads both libraries; with "from" only the library after it
+static void test_load(void) {
+    Found found;
+    CHECK(extract("{% load static humanize %}", &found) == 2);
+    CHECK(is(&found.found[0], HTMLDjangoDependencyLoad, "static"));
+    CHECK(is(&found.found[1], HTMLDjangoDependencyLoad, "humanize"));
+
+    CHECK(extract("{% load a b from lib %}", &found) == 1);
+    CHECK(is(&found.found[0], HTMLDjangoDependencyLoad, "lib"));
+
+    CHECK(extract("{% load intcomma from django.contrib.humanize %}", &found) == 1);
+    CHECK(is(&found.found[0], HTMLDjangoDependencyLoad, "django.contrib.humanize"));
+
+    CHECK(extract("{% load {{ x }} %}", &found) == 0);
+}
+
+static void test_partial(void) {
+    Found found;
+    CHECK(extract("{% partialdef card %}x{% endpartialdef %}{% partial card %}{% partial 'card' %}", &found) == 1);
+    CHECK(is(&found.found[0], HTMLDjangoDependencyPartial, "card"));
+}
+
+// A tag without its closing delimiter on the same line is text to Django, so
+// nothing is extracted from it and the next tag is still found
+static void test_unterminated_tags(void) {
+    Found found;
+    CHECK(extract("{% extends \"base.html\"", &found) == 0);
+    CHECK(extract("{% include \"a.html\"\n%}{% load static %}", &found) == 1);
+    CHECK(is(&found.found[0], HTMLDjangoDependencyLoad, "static"));
+    CHECK(extract("{% include \"a.html %}", &found) == 0);
+    // An unclosed {# is text too, so the tag after it counts
+    CHECK(extract("{# {% load first %}\n{% load second %}", &found) == 2);
+    CHECK(is(&found.found[0], HTMLDjangoDependencyLoad, "first"));
+    CHECK(is(&found.found[1], HTMLDjangoDependencyLoad, "second"));
+}
+
+// Tags inside comment and verbatim blocks, and {# #} comments, are text
+static void test_skipped_bodies(void) {
+    Found found;
+    CHECK(extract("{% comment \"why\" %}{% extends \"old.html\" %}{% endcomment %}{% extends \"new.html\" %}",
+                  &found) == 1);
+    CHECK(is(&found.found[0], HTMLDjangoDependencyExtends, "new.html"));
+
+    CHECK(extract("{% verbatim %}{% include \"raw.html\" %}{% endverbatim %}{% include \"real.html\" %}",
+                  &found) == 1);
+    CHECK(is(&found.found[0], HTMLDjangoDependencyInclude, "real.html"));
+
+    // Only an endverbatim with the opening tag's suffix ends the block
+    CHECK(extract("{% verbatim js %}{% endverbatim %}{% load hidden %}{% endverbatim js %}{% load shown %}",
+                  &found) == 1);
+    CHECK(is(&found.found[0], HTMLDjangoDependencyLoad, "shown"));
+
+    CHECK(extract("{# {% load hidden %} #}<!-- {% load shown %} -->", &found) == 1);
+    CHECK(is(&found.found[0], HTMLDjangoDependencyLoad, "shown"));
+}
+
+static void test_stop(void) {
+    Found found;
+    memset(&found, 0, sizeof(found));
+    found.stop_after = 2;
+    const char *source = "{% load a b c %}{% extends \"base.html\" %}";
+    CHECK(htmldjango_extract_dependencies(source, (uint32_t)strlen(source), on_dependency, &found) == 2);
+    CHECK(found.count == 2);
+    CHECK(htmldjango_extract_dependencies(source, (uint32_t)strlen(source), NULL, NULL) == 4);
+}
+
+int main(void) {
+    test_template_names();
+    test_escaped_quotes();
+    test_load();
+    test_partial();
+    test_unterminated_tags();
+    test_skipped_bodies();
+    test_stop();
+    if (failures) {
+        fprintf(stderr, "%d checks failed\n", failures);
+        return 1;
+    }
+    puts("all checks passed");
+    return 0;
+}
@@ -0,0 +1,346 @@
+#!/usr/bin/env python3
+"""Generate the node kind and field ID constants for every binding.
+
+Kind and field IDs come from tools/kind_ids.json, an append-only registry of
+every node type and field name that has had an ID, in ID order. Kind 0 is
+ERROR and field 0 is none. Node types and fields that are new in
+src/node-types.json are appended to the registry, so existing IDs never move
+when the grammar changes, and the binary CST format can store them as they
+are. Names that leave node-types.json keep their IDs, which are not reused.
+
+The generator fails rather than renumber: if the registry no longer matches
+the IDs in the last generated tools/kind_names.h, because an entry was
+edited, reordered or removed, nothing is written. Rerun after
+`tree-sitter generate` changes node-types.json, and commit the registry with
+the outputs.
+
+Writes:
+  tools/kind_ids.json
+  bindings/c/tree-sitter-htmldjango-kinds.h
+  tools/kind_names.h
+  bindings/rust/kinds.rs
+  bindings/python/tree_sitter_htmldjango/kinds.py
+  bindings/node/kinds.js and kinds.d.ts
+  bindings/go/kinds.go
+"""
+
+import json
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+REGISTRY = os.path.join("tools", "kind_ids.json")
+
+HEADER = "Generated by tools/gen_kinds.py from src/node-types.json. Do not edit."
+
+# The names tree-sitter itself gives punctuation in parser.c
+PUNCTUATION = {
+    "!": "BANG", '"': "DQUOTE", "#": "POUND", "$": "DOLLAR", "%": "PERCENT", "&": "AMP",
+    "'": "SQUOTE", "(": "LPAREN", ")": "RPAREN", "*": "STAR", "+": "PLUS", ",": "COMMA",
+    "-": "DASH", ".": "DOT", "/": "SLASH", ":": "COLON", ";": "SEMI", "<": "LT", "=": "EQ",
+    ">": "GT", "?": "QMARK", "@": "AT", "[": "LBRACK", "\\": "BSLASH", "]": "RBRACK",
+    "^": "CARET", "`": "BQUOTE", "{": "LBRACE", "|": "PIPE", "}": "RBRACE", "~": "TILDE",
+}
+
+
+def constant_name(name, named):
+    """DJANGO_IF_BLOCK for the named django_if_block, ANON_LBRACE_PERCENT for "{%"."""
+    if named:
+        return name.upper()
+    parts = []
+    for word in re.findall(r"[A-Za-z0-9_]+|.", name):
+        parts.append(word.upper() if re.match(r"\w", word) else PUNCTUATION.get(word, f"U{ord(word):04X}"))
+    return "ANON_" + "_".join(parts)
+
+
+def camel_name(constant):
+    return "".join(part.capitalize() for part in constant.split("_"))
+
+
+def c_string(text):
+    return json.dumps(text, ensure_ascii=False)
+
+
+def read_registry():
+    """The registered kinds as (type, named) and field names, both in ID order"""
+    path = os.path.join(ROOT, REGISTRY)
+    if not os.path.exists(path):
+        return [("ERROR", True)], [""]
+    with open(path, encoding="utf-8") as f:
+        registry = json.load(f)
+    kinds = [(name, named) for name, named in registry["kinds"]]
+    fields = list(registry["fields"])
+    if kinds[:1] != [("ERROR", True)] or fields[:1] != [""]:
+        raise SystemExit(f"gen_kinds.py: {REGISTRY} must start with ERROR and the empty field")
+    if len(set(kinds)) != len(kinds) or len(set(fields)) != len(fields):
+        raise SystemExit(f"gen_kinds.py: {REGISTRY} lists a name twice")
+    return kinds, fields
+
+
+def read_generated():
+    """The kinds and fields by ID in the last generated tools/kind_names.h"""
+    path = os.path.join(ROOT, "tools", "kind_names.h")
+    if not os.path.exists(path):
+        return [], []
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    kinds = [(json.loads(name), named == "true") for name, named in re.findall(r'^    \{(".*"), (true|false)\},$', text, re.M)]
+    field_table = text[text.index("FIELD_NAMES"):]
+    fields = [json.loads(name) for name in re.findall(r'^    (".*"),$', field_table, re.M)]
+    return kinds, fields
+
+
+def check_unmoved(what, current, previous):
+    for index, entry in enumerate(previous):
+        if index >= len(current) or current[index] != entry:
+            now = current[index] if index < len(current) else "nothing"
+            raise SystemExit(
+                f"gen_kinds.py: {what} ID {index} would move from {entry} to {now}; "
+                f"{REGISTRY} is append-only"
+            )
+
+
+def load():
+    with open(os.path.join(ROOT, "src", "node-types.json"), encoding="utf-8") as f:
+        node_types = json.load(f)
+    kinds, fields = read_registry()
+    for entry in node_types:
+        if (entry["type"], entry["named"]) not in kinds:
+            kinds.append((entry["type"], entry["named"]))
+    for name in sorted({name for entry in node_types for name in entry.get("fields", {})}):
+        if name not in fields:
+            fields.append(name)
+    previous_kinds, previous_fields = read_generated()
+    check_unmoved("kind", kinds, previous_kinds)
+    check_unmoved("field", fields, previous_fields)
+    constants = ["ERROR"] + [constant_name(name, named) for name, named in kinds[1:]]
+    duplicates = {name for name in constants if constants.count(name) > 1}
+    if duplicates:
+        raise SystemExit(f"gen_kinds.py: node types share a constant name: {sorted(duplicates)}")
+    if "none" in fields:
+        raise SystemExit("gen_kinds.py: a field named none clashes with FIELD_NONE")
+    return kinds, constants, fields
+
+
+def write(path, lines):
+    with open(os.path.join(ROOT, path), "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+def registry(kinds, fields):
+    lines = ["{", '  "kinds": [']
+    lines += [f"    [{json.dumps(name)}, {'true' if named else 'false'}]," for name, named in kinds]
+    lines[-1] = lines[-1].rstrip(",")
+    lines += ["  ],", '  "fields": [']
+    lines += [f"    {json.dumps(name)}," for name in fields]
+    lines[-1] = lines[-1].rstrip(",")
+    lines += ["  ]", "}"]
+    write(REGISTRY, lines)
+
+
+def c_header(kinds, constants, fields):
+    lines = [
+        f"// {HEADER}",
+        "",
+        "#ifndef TREE_SITTER_HTMLDJANGO_KINDS_H_",
+        "#define TREE_SITTER_HTMLDJANGO_KINDS_H_",
+        "",
+        "#include <stdint.h>",
+        "",
+        "#ifdef __cplusplus",
+        'extern "C" {',
+        "#endif",
+        "",
+        "// Stable IDs for the node kinds and fields of src/node-types.json. The",
+        "// parser's own symbol and field IDs move whenever the grammar is",
+        "// regenerated; these are assigned once, in tools/kind_ids.json, and never",
+        "// move.",
+        "",
+        "typedef enum {",
+    ]
+    for (name, named), constant in zip(kinds, constants):
+        lines.append(f"    HTMLDJANGO_KIND_{constant}, // {name if named else c_string(name)}")
+    lines += [
+        "} HTMLDjangoKind;",
+        "",
+        "typedef enum {",
+        "    HTMLDJANGO_FIELD_NONE,",
+    ]
+    lines += [f"    HTMLDJANGO_FIELD_{name.upper()}," for name in fields[1:]]
+    lines += [
+        "} HTMLDjangoField;",
+        "",
+        f"#define HTMLDJANGO_NUM_KINDS {len(kinds)}",
+        f"#define HTMLDJANGO_NUM_FIELDS {len(fields)}",
+        "",
+        "// Fills kinds[symbol] for each parser symbol below count, the way",
+        "// ts_node_symbol() numbers them, and returns the number of symbols. Symbols",
+        "// that never name a node map to HTMLDJANGO_KIND_ERROR, as does the ERROR",
+        "// symbol (65535) itself, which is past the end of the table. Needs no",
+        "// tree-sitter runtime.",
+        "uint32_t htmldjango_symbol_kinds(uint16_t *kinds, uint32_t count);",
+        "",
+        "// The same for the parser's field IDs, including 0 for none",
+        "uint32_t htmldjango_field_ids(uint16_t *fields, uint32_t count);",
+        "",
+        "#ifdef __cplusplus",
+        "}",
+        "#endif",
+        "",
+        "#endif // TREE_SITTER_HTMLDJANGO_KINDS_H_",
+    ]
+    write("bindings/c/tree-sitter-htmldjango-kinds.h", lines)
+
+
+def c_names(kinds, fields):
+    lines = [
+        f"// {HEADER}",
+        "",
+        "#ifndef TREE_SITTER_HTMLDJANGO_KIND_NAMES_H_",
+        "#define TREE_SITTER_HTMLDJANGO_KIND_NAMES_H_",
+        "",
+        "#include <stdbool.h>",
+        "",
+        '#include "tree-sitter-htmldjango-kinds.h"',
+        "",
+        "static const struct {",
+        "    const char *name;",
+        "    bool named;",
+        "} KIND_NAMES[HTMLDJANGO_NUM_KINDS] = {",
+    ]
+    lines += [f"    {{{c_string(name)}, {'true' if named else 'false'}}}," for name, named in kinds]
+    lines += ["};", "", "static const char *const FIELD_NAMES[HTMLDJANGO_NUM_FIELDS] = {"]
+    lines += [f"    {c_string(name)}," for name in fields]
+    lines += ["};", "", "#endif // TREE_SITTER_HTMLDJANGO_KIND_NAMES_H_"]
+    write("tools/kind_names.h", lines)
+
+
+def rust(kinds, constants, fields):
+    lines = [
+        f"// {HEADER}",
+        "",
+        "/// Node kind IDs, as returned by [`KindMap::kind`](crate::KindMap::kind) and stored in a",
+        "/// [`Cst`](crate::cst::Cst).",
+        "pub mod kind {",
+    ]
+    for index, ((name, named), constant) in enumerate(zip(kinds, constants)):
+        lines.append(f"    /// `{name}`" if named else f"    /// Anonymous `{name}`")
+        lines.append(f"    pub const {constant}: u16 = {index};")
+    lines += [
+        "}",
+        "",
+        "/// Field IDs, as returned by [`KindMap::field`](crate::KindMap::field). 0 is no field.",
+        "pub mod field {",
+        "    pub const NONE: u16 = 0;",
+    ]
+    for index, name in enumerate(fields[1:], 1):
+        lines.append(f"    pub const {name.upper()}: u16 = {index};")
+    lines += [
+        "}",
+        "",
+        f"pub const KIND_COUNT: usize = {len(kinds)};",
+        "",
+        "/// The node type name and whether it is named, by kind ID",
+        "pub const KIND_NAMES: [(&str, bool); KIND_COUNT] = [",
+    ]
+    lines += [f"    ({json.dumps(name)}, {'true' if named else 'false'})," for name, named in kinds]
+    lines += [
+        "];",
+        "",
+        f"pub const FIELD_COUNT: usize = {len(fields)};",
+        "",
+        "pub const FIELD_NAMES: [&str; FIELD_COUNT] = [",
+    ]
+    lines += [f"    {json.dumps(name)}," for name in fields]
+    lines += ["];"]
+    write("bindings/rust/kinds.rs", lines)
+
+
+def python(kinds, constants, fields):
+    lines = [
+        f'"""Node kind and field IDs. {HEADER}',
+        "",
+        "KIND_* values are what node_kind() returns and what a CST stores; FIELD_*",
+        "values are what cursor_field() returns.",
+        '"""',
+        "",
+    ]
+    for (name, named), constant, index in zip(kinds, constants, range(len(kinds))):
+        lines.append(f"KIND_{constant} = {index}" + ("" if named else f"  # {name}"))
+    lines.append("")
+    lines.append("FIELD_NONE = 0")
+    lines += [f"FIELD_{name.upper()} = {index}" for index, name in enumerate(fields[1:], 1)]
+    lines += ["", "# (type, named) by kind ID", "KIND_NAMES = ("]
+    lines += [f"    ({json.dumps(name)}, {named})," for name, named in kinds]
+    lines += [")", "", "FIELD_NAMES = ("]
+    lines += [f"    {json.dumps(name)}," for name in fields]
+    lines += [")"]
+    write("bindings/python/tree_sitter_htmldjango/kinds.py", lines)
+
+
+def node(kinds, constants, fields):
+    js = [f"// {HEADER}", "", '"use strict";', "", "const Kind = Object.freeze({"]
+    js += [f"  {constant}: {index}," for index, constant in enumerate(constants)]
+    js += ["});", "", "const Field = Object.freeze({", "  NONE: 0,"]
+    js += [f"  {name.upper()}: {index}," for index, name in enumerate(fields[1:], 1)]
+    js += ["});", "", "/** [type, named] by kind ID */", "const kindNames = Object.freeze(["]
+    js += [f"  [{json.dumps(name)}, {'true' if named else 'false'}]," for name, named in kinds]
+    js += ["]);", "", "const fieldNames = Object.freeze(["]
+    js += [f"  {json.dumps(name)}," for name in fields]
+    js += ["]);", "", "module.exports = { Kind, Field, kindNames, fieldNames };"]
+    write("bindings/node/kinds.js", js)
+
+    dts = [f"// {HEADER}", "", "export declare const Kind: {"]
+    dts += [f"  readonly {constant}: {index};" for index, constant in enumerate(constants)]
+    dts += ["};", "", "export declare const Field: {", "  readonly NONE: 0;"]
+    dts += [f"  readonly {name.upper()}: {index};" for index, name in enumerate(fields[1:], 1)]
+    dts += [
+        "};",
+        "",
+        "export declare const kindNames: readonly (readonly [string, boolean])[];",
+        "export declare const fieldNames: readonly string[];",
+    ]
+    write("bindings/node/kinds.d.ts", dts)
+
+
+def go(kinds, constants, fields):
+    lines = [
+        f"// {HEADER}",
+        "",
+        "package tree_sitter_htmldjango",
+        "",
+        "// Node kind IDs, as returned by KindOf and stored in a binary CST.",
+        "const (",
+    ]
+    lines.append("\tKindError uint16 = iota")
+    lines += [f"\tKind{camel_name(constant)}" for constant in constants[1:]]
+    lines += [
+        ")",
+        "",
+        "// Field IDs, as returned by FieldOf. FieldNone is no field.",
+        "const (",
+        "\tFieldNone uint16 = iota",
+    ]
+    lines += [f"\tField{camel_name(name.upper())}" for name in fields[1:]]
+    lines += [")", "", "// The node type name of each kind ID", "var KindNames = [...]string{"]
+    lines += [f"\t{json.dumps(name)}," for name, _ in kinds]
+    lines += ["}", "", "var FieldNames = [...]string{"]
+    lines += [f"\t{json.dumps(name)}," for name in fields]
+    lines += ["}"]
+    write("bindings/go/kinds.go", lines)
+
+
+def main():
+    kinds, constants, fields = load()
+    registry(kinds, fields)
+    c_header(kinds, constants, fields)
+    c_names(kinds, fields)
+    rust(kinds, constants, fields)
+    python(kinds, constants, fields)
+    node(kinds, constants, fields)
+    go(kinds, constants, fields)
+
+
+if __name__ == "__main__":
+    main()
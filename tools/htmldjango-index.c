@@ -0,0 +1,191 @@
+#include "tree-sitter-htmldjango-tools.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Indexes a template directory, reusing the summaries of unchanged files from
+// the cache written by the previous run.
+
+static const char *KIND_NAMES[] = {"block", "extends", "include", "load", "tag"};
+
+static void print_usage(FILE *stream) {
+    fprintf(stream,
+            "usage: htmldjango-index [--cache FILE] [--threads N] [--print] [--json] DIR\n"
+            "\n"
+            "options:\n"
+            "  --cache FILE  index cache to read and update (default DIR/.htmldjango-index)\n"
+            "  --threads N   worker threads (default one per online CPU)\n"
+            "  --print       list every file with its blocks, edges, libraries and tags\n"
+            "  --json        print a single JSON object\n");
+}
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void print_json_string(const char *string) {
+    putchar('"');
+    for (const char *c = string; *c; c++) {
+        if (*c == '"' || *c == '\\') {
+            printf("\\%c", *c);
+        } else if ((unsigned char)*c < 0x20) {
+            printf("\\u%04x", *c);
+        } else {
+            putchar(*c);
+        }
+    }
+    putchar('"');
+}
+
+static void print_file(const HTMLDjangoIndex *index, const HTMLDjangoIndexedFile *file) {
+    printf("%s%s\n", file->path, file->has_error ? " (has errors)" : "");
+    for (uint32_t i = 0; i < file->record_count; i++) {
+        const HTMLDjangoIndexRecord *record = &file->records[i];
+        printf("  %-8s %s", KIND_NAMES[record->kind], record->name);
+        if (record->kind == HTMLDjangoIndexBlock) {
+            const HTMLDjangoIndexedFile *base = htmldjango_index_overridden(index, file, record->name);
+            if (base) printf(" (overrides %s)", base->path);
+        } else if (record->kind == HTMLDjangoIndexExtends || record->kind == HTMLDjangoIndexInclude) {
+            const HTMLDjangoIndexedFile *target = htmldjango_index_resolve(index, record->name);
+            if (target) {
+                printf(" -> %s", target->path);
+            } else {
+                printf(" (not found)");
+            }
+        }
+        putchar('\n');
+    }
+}
+
+static void print_file_json(const HTMLDjangoIndex *index, const HTMLDjangoIndexedFile *file) {
+    printf("{\"path\": ");
+    print_json_string(file->path);
+    printf(", \"hash\": \"%016llx\", \"has_error\": %s, \"records\": [", (unsigned long long)file->hash,
+           file->has_error ? "true" : "false");
+    for (uint32_t i = 0; i < file->record_count; i++) {
+        const HTMLDjangoIndexRecord *record = &file->records[i];
+        const HTMLDjangoIndexedFile *target = NULL;
+        if (record->kind == HTMLDjangoIndexBlock) {
+            target = htmldjango_index_overridden(index, file, record->name);
+        } else if (record->kind == HTMLDjangoIndexExtends || record->kind == HTMLDjangoIndexInclude) {
+            target = htmldjango_index_resolve(index, record->name);
+        }
+        printf("%s{\"kind\": \"%s\", \"name\": ", i ? ", " : "", KIND_NAMES[record->kind]);
+        print_json_string(record->name);
+        if (target) {
+            printf(", \"%s\": ", record->kind == HTMLDjangoIndexBlock ? "overrides" : "resolves_to");
+            print_json_string(target->path);
+        }
+        putchar('}');
+    }
+    printf("]}");
+}
+
+int main(int argc, char **argv) {
+    const char *directory = NULL;
+    const char *cache = NULL;
+    unsigned threads = 0;
+    bool print = false, json = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+            print_usage(stdout);
+            return 0;
+        } else if (strcmp(arg, "--cache") == 0 && has_value) {
+            cache = argv[++i];
+        } else if (strcmp(arg, "--threads") == 0 && has_value) {
+            threads = (unsigned)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(arg, "--print") == 0) {
+            print = true;
+        } else if (strcmp(arg, "--json") == 0) {
+            json = true;
+        } else if (arg[0] == '-' || directory) {
+            fprintf(stderr, "htmldjango-index: unexpected argument '%s'\n", arg);
+            print_usage(stderr);
+            return 2;
+        } else {
+            directory = arg;
+        }
+    }
+    if (!directory) {
+        print_usage(stderr);
+        return 2;
+    }
+
+    char *default_cache = NULL;
+    if (!cache) {
+        size_t length = strlen(directory) + sizeof("/.htmldjango-index");
+        default_cache = malloc(length);
+        if (!default_cache) return 1;
+        snprintf(default_cache, length, "%s/.htmldjango-index", directory);
+        cache = default_cache;
+    }
+
+    HTMLDjangoIndex *index = htmldjango_index_new();
+    if (!index) {
+        free(default_cache);
+        return 1;
+    }
+
+    double start = now();
+    int error = htmldjango_index_load(index, cache);
+    if (error && error != ENOENT) {
+        fprintf(stderr, "htmldjango-index: ignoring %s: %s\n", cache, strerror(error));
+    }
+    double loaded = now();
+
+    HTMLDjangoIndexStats stats = {0};
+    error = htmldjango_index_update(index, directory, threads, &stats);
+    double updated = now();
+    if (error) {
+        fprintf(stderr, "htmldjango-index: %s: %s\n", directory, strerror(error));
+        htmldjango_index_delete(index);
+        free(default_cache);
+        return 1;
+    }
+
+    int status = 0;
+    error = htmldjango_index_save(index, cache);
+    double saved = now();
+    if (error) {
+        fprintf(stderr, "htmldjango-index: %s: %s\n", cache, strerror(error));
+        status = 1;
+    }
+
+    size_t count = htmldjango_index_file_count(index);
+    if (json) {
+        printf("{\"files\": %zu, \"parsed\": %zu, \"reused\": %zu, \"removed\": %zu, \"unreadable\": %zu, "
+               "\"load_ms\": %.3f, \"update_ms\": %.3f, \"save_ms\": %.3f",
+               stats.files, stats.parsed, stats.reused, stats.removed, stats.unreadable,
+               (loaded - start) * 1e3, (updated - loaded) * 1e3, (saved - updated) * 1e3);
+        if (print) {
+            printf(", \"index\": [");
+            for (size_t i = 0; i < count; i++) {
+                if (i) printf(", ");
+                print_file_json(index, htmldjango_index_file(index, i));
+            }
+            putchar(']');
+        }
+        printf("}\n");
+    } else {
+        if (print) {
+            for (size_t i = 0; i < count; i++) print_file(index, htmldjango_index_file(index, i));
+            putchar('\n');
+        }
+        printf("files: %zu (%zu parsed, %zu reused, %zu removed, %zu unreadable)\n", stats.files,
+               stats.parsed, stats.reused, stats.removed, stats.unreadable);
+        printf("load %.3f ms, update %.3f ms, save %.3f ms\n", (loaded - start) * 1e3,
+               (updated - loaded) * 1e3, (saved - updated) * 1e3);
+    }
+
+    htmldjango_index_delete(index);
+    free(default_cache);
+    return status;
+}
@@ -0,0 +1,686 @@
+#include "tree-sitter-htmldjango-tools.h"
+#include "tree-sitter-htmldjango.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+// Each indexed file owns one allocation, pointed to by its records: the
+// record array followed by the path and the record names, NUL-terminated.
+//
+// Cache layout, with every integer little-endian whatever the host, so a
+// cache can move between machines:
+//
+//   "HDJX" u32 format version, u32 file count
+//   per file: u64 hash, u8 has_error, u32 path length, path,
+//             u32 record count, then per record: u8 kind, u32 length, name
+
+static const char CACHE_MAGIC[4] = {'H', 'D', 'J', 'X'};
+
+static const char *TEMPLATE_EXTENSIONS[] = {".html", ".htm", ".django", ".htmldjango", NULL};
+
+struct HTMLDjangoIndex {
+    HTMLDjangoIndexedFile *files;
+    size_t count;
+
+    TSSymbol block_open;
+    TSSymbol extends_tag;
+    TSSymbol include_tag;
+    TSSymbol load_tag;
+    TSSymbol string;
+    TSSymbol library_name;
+    TSSymbol generic_tag_name;
+    TSFieldId name_field;
+    TSFieldId template_field;
+};
+
+typedef struct {
+    HTMLDjangoIndexRecordKind kind;
+    const char *name;
+    uint32_t length;
+} RawRecord;
+
+static uint64_t fnv1a(const char *data, size_t length) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)data[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+static void file_free(HTMLDjangoIndexedFile *file) {
+    free((void *)file->records);
+    file->records = NULL;
+}
+
+static int compare_raw_records(const void *a, const void *b) {
+    const RawRecord *left = a, *right = b;
+    if (left->kind != right->kind) return left->kind < right->kind ? -1 : 1;
+    uint32_t length = left->length < right->length ? left->length : right->length;
+    int order = memcmp(left->name, right->name, length);
+    if (order) return order;
+    return left->length < right->length ? -1 : left->length > right->length;
+}
+
+// Sorts and deduplicates raw, then copies it and the path into one block
+static bool file_pack(HTMLDjangoIndexedFile *file, const char *path, size_t path_length, uint64_t hash,
+                      bool has_error, RawRecord *raw, uint32_t raw_count) {
+    if (raw_count) qsort(raw, raw_count, sizeof(RawRecord), compare_raw_records);
+    uint32_t count = 0;
+    size_t size = path_length + 1;
+    for (uint32_t i = 0; i < raw_count; i++) {
+        if (count && compare_raw_records(&raw[count - 1], &raw[i]) == 0) continue;
+        raw[count++] = raw[i];
+        size += raw[i].length + 1;
+    }
+
+    HTMLDjangoIndexRecord *records = malloc(count * sizeof(HTMLDjangoIndexRecord) + size);
+    if (!records) return false;
+    char *strings = (char *)(records + count);
+    memcpy(strings, path, path_length);
+    strings[path_length] = '\0';
+    file->path = strings;
+    strings += path_length + 1;
+    for (uint32_t i = 0; i < count; i++) {
+        memcpy(strings, raw[i].name, raw[i].length);
+        strings[raw[i].length] = '\0';
+        records[i] = (HTMLDjangoIndexRecord){raw[i].kind, strings};
+        strings += raw[i].length + 1;
+    }
+    file->hash = hash;
+    file->has_error = has_error;
+    file->record_count = count;
+    file->records = records;
+    return true;
+}
+
+HTMLDjangoIndex *htmldjango_index_new(void) {
+    HTMLDjangoIndex *index = calloc(1, sizeof(HTMLDjangoIndex));
+    if (!index) return NULL;
+    const TSLanguage *language = tree_sitter_htmldjango();
+#define SYMBOL(name) ts_language_symbol_for_name(language, name, (uint32_t)strlen(name), true)
+    index->block_open = SYMBOL("django_block_open");
+    index->extends_tag = SYMBOL("django_extends_tag");
+    index->include_tag = SYMBOL("django_include_tag");
+    index->load_tag = SYMBOL("django_load_tag");
+    index->string = SYMBOL("string");
+    index->library_name = SYMBOL("library_name");
+    index->generic_tag_name = SYMBOL("generic_tag_name");
+#undef SYMBOL
+    index->name_field = ts_language_field_id_for_name(language, "name", 4);
+    index->template_field = ts_language_field_id_for_name(language, "template", 8);
+    return index;
+}
+
+static void index_clear(HTMLDjangoIndex *index) {
+    for (size_t i = 0; i < index->count; i++) file_free(&index->files[i]);
+    free(index->files);
+    index->files = NULL;
+    index->count = 0;
+}
+
+void htmldjango_index_delete(HTMLDjangoIndex *index) {
+    if (!index) return;
+    index_clear(index);
+    free(index);
+}
+
+size_t htmldjango_index_file_count(const HTMLDjangoIndex *index) { return index->count; }
+
+const HTMLDjangoIndexedFile *htmldjango_index_file(const HTMLDjangoIndex *index, size_t i) {
+    return i < index->count ? &index->files[i] : NULL;
+}
+
+// ============================================================================
+// Summaries
+// ============================================================================
+
+typedef struct {
+    RawRecord *items;
+    uint32_t count;
+    uint32_t capacity;
+} RecordList;
+
+static bool record_push(RecordList *list, HTMLDjangoIndexRecordKind kind, const char *source, TSNode node) {
+    uint32_t start = ts_node_start_byte(node), end = ts_node_end_byte(node);
+    if (list->count == list->capacity) {
+        uint32_t capacity = list->capacity ? list->capacity * 2 : 16;
+        RawRecord *items = realloc(list->items, capacity * sizeof(RawRecord));
+        if (!items) return false;
+        list->items = items;
+        list->capacity = capacity;
+    }
+    list->items[list->count++] = (RawRecord){kind, source + start, end - start};
+    return true;
+}
+
+static void summarize_node(const HTMLDjangoIndex *index, const char *source, TSNode node, RecordList *list) {
+    TSSymbol symbol = ts_node_symbol(node);
+    if (symbol == index->block_open) {
+        TSNode name = ts_node_child_by_field_id(node, index->name_field);
+        if (!ts_node_is_null(name)) record_push(list, HTMLDjangoIndexBlock, source, name);
+    } else if (symbol == index->extends_tag || symbol == index->include_tag) {
+        TSNode name = ts_node_child_by_field_id(node, index->template_field);
+        if (!ts_node_is_null(name) && ts_node_symbol(name) == index->string &&
+            ts_node_end_byte(name) - ts_node_start_byte(name) >= 2 &&
+            record_push(list, symbol == index->extends_tag ? HTMLDjangoIndexExtends : HTMLDjangoIndexInclude,
+                        source, name)) {
+            // Drop the quotes
+            list->items[list->count - 1].name++;
+            list->items[list->count - 1].length -= 2;
+        }
+    } else if (symbol == index->load_tag) {
+        // In "load a b from lib" only the last name is a library
+        uint32_t first = list->count;
+        bool from = false;
+        for (uint32_t i = 0; i < ts_node_child_count(node); i++) {
+            TSNode child = ts_node_child(node, i);
+            if (ts_node_symbol(child) == index->library_name) {
+                record_push(list, HTMLDjangoIndexLoad, source, child);
+            } else if (!ts_node_is_named(child) && strcmp(ts_node_type(child), "from") == 0) {
+                from = true;
+            }
+        }
+        if (from && list->count > first + 1) {
+            list->items[first] = list->items[list->count - 1];
+            list->count = first + 1;
+        }
+    } else if (symbol == index->generic_tag_name) {
+        record_push(list, HTMLDjangoIndexCustomTag, source, node);
+    }
+}
+
+static bool summarize(const HTMLDjangoIndex *index, const char *path, uint64_t hash, const char *source,
+                      TSTree *tree, HTMLDjangoIndexedFile *file) {
+    RecordList list = {0};
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+    for (;;) {
+        summarize_node(index, source, ts_tree_cursor_current_node(&cursor), &list);
+        if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) goto done;
+        }
+    }
+done:
+    ts_tree_cursor_delete(&cursor);
+    bool ok = file_pack(file, path, strlen(path), hash, ts_node_has_error(ts_tree_root_node(tree)),
+                        list.items, list.count);
+    free(list.items);
+    return ok;
+}
+
+// ============================================================================
+// Update
+// ============================================================================
+
+typedef struct {
+    char *path;
+    char *full_path;
+    HTMLDjangoMappedFile map;
+    uint64_t hash;
+    int error;
+    HTMLDjangoIndexedFile *cached;
+    bool changed;
+    HTMLDjangoIndexedFile result;
+} Job;
+
+typedef struct {
+    Job *items;
+    size_t count;
+    size_t capacity;
+} JobList;
+
+static bool has_template_extension(const char *name) {
+    const char *dot = strrchr(name, '.');
+    if (!dot) return false;
+    for (const char **ext = TEMPLATE_EXTENSIONS; *ext; ext++) {
+        if (strcmp(dot, *ext) == 0) return true;
+    }
+    return false;
+}
+
+static char *join_path(const char *directory, const char *name) {
+    size_t length = strlen(directory) + strlen(name) + 2;
+    char *path = malloc(length);
+    if (path) snprintf(path, length, "%s%s%s", directory, *directory ? "/" : "", name);
+    return path;
+}
+
+// The directories from the root down to the one being walked. Symlinks to
+// directories are followed, but not into a directory that is already on the
+// way down, so a link back up the tree cannot recurse forever.
+typedef struct Ancestor {
+    dev_t device;
+    ino_t inode;
+    const struct Ancestor *parent;
+} Ancestor;
+
+static bool is_ancestor(const Ancestor *ancestors, const struct stat *info) {
+    for (const Ancestor *a = ancestors; a; a = a->parent) {
+        if (a->device == info->st_dev && a->inode == info->st_ino) return true;
+    }
+    return false;
+}
+
+static int walk(const char *root, const char *relative, const Ancestor *ancestors, JobList *jobs) {
+    char *directory = *relative ? join_path(root, relative) : strdup(root);
+    if (!directory) return ENOMEM;
+    DIR *dir = opendir(directory);
+    if (!dir) {
+        int error = errno;
+        free(directory);
+        return error;
+    }
+    int error = 0;
+    struct dirent *entry;
+    while (!error && (entry = readdir(dir))) {
+        if (entry->d_name[0] == '.') continue;
+        char *child = join_path(relative, entry->d_name);
+        char *full_path = join_path(root, child);
+        struct stat info;
+        if (!child || !full_path) {
+            error = ENOMEM;
+        } else if (stat(full_path, &info) != 0) {
+            // A dangling link or a file removed during the walk
+        } else if (S_ISDIR(info.st_mode)) {
+            if (!is_ancestor(ancestors, &info)) {
+                Ancestor self = {info.st_dev, info.st_ino, ancestors};
+                error = walk(root, child, &self, jobs);
+            }
+        } else if (S_ISREG(info.st_mode) && has_template_extension(entry->d_name)) {
+            if (jobs->count == jobs->capacity) {
+                size_t capacity = jobs->capacity ? jobs->capacity * 2 : 256;
+                Job *items = realloc(jobs->items, capacity * sizeof(Job));
+                if (!items) {
+                    error = ENOMEM;
+                    break;
+                }
+                jobs->items = items;
+                jobs->capacity = capacity;
+            }
+            jobs->items[jobs->count++] = (Job){.path = child, .full_path = full_path};
+            continue;
+        }
+        free(child);
+        free(full_path);
+    }
+    closedir(dir);
+    free(directory);
+    return error;
+}
+
+static int compare_jobs(const void *a, const void *b) {
+    return strcmp(((const Job *)a)->path, ((const Job *)b)->path);
+}
+
+static int compare_path_to_file(const void *key, const void *file) {
+    return strcmp(key, ((const HTMLDjangoIndexedFile *)file)->path);
+}
+
+typedef struct {
+    JobList *jobs;
+    pthread_mutex_t lock;
+    size_t next;
+} HashPool;
+
+// Maps and hashes files; the mapping is kept only for files that changed
+static void *hash_worker(void *argument) {
+    HashPool *pool = argument;
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        size_t i = pool->next++;
+        pthread_mutex_unlock(&pool->lock);
+        if (i >= pool->jobs->count) return NULL;
+
+        Job *job = &pool->jobs->items[i];
+        job->error = htmldjango_map_file(job->full_path, &job->map);
+        if (job->error) continue;
+        job->hash = fnv1a(job->map.data, job->map.length);
+        job->changed = !job->cached || job->cached->hash != job->hash;
+        if (!job->changed) htmldjango_unmap_file(&job->map);
+    }
+}
+
+static void hash_jobs(JobList *jobs, unsigned threads) {
+    HashPool pool = {.jobs = jobs};
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_t *handles = calloc(threads, sizeof(pthread_t));
+    unsigned started = 0;
+    while (handles && started + 1 < threads &&
+           pthread_create(&handles[started], NULL, hash_worker, &pool) == 0) {
+        started++;
+    }
+    hash_worker(&pool);
+    for (unsigned i = 0; i < started; i++) pthread_join(handles[i], NULL);
+    free(handles);
+    pthread_mutex_destroy(&pool.lock);
+}
+
+typedef struct {
+    const HTMLDjangoIndex *index;
+    Job **jobs;
+} ParsePayload;
+
+static bool summarize_parsed(void *payload, unsigned worker, size_t i, TSTree *tree,
+                             const HTMLDjangoSummary *summary) {
+    (void)worker;
+    (void)summary;
+    ParsePayload *parse = payload;
+    Job *job = parse->jobs[i];
+    if (!summarize(parse->index, job->path, job->hash, job->map.data ? job->map.data : "", tree, &job->result)) {
+        job->error = ENOMEM;
+    }
+    return false;
+}
+
+int htmldjango_index_update(HTMLDjangoIndex *index, const char *root, unsigned threads,
+                            HTMLDjangoIndexStats *stats) {
+    HTMLDjangoIndexStats counts = {0};
+    JobList jobs = {0};
+    struct stat info;
+    if (stat(root, &info) != 0) return errno;
+    Ancestor top = {info.st_dev, info.st_ino, NULL};
+    int error = walk(root, "", &top, &jobs);
+    if (error) {
+        for (size_t i = 0; i < jobs.count; i++) {
+            free(jobs.items[i].path);
+            free(jobs.items[i].full_path);
+        }
+        free(jobs.items);
+        return error;
+    }
+    if (jobs.count) qsort(jobs.items, jobs.count, sizeof(Job), compare_jobs);
+    for (size_t i = 0; i < jobs.count; i++) {
+        jobs.items[i].cached = index->count ? bsearch(jobs.items[i].path, index->files, index->count,
+                                                      sizeof(HTMLDjangoIndexedFile), compare_path_to_file)
+                                            : NULL;
+    }
+
+    HTMLDjangoBatchOptions options = {.threads = threads};
+    options.threads = htmldjango_batch_threads(&options);
+    hash_jobs(&jobs, options.threads);
+
+    // Parse the changed files straight from their mappings
+    HTMLDjangoInput *inputs = calloc(jobs.count + 1, sizeof(HTMLDjangoInput));
+    Job **changed = calloc(jobs.count + 1, sizeof(Job *));
+    size_t changed_count = 0;
+    for (size_t i = 0; inputs && changed && i < jobs.count; i++) {
+        Job *job = &jobs.items[i];
+        if (job->error || !job->changed) continue;
+        inputs[changed_count] = (HTMLDjangoInput){
+            .source = job->map.data ? job->map.data : "",
+            .length = job->map.length,
+            .path = job->path,
+        };
+        changed[changed_count++] = job;
+    }
+    ParsePayload payload = {index, changed};
+    options.callback = summarize_parsed;
+    options.payload = &payload;
+    if (!inputs || !changed || htmldjango_parse_batch(inputs, changed_count, &options) < 0) error = ENOMEM;
+    free(inputs);
+    free(changed);
+
+    HTMLDjangoIndexedFile *files = calloc(jobs.count + 1, sizeof(HTMLDjangoIndexedFile));
+    size_t count = 0;
+    for (size_t i = 0; i < jobs.count; i++) {
+        Job *job = &jobs.items[i];
+        htmldjango_unmap_file(&job->map);
+        if (error || !files) {
+            file_free(&job->result);
+        } else if (job->error) {
+            counts.unreadable++;
+            file_free(&job->result);
+        } else if (job->changed) {
+            // Drop the stale summary, so that only deleted files are left behind
+            if (job->cached) file_free(job->cached);
+            files[count++] = job->result;
+            counts.parsed++;
+        } else {
+            // Move the cached summary; the old entry is left without records
+            files[count++] = *job->cached;
+            job->cached->records = NULL;
+            counts.reused++;
+        }
+        free(job->path);
+        free(job->full_path);
+    }
+    free(jobs.items);
+    if (!files) error = ENOMEM;
+    if (error) {
+        free(files);
+        return error;
+    }
+
+    // Files that were cached but are now unreadable count as removed, too
+    for (size_t i = 0; i < index->count; i++) {
+        if (index->files[i].records) counts.removed++;
+    }
+    index_clear(index);
+    index->files = files;
+    index->count = count;
+    counts.files = count;
+    if (stats) *stats = counts;
+    return 0;
+}
+
+// ============================================================================
+// Lookups
+// ============================================================================
+
+static const HTMLDjangoIndexRecord *find_record(const HTMLDjangoIndexedFile *file, HTMLDjangoIndexRecordKind kind,
+                                                const char *name) {
+    for (uint32_t i = 0; i < file->record_count; i++) {
+        const HTMLDjangoIndexRecord *record = &file->records[i];
+        if (record->kind == kind && (!name || strcmp(record->name, name) == 0)) return record;
+    }
+    return NULL;
+}
+
+const HTMLDjangoIndexedFile *htmldjango_index_resolve(const HTMLDjangoIndex *index, const char *name) {
+    const HTMLDjangoIndexedFile *exact = index->count ? bsearch(name, index->files, index->count,
+                                                                sizeof(HTMLDjangoIndexedFile),
+                                                                compare_path_to_file)
+                                                      : NULL;
+    if (exact) return exact;
+    size_t length = strlen(name);
+    for (size_t i = 0; i < index->count; i++) {
+        const char *path = index->files[i].path;
+        size_t path_length = strlen(path);
+        if (path_length > length && path[path_length - length - 1] == '/' &&
+            strcmp(path + path_length - length, name) == 0) {
+            return &index->files[i];
+        }
+    }
+    return NULL;
+}
+
+const HTMLDjangoIndexedFile *htmldjango_index_overridden(const HTMLDjangoIndex *index,
+                                                        const HTMLDjangoIndexedFile *file,
+                                                        const char *block) {
+    // Bounded by the file count, in case of an extends cycle
+    for (size_t depth = 0; depth < index->count; depth++) {
+        const HTMLDjangoIndexRecord *extends = find_record(file, HTMLDjangoIndexExtends, NULL);
+        if (!extends) return NULL;
+        file = htmldjango_index_resolve(index, extends->name);
+        if (!file) return NULL;
+        if (find_record(file, HTMLDjangoIndexBlock, block)) return file;
+    }
+    return NULL;
+}
+
+// ============================================================================
+// Cache
+// ============================================================================
+
+static void write_u32(FILE *file, uint32_t value) {
+    uint8_t bytes[4] = {(uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24)};
+    fwrite(bytes, 1, sizeof(bytes), file);
+}
+
+static void write_u64(FILE *file, uint64_t value) {
+    write_u32(file, (uint32_t)value);
+    write_u32(file, (uint32_t)(value >> 32));
+}
+
+int htmldjango_index_save(const HTMLDjangoIndex *index, const char *path) {
+    size_t length = strlen(path) + 5;
+    char *temporary = malloc(length);
+    if (!temporary) return ENOMEM;
+    snprintf(temporary, length, "%s.tmp", path);
+    FILE *file = fopen(temporary, "wb");
+    if (!file) {
+        int error = errno;
+        free(temporary);
+        return error;
+    }
+
+    fwrite(CACHE_MAGIC, 1, sizeof(CACHE_MAGIC), file);
+    write_u32(file, HTMLDJANGO_INDEX_FORMAT_VERSION);
+    write_u32(file, (uint32_t)index->count);
+    for (size_t i = 0; i < index->count; i++) {
+        const HTMLDjangoIndexedFile *entry = &index->files[i];
+        uint8_t has_error = entry->has_error;
+        uint32_t path_length = (uint32_t)strlen(entry->path);
+        write_u64(file, entry->hash);
+        fwrite(&has_error, 1, 1, file);
+        write_u32(file, path_length);
+        fwrite(entry->path, 1, path_length, file);
+        write_u32(file, entry->record_count);
+        for (uint32_t j = 0; j < entry->record_count; j++) {
+            uint8_t kind = (uint8_t)entry->records[j].kind;
+            uint32_t name_length = (uint32_t)strlen(entry->records[j].name);
+            fwrite(&kind, 1, 1, file);
+            write_u32(file, name_length);
+            fwrite(entry->records[j].name, 1, name_length, file);
+        }
+    }
+
+    int error = ferror(file) ? EIO : 0;
+    if (fclose(file) != 0 && !error) error = errno;
+    if (!error && rename(temporary, path) != 0) error = errno;
+    if (error) remove(temporary);
+    free(temporary);
+    return error;
+}
+
+typedef struct {
+    const char *cursor;
+    const char *end;
+    bool ok;
+} Reader;
+
+static void read_bytes(Reader *reader, void *out, size_t length) {
+    if (!reader->ok || (size_t)(reader->end - reader->cursor) < length) {
+        reader->ok = false;
+        memset(out, 0, length);
+        return;
+    }
+    memcpy(out, reader->cursor, length);
+    reader->cursor += length;
+}
+
+static uint32_t read_u32(Reader *reader) {
+    uint8_t p[4];
+    read_bytes(reader, p, sizeof(p));
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static uint64_t read_u64(Reader *reader) {
+    uint64_t low = read_u32(reader);
+    return low | (uint64_t)read_u32(reader) << 32;
+}
+
+static const char *read_span(Reader *reader, uint32_t length) {
+    if (!reader->ok || (size_t)(reader->end - reader->cursor) < length) {
+        reader->ok = false;
+        return NULL;
+    }
+    const char *start = reader->cursor;
+    reader->cursor += length;
+    return start;
+}
+
+int htmldjango_index_load(HTMLDjangoIndex *index, const char *path) {
+    HTMLDjangoMappedFile map;
+    int error = htmldjango_map_file(path, &map);
+    if (error) return error;
+    index_clear(index);
+
+    Reader reader = {map.data, map.data + map.length, true};
+    char magic[sizeof(CACHE_MAGIC)];
+    read_bytes(&reader, magic, sizeof(magic));
+    uint32_t version = read_u32(&reader);
+    uint32_t count = read_u32(&reader);
+    if (!reader.ok || memcmp(magic, CACHE_MAGIC, sizeof(magic)) != 0 || version != HTMLDJANGO_INDEX_FORMAT_VERSION) {
+        htmldjango_unmap_file(&map);
+        return EINVAL;
+    }
+
+    // Every file takes at least 17 bytes, which bounds count before allocating
+    if ((size_t)(reader.end - reader.cursor) / 17 < count) {
+        htmldjango_unmap_file(&map);
+        return EINVAL;
+    }
+    HTMLDjangoIndexedFile *files = calloc((size_t)count + 1, sizeof(HTMLDjangoIndexedFile));
+    RawRecord *raw = NULL;
+    uint32_t raw_capacity = 0;
+    size_t loaded = 0;
+    error = files ? 0 : ENOMEM;
+    while (!error && loaded < count) {
+        uint8_t has_error;
+        uint64_t hash = read_u64(&reader);
+        read_bytes(&reader, &has_error, 1);
+        uint32_t path_length = read_u32(&reader);
+        const char *file_path = read_span(&reader, path_length);
+        uint32_t record_count = read_u32(&reader);
+        if (!reader.ok || (size_t)(reader.end - reader.cursor) / 5 < record_count) {
+            error = EINVAL;
+            break;
+        }
+        if (record_count > raw_capacity) {
+            RawRecord *grown = realloc(raw, record_count * sizeof(RawRecord));
+            if (!grown) {
+                error = ENOMEM;
+                break;
+            }
+            raw = grown;
+            raw_capacity = record_count;
+        }
+        for (uint32_t i = 0; i < record_count; i++) {
+            uint8_t kind;
+            read_bytes(&reader, &kind, 1);
+            uint32_t name_length = read_u32(&reader);
+            const char *name = read_span(&reader, name_length);
+            if (kind > HTMLDjangoIndexCustomTag) reader.ok = false;
+            raw[i] = (RawRecord){(HTMLDjangoIndexRecordKind)kind, name, name_length};
+        }
+        if (!reader.ok) {
+            error = EINVAL;
+        } else if (!file_pack(&files[loaded], file_path, path_length, hash, has_error, raw, record_count)) {
+            error = ENOMEM;
+        } else {
+            loaded++;
+        }
+    }
+    free(raw);
+    htmldjango_unmap_file(&map);
+
+    // Lookups depend on the files being sorted by path
+    for (size_t i = 1; !error && i < loaded; i++) {
+        if (strcmp(files[i - 1].path, files[i].path) >= 0) error = EINVAL;
+    }
+    if (error) {
+        for (size_t i = 0; i < loaded; i++) file_free(&files[i]);
+        free(files);
+        return error;
+    }
+    index->files = files;
+    index->count = loaded;
+    return 0;
+}
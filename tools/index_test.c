@@ -0,0 +1,137 @@
+// Tests for the project index. Exits non-zero if any check fails.
+
+#include "tree-sitter-htmldjango-tools.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                                                               \
+    do {                                                                                                               \
+        if (!(condition)) {                                                                                            \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);                              \
+            failures++;                                                                                                \
+        }                                                                                                              \
+    } while (0)
+
+static char root[64];
+
+static void path_in_root(char *out, size_t size, const char *name) {
+    snprintf(out, size, "%s/%s", root, name);
+}
+
+static void write_file(const char *name, const char *content) {
+    char path[256];
+    path_in_root(path, sizeof(path), name);
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        perror(path);
+        exit(1);
+    }
+    fputs(content, file);
+    fclose(file);
+}
+
+static void make_directory(const char *name) {
+    char path[256];
+    path_in_root(path, sizeof(path), name);
+    if (mkdir(path, 0755) != 0) {
+        perror(path);
+        exit(1);
+    }
+}
+
+static void make_link(const char *target, const char *name) {
+    char path[256];
+    path_in_root(path, sizeof(path), name);
+    if (symlink(target, path) != 0) {
+        perror(path);
+        exit(1);
+    }
+}
+
+static void remove_tree(void) {
+    char command[128];
+    snprintf(command, sizeof(command), "rm -rf '%s'", root);
+    if (system(command) != 0) fprintf(stderr, "could not remove %s\n", root);
+}
+
+// A link back to its own directory and a link to the root are both cycles;
+// the walk indexes each real file once and still finishes
+static void test_symlink_cycle(void) {
+    make_directory("pages");
+    write_file("base.html", "{% block content %}{% endblock %}");
+    write_file("pages/home.html", "{% extends \"base.html\" %}");
+    make_link(".", "pages/self");
+    make_link("..", "pages/up");
+
+    HTMLDjangoIndex *index = htmldjango_index_new();
+    HTMLDjangoIndexStats stats = {0};
+    CHECK(htmldjango_index_update(index, root, 2, &stats) == 0);
+    CHECK(stats.files == 2);
+    CHECK(htmldjango_index_file_count(index) == 2);
+    if (htmldjango_index_file_count(index) == 2) {
+        CHECK(strcmp(htmldjango_index_file(index, 0)->path, "base.html") == 0);
+        CHECK(strcmp(htmldjango_index_file(index, 1)->path, "pages/home.html") == 0);
+    }
+    htmldjango_index_delete(index);
+}
+
+// The cache is little-endian on every host: check the header bytes, and that
+// a cache whose integers are in the other byte order is rejected
+static void test_cache_byte_order(void) {
+    char cache[256];
+    path_in_root(cache, sizeof(cache), ".htmldjango-index");
+    HTMLDjangoIndex *index = htmldjango_index_new();
+    CHECK(htmldjango_index_update(index, root, 1, NULL) == 0);
+    CHECK(htmldjango_index_save(index, cache) == 0);
+
+    unsigned char header[12] = {0};
+    FILE *file = fopen(cache, "r+b");
+    CHECK(file && fread(header, 1, sizeof(header), file) == sizeof(header));
+    CHECK(memcmp(header, "HDJX", 4) == 0);
+    CHECK(header[4] == HTMLDJANGO_INDEX_FORMAT_VERSION && !header[5] && !header[6] && !header[7]);
+    CHECK(header[8] == 2 && !header[9] && !header[10] && !header[11]);
+
+    HTMLDjangoIndex *loaded = htmldjango_index_new();
+    CHECK(htmldjango_index_load(loaded, cache) == 0);
+    CHECK(htmldjango_index_file_count(loaded) == 2);
+    if (htmldjango_index_file_count(loaded) == 2) {
+        CHECK(htmldjango_index_file(loaded, 1)->hash == htmldjango_index_file(index, 1)->hash);
+    }
+
+    // The version as a big-endian host used to write it
+    unsigned char swapped[4] = {0, 0, 0, HTMLDJANGO_INDEX_FORMAT_VERSION};
+    if (file) {
+        fseek(file, 4, SEEK_SET);
+        fwrite(swapped, 1, sizeof(swapped), file);
+        fclose(file);
+    }
+    CHECK(htmldjango_index_load(loaded, cache) == EINVAL);
+    CHECK(htmldjango_index_file_count(loaded) == 0);
+    remove(cache);
+    htmldjango_index_delete(loaded);
+    htmldjango_index_delete(index);
+}
+
+int main(void) {
+    snprintf(root, sizeof(root), "/tmp/htmldjango-index-XXXXXX");
+    if (!mkdtemp(root)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    test_symlink_cycle();
+    test_cache_byte_order();
+    remove_tree();
+    if (failures) {
+        fprintf(stderr, "%d checks failed\n", failures);
+        return 1;
+    }
+    puts("all checks passed");
+    return 0;
+}
@@ -0,0 +1,239 @@
+// Generated by tools/gen_kinds.py from src/node-types.json. Do not edit.
+
+#ifndef TREE_SITTER_HTMLDJANGO_KIND_NAMES_H_
+#define TREE_SITTER_HTMLDJANGO_KIND_NAMES_H_
+
+#include <stdbool.h>
+
+#include "tree-sitter-htmldjango-kinds.h"
+
+static const struct {
+    const char *name;
+    bool named;
+} KIND_NAMES[HTMLDJANGO_NUM_KINDS] = {
+    {"ERROR", true},
+    {"comparison_operator", true},
+    {"django_statement", true},
+    {"element", true},
+    {"literal", true},
+    {"and_expression", true},
+    {"as_alias", true},
+    {"assignment", true},
+    {"attribute", true},
+    {"attribute_name", true},
+    {"attribute_value", true},
+    {"comparison_expression", true},
+    {"cycle_value", true},
+    {"django_attribute_elif_branch", true},
+    {"django_attribute_else_branch", true},
+    {"django_attribute_empty_branch", true},
+    {"django_attribute_for_block", true},
+    {"django_attribute_if_block", true},
+    {"django_autoescape_block", true},
+    {"django_block_block", true},
+    {"django_block_comment", true},
+    {"django_block_open", true},
+    {"django_csrf_token_tag", true},
+    {"django_cycle_tag", true},
+    {"django_debug_tag", true},
+    {"django_elif", true},
+    {"django_elif_branch", true},
+    {"django_else", true},
+    {"django_else_branch", true},
+    {"django_empty", true},
+    {"django_empty_branch", true},
+    {"django_endblock", true},
+    {"django_endfor", true},
+    {"django_endif", true},
+    {"django_endwith", true},
+    {"django_extends_tag", true},
+    {"django_filter_block", true},
+    {"django_firstof_tag", true},
+    {"django_for_block", true},
+    {"django_for_open", true},
+    {"django_generic_block", true},
+    {"django_generic_tag", true},
+    {"django_if_block", true},
+    {"django_if_open", true},
+    {"django_ifchanged_block", true},
+    {"django_include_tag", true},
+    {"django_interpolation", true},
+    {"django_load_tag", true},
+    {"django_lorem_tag", true},
+    {"django_now_tag", true},
+    {"django_partial_tag", true},
+    {"django_partialdef_block", true},
+    {"django_querystring_tag", true},
+    {"django_regroup_tag", true},
+    {"django_resetcycle_tag", true},
+    {"django_spaceless_block", true},
+    {"django_templatetag_tag", true},
+    {"django_url_tag", true},
+    {"django_verbatim_block", true},
+    {"django_widthratio_tag", true},
+    {"django_with_block", true},
+    {"django_with_open", true},
+    {"doctype", true},
+    {"document", true},
+    {"end_tag", true},
+    {"erroneous_end_tag", true},
+    {"filter_argument", true},
+    {"filter_call", true},
+    {"filter_chain", true},
+    {"filter_expression", true},
+    {"foreign_element", true},
+    {"lookup", true},
+    {"loop_variables", true},
+    {"named_argument", true},
+    {"normal_element", true},
+    {"not_expression", true},
+    {"or_expression", true},
+    {"plaintext_element", true},
+    {"quoted_attribute_value", true},
+    {"raw_text", true},
+    {"rcdata_element", true},
+    {"script_element", true},
+    {"start_tag", true},
+    {"string", true},
+    {"style_element", true},
+    {"tag_argument", true},
+    {"test_expression", true},
+    {"text", true},
+    {"unpaired_end_tag", true},
+    {"unpaired_start_tag", true},
+    {"void_element", true},
+    {"with_assignments", true},
+    {"with_legacy", true},
+    {"\"", false},
+    {"%}", false},
+    {"'", false},
+    {",", false},
+    {".", false},
+    {"/>", false},
+    {":", false},
+    {"<", false},
+    {"<!", false},
+    {"</", false},
+    {"=", false},
+    {">", false},
+    {"and", false},
+    {"and_keyword", true},
+    {"argument_name", true},
+    {"as", false},
+    {"autoescape", false},
+    {"autoescape_value", true},
+    {"block", false},
+    {"block_name", true},
+    {"by", false},
+    {"comment", true},
+    {"comment", false},
+    {"comment_content", true},
+    {"comment_text", true},
+    {"csrf_token", false},
+    {"cycle", false},
+    {"cycle_name", true},
+    {"debug", false},
+    {"django_line_comment", true},
+    {"doctype_keyword", true},
+    {"elif", false},
+    {"else", false},
+    {"empty", false},
+    {"end_tag_name", true},
+    {"endautoescape", false},
+    {"endblock", false},
+    {"endcomment", false},
+    {"endfilter", false},
+    {"endfor", false},
+    {"endif", false},
+    {"endifchanged", false},
+    {"endpartialdef", false},
+    {"endspaceless", false},
+    {"endwith", false},
+    {"entity", true},
+    {"erroneous_end_tag_name", true},
+    {"extends", false},
+    {"filter", false},
+    {"filter_name", true},
+    {"firstof", false},
+    {"for", false},
+    {"from", false},
+    {"generic_tag_name", true},
+    {"i18n_string", true},
+    {"identifier", true},
+    {"if", false},
+    {"ifchanged", false},
+    {"implicit_end_tag", true},
+    {"in", false},
+    {"include", false},
+    {"inline", true},
+    {"library_name", true},
+    {"load", false},
+    {"lorem", false},
+    {"method", true},
+    {"name_segment", true},
+    {"not", false},
+    {"now", false},
+    {"number", true},
+    {"numeric_index", true},
+    {"only", true},
+    {"op_eq", true},
+    {"op_gt", true},
+    {"op_gte", true},
+    {"op_in", true},
+    {"op_is", true},
+    {"op_is_not", true},
+    {"op_lt", true},
+    {"op_lte", true},
+    {"op_ne", true},
+    {"op_not_in", true},
+    {"or_keyword", true},
+    {"partial", false},
+    {"partial_name", true},
+    {"partialdef", false},
+    {"plaintext_text", true},
+    {"querystring", false},
+    {"random", true},
+    {"rcdata_text", true},
+    {"regroup", false},
+    {"resetcycle", false},
+    {"reversed", true},
+    {"silent", true},
+    {"spaceless", false},
+    {"tag_name", true},
+    {"templatetag", false},
+    {"templatetag_argument", true},
+    {"url", false},
+    {"variable_name", true},
+    {"verbatim", false},
+    {"verbatim_content", true},
+    {"widthratio", false},
+    {"with", false},
+    {"{%", false},
+    {"{{", false},
+    {"|", false},
+    {"}}", false},
+};
+
+static const char *const FIELD_NAMES[HTMLDJANGO_NUM_FIELDS] = {
+    "",
+    "alias",
+    "argument",
+    "body",
+    "condition",
+    "count",
+    "end_name",
+    "filters",
+    "format",
+    "grouper",
+    "iterable",
+    "max_value",
+    "max_width",
+    "name",
+    "source",
+    "target",
+    "template",
+    "url_name",
+    "value",
+};
+
+#endif // TREE_SITTER_HTMLDJANGO_KIND_NAMES_H_
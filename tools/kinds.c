@@ -0,0 +1,42 @@
+#include "tree-sitter-htmldjango.h"
+#include "tree-sitter-htmldjango-kinds.h"
+#include "kind_names.h"
+
+#include "tree_sitter/parser.h"
+
+#include <string.h>
+
+// Reads the symbol and field names straight from the generated language, so
+// that the grammar library can build the tables without the runtime
+
+static uint16_t kind_for_name(const char *name, bool named) {
+    for (uint16_t kind = 1; name && kind < HTMLDJANGO_NUM_KINDS; kind++) {
+        if (KIND_NAMES[kind].named == named && strcmp(KIND_NAMES[kind].name, name) == 0) return kind;
+    }
+    return HTMLDJANGO_KIND_ERROR;
+}
+
+uint32_t htmldjango_symbol_kinds(uint16_t *kinds, uint32_t count) {
+    const TSLanguage *language = tree_sitter_htmldjango();
+    uint32_t symbol_count = language->symbol_count + language->alias_count;
+    for (uint32_t symbol = 0; symbol < symbol_count && symbol < count; symbol++) {
+        kinds[symbol] = kind_for_name(language->symbol_names[symbol], language->symbol_metadata[symbol].named);
+    }
+    return symbol_count;
+}
+
+uint32_t htmldjango_field_ids(uint16_t *fields, uint32_t count) {
+    const TSLanguage *language = tree_sitter_htmldjango();
+    uint32_t field_count = language->field_count + 1;
+    for (uint32_t field = 0; field < field_count && field < count; field++) {
+        const char *name = field > 0 ? language->field_names[field] : NULL;
+        fields[field] = HTMLDJANGO_FIELD_NONE;
+        for (uint16_t id = 1; name && id < HTMLDJANGO_NUM_FIELDS; id++) {
+            if (strcmp(FIELD_NAMES[id], name) == 0) {
+                fields[field] = id;
+                break;
+            }
+        }
+    }
+    return field_count;
+}
@@ -0,0 +1,129 @@
+#ifndef TREE_SITTER_HTMLDJANGO_TOOLS_LEXER_H_
+#define TREE_SITTER_HTMLDJANGO_TOOLS_LEXER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+// Splits a template into Django tags the way Django's template Lexer does:
+// {{ }}, {% %} and {# #} never span lines, and end at the first closing
+// delimiter. The contents of comment and verbatim blocks are skipped, as are
+// {# #} comments. Shared by the extractors, which match tag shapes from
+// grammar.js against the tags this yields without building a tree.
+
+typedef struct {
+    const char *start;
+    const char *end;
+} Span;
+
+typedef struct {
+    // '%' for {% %}, '{' for {{ }}
+    char kind;
+    // The whole tag, delimiters included
+    Span tag;
+    // The inside, without surrounding whitespace
+    Span body;
+} LexerTag;
+
+typedef struct {
+    const char *cursor;
+    const char *end;
+    enum { LEXER_TEMPLATE, LEXER_COMMENT, LEXER_VERBATIM } state;
+    Span verbatim_suffix;
+} Lexer;
+
+static inline bool lexer_is_space(char c) { return c == ' ' || c == '\t'; }
+
+static inline bool lexer_is_word_start(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+static inline bool lexer_is_word(char c) { return lexer_is_word_start(c) || (c >= '0' && c <= '9'); }
+
+static inline Span span_trim(Span span) {
+    while (span.start < span.end && lexer_is_space(*span.start)) span.start++;
+    while (span.end > span.start && lexer_is_space(span.end[-1])) span.end--;
+    return span;
+}
+
+static inline bool span_equals(Span span, const char *text) {
+    size_t length = strlen(text);
+    return (size_t)(span.end - span.start) == length && memcmp(span.start, text, length) == 0;
+}
+
+// Splits a tag body into its name and the rest; the name must be followed by
+// whitespace or the end of the tag, as a keyword would be
+static inline bool span_split_name(Span body, Span *name, Span *rest) {
+    const char *cursor = body.start;
+    while (cursor < body.end && lexer_is_word(*cursor)) cursor++;
+    if (cursor == body.start || (cursor < body.end && !lexer_is_space(*cursor))) return false;
+    *name = (Span){body.start, cursor};
+    *rest = (Span){cursor, body.end};
+    return true;
+}
+
+static inline Lexer lexer_new(const char *source, size_t length) {
+    return (Lexer){.cursor = source, .end = source + length, .state = LEXER_TEMPLATE};
+}
+
+static inline const char *lexer_find_closing(const char *cursor, const char *end, char first) {
+    for (; cursor + 1 < end; cursor++) {
+        if (*cursor == '\n') return NULL;
+        if (cursor[0] == first && cursor[1] == '}') return cursor;
+    }
+    return NULL;
+}
+
+// Moves to the next {% %} or {{ }} tag outside comment and verbatim blocks.
+// The comment and verbatim tags themselves are consumed here.
+static inline bool lexer_next(Lexer *lexer, LexerTag *tag) {
+    while (lexer->cursor < lexer->end) {
+        const char *open = memchr(lexer->cursor, '{', (size_t)(lexer->end - lexer->cursor));
+        if (!open || open + 1 == lexer->end) break;
+        lexer->cursor = open + 1;
+        char kind = *lexer->cursor;
+        if (kind != '%' && kind != '{' && kind != '#') continue;
+
+        const char *close = lexer_find_closing(lexer->cursor + 1, lexer->end, kind == '{' ? '}' : kind);
+        if (!close) continue;
+        lexer->cursor = close + 2;
+        if (kind == '#') continue;
+
+        Span body = span_trim((Span){open + 2, close});
+        if (lexer->state == LEXER_COMMENT) {
+            if (kind == '%' && span_equals(body, "endcomment")) lexer->state = LEXER_TEMPLATE;
+            continue;
+        }
+        if (lexer->state == LEXER_VERBATIM) {
+            // {% endverbatim %} with exactly the suffix of the opening tag
+            Span suffix = lexer->verbatim_suffix;
+            size_t suffix_length = (size_t)(suffix.end - suffix.start);
+            if (kind == '%' && (size_t)(body.end - body.start) == 11 + suffix_length &&
+                memcmp(body.start, "endverbatim", 11) == 0 &&
+                memcmp(body.start + 11, suffix.start, suffix_length) == 0) {
+                lexer->state = LEXER_TEMPLATE;
+            }
+            continue;
+        }
+
+        Span name, rest;
+        if (kind == '%' && span_split_name(body, &name, &rest)) {
+            if (span_equals(name, "comment")) {
+                lexer->state = LEXER_COMMENT;
+                continue;
+            }
+            if (span_equals(name, "verbatim")) {
+                // Like the scanner, the suffix is everything after the keyword
+                lexer->state = LEXER_VERBATIM;
+                lexer->verbatim_suffix = rest;
+                continue;
+            }
+        }
+        *tag = (LexerTag){kind, {open, lexer->cursor}, body};
+        return true;
+    }
+    lexer->cursor = lexer->end;
+    return false;
+}
+
+#endif // TREE_SITTER_HTMLDJANGO_TOOLS_LEXER_H_
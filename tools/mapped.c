@@ -0,0 +1,71 @@
+#include "tree-sitter-htmldjango-tools.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+int htmldjango_map_file(const char *path, HTMLDjangoMappedFile *file) {
+    file->data = NULL;
+    file->length = 0;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return errno;
+
+    struct stat info;
+    int error = 0;
+    if (fstat(fd, &info) != 0) {
+        error = errno;
+    } else if (!S_ISREG(info.st_mode)) {
+        error = EINVAL;
+    } else if ((uint64_t)info.st_size > UINT32_MAX) {
+        error = EFBIG;
+    } else if (info.st_size > 0) {
+        void *data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            error = errno;
+        } else {
+            // The parser reads front to back, apart from short backtracks
+            posix_madvise(data, (size_t)info.st_size, POSIX_MADV_SEQUENTIAL);
+            file->data = data;
+            file->length = (uint32_t)info.st_size;
+        }
+    }
+    close(fd);
+    return error;
+}
+
+void htmldjango_unmap_file(HTMLDjangoMappedFile *file) {
+    if (file->data) munmap((void *)file->data, file->length);
+    file->data = NULL;
+    file->length = 0;
+}
+
+static const char *read_mapped(void *payload, uint32_t byte_index, TSPoint position, uint32_t *bytes_read) {
+    (void)position;
+    const HTMLDjangoMappedFile *file = payload;
+    if (byte_index >= file->length) {
+        *bytes_read = 0;
+        return "";
+    }
+    *bytes_read = file->length - byte_index;
+    return file->data + byte_index;
+}
+
+TSInput htmldjango_mapped_input(const HTMLDjangoMappedFile *file) {
+    return (TSInput){
+        .payload = (void *)file,
+        .read = read_mapped,
+        .encoding = TSInputEncodingUTF8,
+    };
+}
+
+TSTree *htmldjango_parse_file(TSParser *parser, const TSTree *old_tree, const char *path, int *error) {
+    HTMLDjangoMappedFile file;
+    int status = htmldjango_map_file(path, &file);
+    if (error) *error = status;
+    if (status) return NULL;
+    TSTree *tree = ts_parser_parse(parser, old_tree, htmldjango_mapped_input(&file));
+    htmldjango_unmap_file(&file);
+    return tree;
+}
@@ -0,0 +1,45 @@
+#include "tree-sitter-htmldjango-tools.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+static struct {
+    uint16_t *kinds;
+    uint32_t kind_count;
+    uint16_t *fields;
+    uint32_t field_count;
+} tables;
+
+static pthread_once_t tables_once = PTHREAD_ONCE_INIT;
+
+// Out of memory leaves both tables empty, so every lookup answers ERROR or
+// no field rather than failing
+static void build_tables(void) {
+    uint32_t kind_count = htmldjango_symbol_kinds(NULL, 0);
+    uint32_t field_count = htmldjango_field_ids(NULL, 0);
+    uint16_t *kinds = malloc(kind_count * sizeof(uint16_t));
+    uint16_t *fields = malloc(field_count * sizeof(uint16_t));
+    if (!kinds || !fields) {
+        free(kinds);
+        free(fields);
+        return;
+    }
+    htmldjango_symbol_kinds(kinds, kind_count);
+    htmldjango_field_ids(fields, field_count);
+    tables.kinds = kinds;
+    tables.kind_count = kind_count;
+    tables.fields = fields;
+    tables.field_count = field_count;
+}
+
+uint16_t htmldjango_kind_for_symbol(TSSymbol symbol) {
+    pthread_once(&tables_once, build_tables);
+    return symbol < tables.kind_count ? tables.kinds[symbol] : HTMLDJANGO_KIND_ERROR;
+}
+
+uint16_t htmldjango_node_kind(TSNode node) { return htmldjango_kind_for_symbol(ts_node_symbol(node)); }
+
+uint16_t htmldjango_field_for_id(TSFieldId field) {
+    pthread_once(&tables_once, build_tables);
+    return field < tables.field_count ? tables.fields[field] : HTMLDJANGO_FIELD_NONE;
+}